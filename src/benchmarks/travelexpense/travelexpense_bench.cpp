@@ -0,0 +1,798 @@
+/**
+ * @file travelexpense_bench.cpp
+ * @brief Seyahat Gideri Takibi - Performans Ölçümleri (Benchmark)
+ *
+ * Bu dosya, kriptografik primitiflerin verim (throughput) ölçümlerini içerir:
+ * - Kripto paketi: sha256Hash, hmacSHA256, encryptAES256/decryptAES256,
+ *   whitebox DES/AES, constantTimeCompare ve secureMemoryCleanup için
+ *   16 B - 64 MiB arası mesaj boyutları (4'ün katları), pbkdf2 için
+ *   iterasyon sayısı başına ölçüm. Oturum HMAC'i ve payload şifrelemesi
+ *   ham anahtar ve SessionKeyHandle ile karşılaştırmalı ölçülür;
+ *   sealPayload, encryptPayload + calculateHMAC + signData zinciriyle
+ *   karşılaştırılır. signData/signMany 256 byte'lık kayıtlarla (mesaj
+ *   boyutu yerine toplu kayıt sayısı başına) ölçülür.
+ * - AES-256 motoru: her mod (ECB/CBC, şifreleme/şifre çözme) ve CPU'nun
+ *   desteklediği her arka uç (portable, AES-NI, VAES) ayrı ayrı.
+ * - TLS (loopback test sunucusu): tam ve devam ettirilen (resumption)
+ *   handshake hızı, bağlanıp ilk echo byte'ını alma süresi (time-to-first-
+ *   byte) ve aynı işlemin bağlantı havuzu üzerinden süresi. Kütüphane
+ *   OpenSSL olmadan derlendiyse atlanır.
+ *
+ * Sonuçlar tablo olarak yazdırılır; --json ile sürümler arası gerileme
+ * takibi için JSON dosyasına da kaydedilir.
+ *
+ * Kullanım: travelexpense_bench [--json <dosya>] [--max-size <byte>]
+ *                               [--min-time <saniye>] [aes_buffer_boyutu_byte]
+ *           travelexpense_bench --password-target-ms <ms>
+ *
+ * --password-target-ms, şifre hash'i için bu makinede hedef gecikmeyi
+ * sağlayan PBKDF2 iterasyon sayısını ölçüp yazdırır
+ * (Encryption::setPasswordHashIterations ile uygulanacak değer).
+ *
+ * @author Binnur Altınışık
+ * @date 2025
+ */
+
+#include "travelexpense.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using namespace TravelExpense;
+
+// ============================================
+// ÖLÇÜM ALTYAPISI
+// ============================================
+
+/**
+ * @brief Tek bir ölçüm sonucu
+ */
+struct BenchResult {
+  std::string group;    /**< @brief Ölçüm grubu (crypto, pbkdf2, aes256-engine, tls) */
+  std::string name;     /**< @brief İşlem adı */
+  size_t bytes;         /**< @brief İşlem başına işlenen byte */
+  uint32_t cost;        /**< @brief Maliyet parametresi (pbkdf2 iterasyonu, yoksa 0) */
+  uint64_t iterations;  /**< @brief Ölçülen tekrar sayısı */
+  double seconds;       /**< @brief Toplam ölçüm süresi */
+};
+
+/**
+ * @brief Kripto paketi ölçümleri için ortak buffer'lar
+ */
+struct BenchBuffers {
+  std::vector<uint8_t> input;   /**< @brief Girdi verisi */
+  std::vector<uint8_t> output;  /**< @brief Çıktı verisi (girdi + 16 byte padding payı) */
+  std::vector<uint8_t> cipher;  /**< @brief Şifre çözme ölçümleri için hazır şifreli veri */
+  size_t cipherLen;             /**< @brief Hazır şifreli veri uzunluğu */
+  uint8_t key[32];              /**< @brief Sabit AES/HMAC anahtarı */
+  uint8_t iv[16];               /**< @brief Sabit IV */
+  char hex[65];                 /**< @brief Hash/HMAC hex çıktısı */
+  SessionManager::SessionKeyHandle *session;  /**< @brief key ile oluşturulmuş oturum tutamacı */
+};
+
+/**
+ * @brief Kripto paketi işlemi
+ *
+ * @param b Ortak buffer'lar
+ * @param len Mesaj uzunluğu
+ * @return bool İşlem başarılı mı
+ */
+typedef bool (*SuiteBenchFunction)(BenchBuffers &b, size_t len);
+
+/**
+ * @brief Kripto paketi işlemi ve (varsa) ölçüm dışı hazırlığı
+ */
+struct SuiteBenchCase {
+  const char *name;          /**< @brief İşlem adı */
+  SuiteBenchFunction setup;  /**< @brief Ölçüm öncesi hazırlık (nullptr olabilir) */
+  SuiteBenchFunction run;    /**< @brief Ölçülen işlem */
+};
+
+/**
+ * @brief Ölçülecek işlem (genel)
+ */
+struct BenchCallable {
+  virtual ~BenchCallable() {}
+  /** @brief İşlemi bir kez çalıştır */
+  virtual bool operator()() = 0;
+};
+
+/**
+ * @brief İşlemi en az minSeconds süre boyunca tekrarla
+ *
+ * @param fn Ölçülecek işlem
+ * @param minSeconds Minimum ölçüm süresi (saniye)
+ * @param iterations Tekrar sayısı (çıktı)
+ * @param seconds Geçen süre (çıktı)
+ * @return bool İşlem her tekrarda başarılı mı
+ */
+static bool measure(BenchCallable &fn, double minSeconds, uint64_t &iterations, double &seconds) {
+  // Isınma turu (cache, frekans)
+  if (!fn()) {
+    return false;
+  }
+
+  iterations = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  double elapsed = 0.0;
+
+  do {
+    if (!fn()) {
+      return false;
+    }
+
+    ++iterations;
+    elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < minSeconds);
+
+  seconds = elapsed;
+  return true;
+}
+
+/**
+ * @brief Sonucun verimi (MB/s, 1 MB = 1e6 byte)
+ */
+static double resultMBps(const BenchResult &r) {
+  return (static_cast<double>(r.bytes) * static_cast<double>(r.iterations)) / r.seconds / 1e6;
+}
+
+/**
+ * @brief Sonucun işlem başına süresi (ns)
+ */
+static double resultNsPerOp(const BenchResult &r) {
+  return r.seconds * 1e9 / static_cast<double>(r.iterations);
+}
+
+/**
+ * @brief Sonucu tablo satırı olarak yazdır
+ */
+static void printResult(const BenchResult &r) {
+  std::printf("%-14s %-20s %10zu %8u %14.1f %12.2f\n", r.group.c_str(), r.name.c_str(),
+              r.bytes, r.cost, resultNsPerOp(r), resultMBps(r));
+}
+
+// ============================================
+// KRİPTO PAKETİ
+// ============================================
+
+/** @brief sha256Hash ölçümü */
+static bool benchSHA256(BenchBuffers &b, size_t len) {
+  return Encryption::sha256Hash(b.input.data(), len, b.hex);
+}
+
+/** @brief hmacSHA256 ölçümü */
+static bool benchHMAC(BenchBuffers &b, size_t len) {
+  return Encryption::hmacSHA256(b.key, sizeof(b.key), b.input.data(), len, b.hex);
+}
+
+/** @brief SessionManager::calculateHMAC ölçümü (ham anahtar, mesaj başına anahtar hazırlığı) */
+static bool benchSessionHMAC(BenchBuffers &b, size_t len) {
+  return SessionManager::calculateHMAC(b.input.data(), len, b.key, b.hex) == ErrorCode::Success;
+}
+
+/** @brief SessionManager::calculateHMAC ölçümü (hazır HMAC ara durumları) */
+static bool benchSessionHMACHandle(BenchBuffers &b, size_t len) {
+  return SessionManager::calculateHMAC(b.input.data(), len, *b.session, b.hex) == ErrorCode::Success;
+}
+
+/** @brief SessionManager::encryptPayload ölçümü (ham anahtar, mesaj başına anahtar genişletme) */
+static bool benchSessionEncrypt(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  return SessionManager::encryptPayload(b.input.data(), len, b.key, b.cipher.data(),
+                                        outLen) == ErrorCode::Success;
+}
+
+/** @brief SessionManager::encryptPayload ölçümü (hazır AES anahtar takvimi) */
+static bool benchSessionEncryptHandle(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  return SessionManager::encryptPayload(b.input.data(), len, *b.session, b.cipher.data(),
+                                        outLen) == ErrorCode::Success;
+}
+
+/** @brief Üç geçişli iletim zinciri: encryptPayload + calculateHMAC + signData */
+static bool benchSessionEncryptMacSign(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  char signature[129];
+  return SessionManager::encryptPayload(b.input.data(), len, *b.session, b.cipher.data(),
+                                        outLen) == ErrorCode::Success &&
+         SessionManager::calculateHMAC(b.cipher.data(), outLen, *b.session, b.hex) == ErrorCode::Success &&
+         SessionManager::signData(b.cipher.data(), outLen, signature) == ErrorCode::Success;
+}
+
+/** @brief SessionManager::sealPayload ölçümü (tek geçiş) */
+static bool benchSessionSeal(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  return SessionManager::sealPayload(b.input.data(), len, *b.session, b.cipher.data(),
+                                     b.cipher.size(), outLen) == ErrorCode::Success;
+}
+
+/** @brief Toplu imza ölçümlerinde kayıt uzunluğu */
+static const size_t SIGN_RECORD_SIZE = 256;
+
+/** @brief signData ölçümü: len / SIGN_RECORD_SIZE kayıt tek tek */
+static bool benchSignData(BenchBuffers &b, size_t len) {
+  char signature[129];
+
+  for (size_t offset = 0; offset + SIGN_RECORD_SIZE <= len; offset += SIGN_RECORD_SIZE) {
+    if (SessionManager::signData(b.input.data() + offset, SIGN_RECORD_SIZE, signature) != ErrorCode::Success) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/** @brief signMany ölçümü: len / SIGN_RECORD_SIZE kayıt toplu */
+static bool benchSignMany(BenchBuffers &b, size_t len) {
+  const size_t batch = 64;
+  Encryption::IOVec records[batch];
+  char signatures[batch][129];
+  char *outputs[batch];
+  size_t offset = 0;
+
+  while (offset + SIGN_RECORD_SIZE <= len) {
+    size_t n = 0;
+
+    for (; n < batch && offset + SIGN_RECORD_SIZE <= len; ++n, offset += SIGN_RECORD_SIZE) {
+      records[n].base = b.input.data() + offset;
+      records[n].length = SIGN_RECORD_SIZE;
+      outputs[n] = signatures[n];
+    }
+
+    if (SessionManager::signMany(records, n, outputs) != ErrorCode::Success) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/** @brief encryptAES256 (CBC + PKCS7) ölçümü */
+static bool benchEncryptAES256(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  return Encryption::encryptAES256(b.input.data(), len, b.key, b.iv, b.output.data(), outLen);
+}
+
+/** @brief decryptAES256 için şifreli veri hazırla */
+static bool setupDecryptAES256(BenchBuffers &b, size_t len) {
+  return Encryption::encryptAES256(b.input.data(), len, b.key, b.iv, b.cipher.data(), b.cipherLen);
+}
+
+/** @brief decryptAES256 ölçümü */
+static bool benchDecryptAES256(BenchBuffers &b, size_t) {
+  size_t outLen = 0;
+  return Encryption::decryptAES256(b.cipher.data(), b.cipherLen, b.key, b.iv, b.output.data(), outLen);
+}
+
+/** @brief encryptWhiteboxDES ölçümü */
+static bool benchEncryptWhiteboxDES(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  return Encryption::encryptWhiteboxDES(b.input.data(), len, b.output.data(), outLen);
+}
+
+/** @brief decryptWhiteboxDES için şifreli veri hazırla */
+static bool setupDecryptWhiteboxDES(BenchBuffers &b, size_t len) {
+  return Encryption::encryptWhiteboxDES(b.input.data(), len, b.cipher.data(), b.cipherLen);
+}
+
+/** @brief decryptWhiteboxDES ölçümü */
+static bool benchDecryptWhiteboxDES(BenchBuffers &b, size_t) {
+  size_t outLen = 0;
+  return Encryption::decryptWhiteboxDES(b.cipher.data(), b.cipherLen, b.output.data(), outLen);
+}
+
+/** @brief encryptWhiteboxAES ölçümü */
+static bool benchEncryptWhiteboxAES(BenchBuffers &b, size_t len) {
+  size_t outLen = 0;
+  return Encryption::encryptWhiteboxAES(b.input.data(), len, b.output.data(), outLen);
+}
+
+/** @brief decryptWhiteboxAES için şifreli veri hazırla */
+static bool setupDecryptWhiteboxAES(BenchBuffers &b, size_t len) {
+  return Encryption::encryptWhiteboxAES(b.input.data(), len, b.cipher.data(), b.cipherLen);
+}
+
+/** @brief decryptWhiteboxAES ölçümü */
+static bool benchDecryptWhiteboxAES(BenchBuffers &b, size_t) {
+  size_t outLen = 0;
+  return Encryption::decryptWhiteboxAES(b.cipher.data(), b.cipherLen, b.output.data(), outLen);
+}
+
+/** @brief constantTimeCompare için eşit kopya hazırla (en kötü durum: tam tarama) */
+static bool setupConstantTimeCompare(BenchBuffers &b, size_t len) {
+  std::memcpy(b.cipher.data(), b.input.data(), len);
+  return true;
+}
+
+/** @brief constantTimeCompare ölçümü */
+static bool benchConstantTimeCompare(BenchBuffers &b, size_t len) {
+  return Encryption::constantTimeCompare(reinterpret_cast<const char *>(b.input.data()),
+                                         reinterpret_cast<const char *>(b.cipher.data()), len);
+}
+
+/** @brief secureMemoryCleanup ölçümü */
+static bool benchSecureMemoryCleanup(BenchBuffers &b, size_t len) {
+  return Security::secureMemoryCleanup(b.output.data(), len);
+}
+
+/**
+ * @brief Kripto paketi işlemini tek mesaj boyutu için çağıran adaptör
+ */
+struct SuiteCallable : BenchCallable {
+  SuiteBenchFunction fn;  /**< @brief Ölçülen işlem */
+  BenchBuffers *buffers;  /**< @brief Ortak buffer'lar */
+  size_t len;             /**< @brief Mesaj uzunluğu */
+
+  SuiteCallable(SuiteBenchFunction f, BenchBuffers *b, size_t l) : fn(f), buffers(b), len(l) {}
+
+  bool operator()() {
+    return fn(*buffers, len);
+  }
+};
+
+/**
+ * @brief pbkdf2 çağrısını sabit parola/salt ile çağıran adaptör
+ */
+struct PBKDF2Callable : BenchCallable {
+  uint32_t iterations;  /**< @brief PBKDF2 iterasyon sayısı */
+  uint8_t output[32];   /**< @brief Türetilen anahtar */
+
+  explicit PBKDF2Callable(uint32_t i) : iterations(i) {}
+
+  bool operator()() {
+    static const char password[] = "benchmark-password";
+    static const uint8_t salt[16] = {
+      0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+      0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+    return Encryption::pbkdf2(password, sizeof(password) - 1, salt, sizeof(salt),
+                              iterations, sizeof(output), output);
+  }
+};
+
+/**
+ * @brief Kripto paketini tüm mesaj boyutlarında çalıştır
+ *
+ * @param maxSize En büyük mesaj boyutu (byte)
+ * @param minSeconds Ölçüm başına minimum süre
+ * @param results Sonuç listesi (eklenir)
+ * @return bool Tüm işlemler başarılı mı
+ */
+static bool runCryptoSuite(size_t maxSize, double minSeconds, std::vector<BenchResult> &results) {
+  static const SuiteBenchCase cases[] = {
+    {"sha256Hash", nullptr, benchSHA256},
+    {"hmacSHA256", nullptr, benchHMAC},
+    {"encryptAES256", nullptr, benchEncryptAES256},
+    {"decryptAES256", setupDecryptAES256, benchDecryptAES256},
+    {"encryptWhiteboxDES", nullptr, benchEncryptWhiteboxDES},
+    {"decryptWhiteboxDES", setupDecryptWhiteboxDES, benchDecryptWhiteboxDES},
+    {"encryptWhiteboxAES", nullptr, benchEncryptWhiteboxAES},
+    {"decryptWhiteboxAES", setupDecryptWhiteboxAES, benchDecryptWhiteboxAES},
+    {"constantTimeCompare", setupConstantTimeCompare, benchConstantTimeCompare},
+    {"secureMemoryCleanup", nullptr, benchSecureMemoryCleanup},
+    {"sessionHMAC", nullptr, benchSessionHMAC},
+    {"sessionHMAC/handle", nullptr, benchSessionHMACHandle},
+    {"sessionEncrypt", nullptr, benchSessionEncrypt},
+    {"sessionEncrypt/handle", nullptr, benchSessionEncryptHandle},
+    {"sessionEncryptMacSign", nullptr, benchSessionEncryptMacSign},
+    {"sealPayload", nullptr, benchSessionSeal},
+    {"signData", nullptr, benchSignData},
+    {"signMany", nullptr, benchSignMany}
+  };
+  BenchBuffers buffers;
+  buffers.input.resize(maxSize);
+  buffers.output.resize(maxSize + 16);
+  // Oturum şifrelemesi IV + padding / mühür başlığı + etiket payı ile yazar
+  buffers.cipher.resize(maxSize + SessionManager::SEALED_PAYLOAD_OVERHEAD);
+  buffers.cipherLen = 0;
+  buffers.session = nullptr;
+
+  for (size_t i = 0; i < maxSize; ++i) {
+    buffers.input[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+
+  for (int i = 0; i < 32; ++i) {
+    buffers.key[i] = static_cast<uint8_t>(i);
+  }
+
+  for (int i = 0; i < 16; ++i) {
+    buffers.iv[i] = static_cast<uint8_t>(0xA0 + i);
+  }
+
+  if (SessionManager::createSessionKeyHandle(buffers.key, &buffers.session) != ErrorCode::Success) {
+    std::fprintf(stderr, "oturum tutamaci olusturulamadi\n");
+    return false;
+  }
+
+  bool ok = true;
+
+  for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+    for (size_t len = 16; len <= maxSize; len *= 4) {
+      BenchResult r = {"crypto", cases[c].name, len, 0, 0, 0.0};
+
+      if (cases[c].setup && !cases[c].setup(buffers, len)) {
+        std::fprintf(stderr, "%s hazirligi basarisiz (%zu byte)\n", cases[c].name, len);
+        ok = false;
+        continue;
+      }
+
+      SuiteCallable fn(cases[c].run, &buffers, len);
+
+      if (!measure(fn, minSeconds, r.iterations, r.seconds)) {
+        std::fprintf(stderr, "%s basarisiz (%zu byte)\n", cases[c].name, len);
+        ok = false;
+        continue;
+      }
+
+      printResult(r);
+      results.push_back(r);
+    }
+  }
+
+  const uint32_t pbkdf2Costs[2] = {1000, 10000};
+
+  for (int i = 0; i < 2; ++i) {
+    PBKDF2Callable fn(pbkdf2Costs[i]);
+    BenchResult r = {"pbkdf2", "pbkdf2", 18, pbkdf2Costs[i], 0, 0.0};
+
+    if (!measure(fn, minSeconds, r.iterations, r.seconds)) {
+      std::fprintf(stderr, "pbkdf2 basarisiz (%u iterasyon)\n", pbkdf2Costs[i]);
+      ok = false;
+      continue;
+    }
+
+    printResult(r);
+    results.push_back(r);
+  }
+
+  SessionManager::releaseSessionKeyHandle(buffers.session);
+  return ok;
+}
+
+// ============================================
+// AES-256 MOTORU (ARKA UÇ BAŞINA)
+// ============================================
+
+/**
+ * @brief Tek bir ölçülecek işlem
+ *
+ * @param ctx AES bağlamı
+ * @param in Girdi buffer'ı
+ * @param out Çıktı buffer'ı
+ * @param len Buffer uzunluğu (16'nın katı)
+ */
+typedef void (*AESBenchFunction)(const Encryption::AES256Context *ctx,
+                                 const uint8_t *in, uint8_t *out, size_t len);
+
+/** @brief ECB şifreleme ölçümü */
+static void benchECBEncrypt(const Encryption::AES256Context *ctx, const uint8_t *in, uint8_t *out, size_t len) {
+  Encryption::aes256EncryptBlocks(ctx, in, out, len / 16);
+}
+
+/** @brief ECB şifre çözme ölçümü */
+static void benchECBDecrypt(const Encryption::AES256Context *ctx, const uint8_t *in, uint8_t *out, size_t len) {
+  Encryption::aes256DecryptBlocks(ctx, in, out, len / 16);
+}
+
+/** @brief CBC şifreleme ölçümü */
+static void benchCBCEncrypt(const Encryption::AES256Context *ctx, const uint8_t *in, uint8_t *out, size_t len) {
+  uint8_t iv[16] = {0};
+  Encryption::aes256EncryptCBC(ctx, iv, in, out, len / 16);
+}
+
+/** @brief CBC şifre çözme ölçümü */
+static void benchCBCDecrypt(const Encryption::AES256Context *ctx, const uint8_t *in, uint8_t *out, size_t len) {
+  uint8_t iv[16] = {0};
+  Encryption::aes256DecryptCBC(ctx, iv, in, out, len / 16);
+}
+
+/**
+ * @brief AES motoru işlemini çağıran adaptör
+ */
+struct AESCallable : BenchCallable {
+  AESBenchFunction fn;                        /**< @brief Ölçülen işlem */
+  const Encryption::AES256Context *ctx;       /**< @brief AES bağlamı */
+  const uint8_t *in;                          /**< @brief Girdi */
+  uint8_t *out;                               /**< @brief Çıktı */
+  size_t len;                                 /**< @brief Uzunluk */
+
+  AESCallable(AESBenchFunction f, const Encryption::AES256Context *c, const uint8_t *i, uint8_t *o, size_t l)
+    : fn(f), ctx(c), in(i), out(o), len(l) {}
+
+  bool operator()() {
+    fn(ctx, in, out, len);
+    return true;
+  }
+};
+
+/**
+ * @brief AES-256 motorunu desteklenen her arka uçta ölç
+ *
+ * @param bufferSize Buffer boyutu (16'nın katı)
+ * @param minSeconds Ölçüm başına minimum süre
+ * @param results Sonuç listesi (eklenir)
+ */
+static void runAESEngineBench(size_t bufferSize, double minSeconds, std::vector<BenchResult> &results) {
+  std::vector<uint8_t> input(bufferSize);
+  std::vector<uint8_t> output(bufferSize);
+
+  for (size_t i = 0; i < bufferSize; ++i) {
+    input[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+
+  uint8_t key[32];
+
+  for (int i = 0; i < 32; ++i) {
+    key[i] = static_cast<uint8_t>(i);
+  }
+
+  const Encryption::AESBackend backends[3] = {
+    Encryption::AESBackend::Portable,
+    Encryption::AESBackend::AESNI,
+    Encryption::AESBackend::VAES
+  };
+  const char *modeNames[4] = {"ecb-encrypt", "ecb-decrypt", "cbc-encrypt", "cbc-decrypt"};
+  const AESBenchFunction modes[4] = {benchECBEncrypt, benchECBDecrypt, benchCBCEncrypt, benchCBCDecrypt};
+  Encryption::AESBackend original = Encryption::getAESBackend();
+
+  for (int b = 0; b < 3; ++b) {
+    if (!Encryption::setAESBackend(backends[b])) {
+      continue;
+    }
+
+    Encryption::AES256Context ctx;
+    Encryption::initAES256Context(&ctx, key);
+
+    for (int m = 0; m < 4; ++m) {
+      AESCallable fn(modes[m], &ctx, input.data(), output.data(), bufferSize);
+      BenchResult r = {"aes256-engine", std::string(Encryption::getAESBackendName(backends[b])) + "/" + modeNames[m],
+                       bufferSize, 0, 0, 0.0
+                      };
+      measure(fn, minSeconds, r.iterations, r.seconds);
+      printResult(r);
+      results.push_back(r);
+    }
+
+    Encryption::clearAES256Context(&ctx);
+  }
+
+  Encryption::setAESBackend(original);
+}
+
+// ============================================
+// TLS HANDSHAKE (LOOPBACK)
+// ============================================
+
+/**
+ * @brief Tek TLS ölçüm adımı: bağlan, 1 byte echo, kapat
+ *
+ * pool verilmişse bağlantı havuzdan alınıp geri verilir; aksi halde ctx ile
+ * bağlanılıp kapatılır. Bağlantı kurma (handshake) ve bağlantı başından
+ * ilk echo byte'ına kadar geçen süre (time-to-first-byte) ayrı biriktirilir.
+ * Echo, TLS 1.3 session ticket'larının da alınmasını sağlar.
+ */
+struct TLSCallable : BenchCallable {
+  TLS::TLSContext *ctx;
+  TLS::TLSConnectionPool *pool;
+  uint16_t port;
+  bool resumed;
+  uint64_t calls;
+  double handshakeSeconds;
+  double firstByteSeconds;
+
+  TLSCallable(TLS::TLSContext *c, TLS::TLSConnectionPool *p, uint16_t pt, bool r)
+    : ctx(c), pool(p), port(pt), resumed(r), calls(0), handshakeSeconds(0.0), firstByteSeconds(0.0) {}
+
+  bool operator()() {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    TLS::TLSContext *connection = ctx;
+
+    if (pool) {
+      if (TLS::acquireTLSConnection(pool, "localhost", port, &connection) != ErrorCode::Success) {
+        return false;
+      }
+    } else if (TLS::connectTLS(ctx, "localhost", port) != ErrorCode::Success ||
+               TLS::isTLSSessionResumed(ctx) != resumed) {
+      return false;
+    }
+
+    std::chrono::steady_clock::time_point connected = std::chrono::steady_clock::now();
+    uint8_t out = 0x5A;
+    uint8_t in = 0;
+    size_t sent = 0;
+    size_t received = 0;
+    bool ok = TLS::sendTLS(connection, &out, 1, sent) == ErrorCode::Success &&
+              TLS::receiveTLS(connection, &in, 1, received) == ErrorCode::Success && received == 1;
+    std::chrono::steady_clock::time_point firstByte = std::chrono::steady_clock::now();
+
+    if (pool) {
+      TLS::releaseTLSConnection(pool, connection, ok);
+    } else {
+      TLS::disconnectTLS(ctx);
+    }
+
+    ++calls;
+    handshakeSeconds += std::chrono::duration<double>(connected - start).count();
+    firstByteSeconds += std::chrono::duration<double>(firstByte - start).count();
+    return ok;
+  }
+};
+
+/**
+ * @brief Loopback TLS handshake ve time-to-first-byte ölçümleri
+ *
+ * Her mod için "handshake/<mod>" (bağlantı kurma) ve "ttfb/<mod>"
+ * (bağlanıp 1 byte echo alma) sonuçları üretilir; handshake/s = 1e9 / ns/op.
+ *
+ * @param minSeconds Ölçüm başına minimum süre
+ * @param results Sonuç listesi (eklenir)
+ * @return bool Ölçümler başarılı mı (OpenSSL yoksa true, atlanır)
+ */
+static bool runTLSBench(double minSeconds, std::vector<BenchResult> &results) {
+  TLS::TLSTestServer *server = nullptr;
+  TLS::TLSTestServerInfo info;
+  ErrorCode started = TLS::startTLSTestServer(".", &server, &info);
+
+  if (started == ErrorCode::ConnectionFailed) {
+    return true;
+  }
+
+  if (started != ErrorCode::Success) {
+    return false;
+  }
+
+  TLS::TLSContext ctx;
+  TLS::TLSConnectionPool *pool = nullptr;
+  bool ok = TLS::initializeTLSContext(&ctx) == ErrorCode::Success &&
+            TLS::setCAPath(&ctx, info.caCertPath) == ErrorCode::Success &&
+            TLS::createTLSConnectionPool(&ctx, 1, 0, &pool) == ErrorCode::Success;
+  const char *modes[3] = {"full", "resumed", "pooled"};
+
+  for (int m = 0; ok && m < 3; ++m) {
+    bool resumption = m != 0;
+    TLS::setTLSSessionResumption(&ctx, resumption);
+
+    // Devam ölçümünden önce önbelleğe oturum alınır
+    if (m == 1) {
+      TLSCallable prime(&ctx, nullptr, info.port, false);
+      ok = prime();
+    }
+
+    TLSCallable fn(&ctx, m == 2 ? pool : nullptr, info.port, resumption);
+    uint64_t iterations = 0;
+    double seconds = 0.0;
+
+    if (!ok || !measure(fn, minSeconds, iterations, seconds)) {
+      std::fprintf(stderr, "TLS olcumu basarisiz: %s\n", modes[m]);
+      ok = false;
+      break;
+    }
+
+    BenchResult handshake = {"tls", std::string("handshake/") + modes[m], 0, 0, fn.calls, fn.handshakeSeconds};
+    BenchResult firstByte = {"tls", std::string("ttfb/") + modes[m], 1, 0, fn.calls, fn.firstByteSeconds};
+    printResult(handshake);
+    printResult(firstByte);
+    results.push_back(handshake);
+    results.push_back(firstByte);
+  }
+
+  if (pool) {
+    TLS::destroyTLSConnectionPool(pool);
+  }
+
+  TLS::cleanupTLSContext(&ctx);
+  TLS::stopTLSTestServer(server);
+  std::remove(info.caCertPath);
+  return ok;
+}
+
+// ============================================
+// JSON ÇIKTISI
+// ============================================
+
+/**
+ * @brief Sonuçları JSON dosyasına yaz
+ *
+ * @param path Çıktı dosyası yolu
+ * @param results Sonuçlar
+ * @param minSeconds Ölçüm başına minimum süre
+ * @return bool Yazma başarılı mı
+ */
+static bool writeJSON(const char *path, const std::vector<BenchResult> &results, double minSeconds) {
+  FILE *file = std::fopen(path, "w");
+
+  if (!file) {
+    return false;
+  }
+
+  char timestamp[32] = "";
+  std::time_t now = std::time(nullptr);
+  std::tm *utc = std::gmtime(&now);
+
+  if (utc) {
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", utc);
+  }
+
+  std::fprintf(file, "{\n");
+  std::fprintf(file, "  \"benchmark\": \"travelexpense_bench\",\n");
+  std::fprintf(file, "  \"timestamp\": \"%s\",\n", timestamp);
+  std::fprintf(file, "  \"aes_backend\": \"%s\",\n", Encryption::getAESBackendName(Encryption::getAESBackend()));
+  std::fprintf(file, "  \"encryption_threads\": %u,\n", Encryption::getEncryptionThreadCount());
+  std::fprintf(file, "  \"min_time_s\": %.3f,\n", minSeconds);
+  std::fprintf(file, "  \"results\": [\n");
+
+  for (size_t i = 0; i < results.size(); ++i) {
+    const BenchResult &r = results[i];
+    std::fprintf(file,
+                 "    {\"group\": \"%s\", \"name\": \"%s\", \"bytes\": %zu, \"cost\": %u, "
+                 "\"iterations\": %llu, \"seconds\": %.6f, \"ns_per_op\": %.1f, \"mb_per_s\": %.3f}%s\n",
+                 r.group.c_str(), r.name.c_str(), r.bytes, r.cost,
+                 static_cast<unsigned long long>(r.iterations), r.seconds,
+                 resultNsPerOp(r), resultMBps(r), i + 1 < results.size() ? "," : "");
+  }
+
+  std::fprintf(file, "  ]\n}\n");
+  return std::fclose(file) == 0;
+}
+
+/**
+ * @brief Benchmark giriş noktası
+ *
+ * @param argc Argüman sayısı
+ * @param argv Argümanlar (bkz. dosya başlığı)
+ * @return int Çıkış kodu
+ */
+int main(int argc, char **argv) {
+  size_t aesBufferSize = 1u << 20; // Varsayılan: 1 MiB
+  size_t maxSize = 64u << 20;      // Varsayılan: 64 MiB
+  double minSeconds = 0.1;
+  const char *jsonPath = nullptr;
+  uint32_t passwordTargetMs = 0;
+
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (std::strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+      maxSize = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+    } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+      minSeconds = std::strtod(argv[++i], nullptr);
+    } else if (std::strcmp(argv[i], "--password-target-ms") == 0 && i + 1 < argc) {
+      passwordTargetMs = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+    } else {
+      aesBufferSize = static_cast<size_t>(std::strtoull(argv[i], nullptr, 10));
+    }
+  }
+
+  if (passwordTargetMs > 0) {
+    uint32_t iterations = Encryption::calibratePasswordHashIterations(passwordTargetMs);
+    std::printf("pbkdf2-sha256 kalibrasyonu: hedef %u ms -> %u iterasyon\n",
+                static_cast<unsigned>(passwordTargetMs), static_cast<unsigned>(iterations));
+    return 0;
+  }
+
+  aesBufferSize = (aesBufferSize / 16) * 16;
+
+  if (aesBufferSize == 0 || maxSize < 16) {
+    std::fprintf(stderr, "Gecersiz buffer boyutu\n");
+    return 1;
+  }
+
+  std::printf("travelexpense_bench (max mesaj: %zu byte, AES buffer: %zu byte, varsayilan arka uc: %s)\n",
+              maxSize, aesBufferSize, Encryption::getAESBackendName(Encryption::getAESBackend()));
+  std::printf("%-14s %-20s %10s %8s %14s %12s\n", "group", "name", "bytes", "cost", "ns/op", "MB/s");
+  std::vector<BenchResult> results;
+  bool ok = runCryptoSuite(maxSize, minSeconds, results);
+  runAESEngineBench(aesBufferSize, minSeconds, results);
+  ok = runTLSBench(minSeconds, results) && ok;
+
+  if (jsonPath && !writeJSON(jsonPath, results, minSeconds)) {
+    std::fprintf(stderr, "JSON yazilamadi: %s\n", jsonPath);
+    return 1;
+  }
+
+  return ok ? 0 : 1;
+}
@@ -44,6 +44,139 @@ namespace Encryption {
  */
 TRAVELEXPENSE_API bool sha256Hash(const void *input, size_t inputLen, char *output);
 
+/**
+ * @brief 256-bit özet (SHA-256 / HMAC-SHA256) ham byte değeri
+ *
+ * Modüller arası zincirlemede (HMAC, PBKDF2, imza, fingerprint -> anahtar)
+ * özetler bu tiple ikili olarak taşınır; hex gösterim yalnızca API
+ * sınırında encodeHex/decodeHex ile üretilir.
+ */
+struct Digest256 {
+  /** @brief Özet byte'ları (big-endian, standart SHA-256 çıktı sırası) */
+  uint8_t bytes[32];
+};
+
+/**
+ * @brief Artımlı SHA-256 bağlamı
+ *
+ * Veri parça parça sha256Update ile beslenebilir; heap ayırması yapılmaz.
+ * Bağlam kopyalanarak ara durum (midstate) yeniden kullanılabilir.
+ */
+struct SHA256Context {
+  /** @brief Zincirleme durum (H0..H7) */
+  uint32_t state[8];
+  /** @brief Tamamlanmamış blok */
+  uint8_t buffer[64];
+  /** @brief Buffer'daki byte sayısı */
+  size_t bufferLength;
+  /** @brief Toplam işlenen byte */
+  uint64_t totalLength;
+};
+
+/**
+ * @brief SHA-256 bağlamını başlat
+ *
+ * @param ctx Bağlam
+ */
+TRAVELEXPENSE_API void sha256Init(SHA256Context *ctx);
+
+/**
+ * @brief SHA-256 bağlamına veri ekle
+ *
+ * @param ctx Bağlam
+ * @param data Veri (length 0 ise nullptr olabilir)
+ * @param length Veri uzunluğu (byte)
+ */
+TRAVELEXPENSE_API void sha256Update(SHA256Context *ctx, const void *data, size_t length);
+
+/**
+ * @brief SHA-256 hesaplamasını bitir ve özeti üret
+ *
+ * Bağlam sonrasında güvenli şekilde silinir.
+ *
+ * @param ctx Bağlam
+ * @param digest Özet çıktısı
+ */
+TRAVELEXPENSE_API void sha256Final(SHA256Context *ctx, Digest256 &digest);
+
+/**
+ * @brief SHA-256 özetini ham byte olarak hesapla
+ *
+ * @param input Hash'lenecek veri
+ * @param inputLen Veri uzunluğu (byte, 0 ise false döner)
+ * @param digest Özet çıktısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool sha256Digest(const void *input, size_t inputLen, Digest256 &digest);
+
+/**
+ * @brief HMAC-SHA256 değerini ham byte olarak hesapla
+ *
+ * @param key HMAC anahtarı
+ * @param keyLen Anahtar uzunluğu (byte)
+ * @param message Mesaj
+ * @param messageLen Mesaj uzunluğu (byte)
+ * @param digest HMAC çıktısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool hmacSHA256Digest(const uint8_t *key, size_t keyLen,
+                                        const void *message, size_t messageLen,
+                                        Digest256 &digest);
+
+/**
+ * @brief HMAC-SHA256 için anahtara bağlı ara durumlar
+ *
+ * SHA256(K ^ ipad) ve SHA256(K ^ opad) bloklarının işlenmiş hali; aynı
+ * anahtarla yapılan her HMAC yalnızca mesaj ve dış blok için sıkıştırma yapar.
+ *
+ * @note Anahtar materyali içerir; iş bitince güvenli şekilde silinmelidir.
+ */
+struct HMACSHA256Midstate {
+  SHA256Context inner;  /**< @brief K ^ ipad işlenmiş bağlam */
+  SHA256Context outer;  /**< @brief K ^ opad işlenmiş bağlam */
+};
+
+/**
+ * @brief HMAC ara durumlarını hazırla
+ *
+ * 64 byte'tan uzun anahtarlar RFC 2104'e göre önce hash'lenir.
+ *
+ * @param key HMAC anahtarı
+ * @param keyLen Anahtar uzunluğu
+ * @param midstate Çıktı ara durumlar
+ */
+TRAVELEXPENSE_API void hmacSHA256Prepare(const uint8_t *key, size_t keyLen, HMACSHA256Midstate &midstate);
+
+/**
+ * @brief Hazır ara durumlarla HMAC-SHA256 hesapla
+ *
+ * @param midstate Anahtara bağlı ara durumlar (değişmez, thread'ler arasında paylaşılabilir)
+ * @param message Mesaj
+ * @param messageLen Mesaj uzunluğu
+ * @param digest HMAC çıktısı
+ */
+TRAVELEXPENSE_API void hmacSHA256WithMidstate(const HMACSHA256Midstate &midstate,
+    const void *message, size_t messageLen, Digest256 &digest);
+
+/**
+ * @brief Byte dizisini küçük harfli hex string'e çevir (tablo tabanlı)
+ *
+ * @param bytes Girdi byte'ları
+ * @param length Byte sayısı
+ * @param hex Çıktı (en az 2 * length + 1 byte, null ile sonlanır)
+ */
+TRAVELEXPENSE_API void encodeHex(const uint8_t *bytes, size_t length, char *hex);
+
+/**
+ * @brief Hex string'i byte dizisine çevir (büyük/küçük harf duyarsız)
+ *
+ * @param hex Girdi (en az 2 * length karakter)
+ * @param bytes Çıktı byte'ları
+ * @param length Üretilecek byte sayısı
+ * @return true Başarılı, false Geçersiz hex karakteri veya null pointer
+ */
+TRAVELEXPENSE_API bool decodeHex(const char *hex, uint8_t *bytes, size_t length);
+
 /**
  * @brief Salt oluştur (kriptografik olarak güvenli rastgele)
  *
@@ -52,7 +185,7 @@ TRAVELEXPENSE_API bool sha256Hash(const void *input, size_t inputLen, char *outp
  * kullanılır ve rainbow table saldırılarına karşı koruma sağlar.
  *
  * @note Bu fonksiyon, platform-specific güvenli rastgele sayı üreticisi kullanır
- * (Windows: CryptGenRandom, Linux: /dev/urandom).
+ * (thread başına tamponlanmış CTR-DRBG, bkz. generateRandomBytes).
  * Salt çıktısı, 64 karakter hex string formatında döndürülür.
  *
  * @param salt Salt çıktısı (64 karakter hex string + null terminator, nullptr ise false döner)
@@ -71,6 +204,7 @@ TRAVELEXPENSE_API bool generateSalt(char *salt);
  * @note Bu fonksiyon, şifreyi salt ile birleştirir ve SHA-256 ile hash'ler.
  * Format: SHA256(password + salt) veya SHA256(salt + password).
  * Hash çıktısı, 64 karakter hex string formatında döndürülür.
+ * Eski kayıt formatıdır; yeni kayıtlar için hashPasswordRecord() kullanılır.
  *
  * @param password Şifre (nullptr ise false döner)
  * @param salt Salt değeri (64 karakter hex string, nullptr ise false döner)
@@ -97,6 +231,85 @@ TRAVELEXPENSE_API bool hashPassword(const char *password, const char *salt, char
  */
 TRAVELEXPENSE_API bool verifyPassword(const char *password, const char *salt, const char *storedHash);
 
+// ============================================
+// SÜRÜMLÜ ŞİFRE HASH KAYDI (PBKDF2-HMAC-SHA256)
+// ============================================
+
+/** @brief Şifre hash kaydı buffer boyutu (null terminator dahil) */
+const size_t PASSWORD_HASH_RECORD_SIZE = 128;
+
+/** @brief Varsayılan PBKDF2 iterasyon sayısı */
+const uint32_t PASSWORD_HASH_DEFAULT_ITERATIONS = 100000;
+
+/** @brief Kabul edilen en düşük PBKDF2 iterasyon sayısı */
+const uint32_t PASSWORD_HASH_MIN_ITERATIONS = 1000;
+
+/** @brief Kabul edilen en yüksek PBKDF2 iterasyon sayısı */
+const uint32_t PASSWORD_HASH_MAX_ITERATIONS = 100000000;
+
+/**
+ * @brief Şifreyi sürümlü kayıt formatında hash'le
+ *
+ * Kayıt formatı: `$pbkdf2-sha256$<iterasyon>$<salt hex>$<özet hex>`.
+ * Algoritma kimliği ve maliyet parametresi kayıtla birlikte saklandığı için
+ * parametreler değiştiğinde eski kayıtlar doğrulanmaya devam eder.
+ *
+ * @param password Şifre (nullptr ise false döner)
+ * @param salt Salt değeri (hex string, 2-64 karakter; çözülmüş byte'lar PBKDF2 salt'ı olur)
+ * @param iterations PBKDF2 iterasyon sayısı (MIN..MAX aralığında olmalı)
+ * @param record Kayıt çıktısı (en az PASSWORD_HASH_RECORD_SIZE byte)
+ * @return true Başarılı, false Hata (geçersiz parametre)
+ */
+TRAVELEXPENSE_API bool hashPasswordRecord(const char *password, const char *salt,
+                                          uint32_t iterations, char *record);
+
+/**
+ * @brief Şifreyi saklanan hash kaydına göre doğrula
+ *
+ * Hem sürümlü PBKDF2 kayıtlarını hem de eski 64 karakterlik
+ * SHA256(password || salt) hash'lerini (legacySalt ile) doğrular.
+ * Karşılaştırma sabit zamanlıdır.
+ *
+ * @param password Girilen şifre
+ * @param record Saklanan kayıt (sürümlü kayıt veya eski 64 karakter hex)
+ * @param legacySalt Eski format için salt (sürümlü kayıtta kullanılmaz, nullptr olabilir)
+ * @param needsRehash Doğrulama başarılıysa, kaydın güncel parametrelerle yeniden
+ *                    hash'lenmesi gerekip gerekmediği (nullptr olabilir)
+ * @return true Şifre doğru, false Yanlış, bozuk kayıt veya hata
+ */
+TRAVELEXPENSE_API bool verifyPasswordRecord(const char *password, const char *record,
+                                            const char *legacySalt, bool *needsRehash);
+
+/**
+ * @brief Yeni kayıtlarda kullanılacak PBKDF2 iterasyon sayısını ayarla
+ *
+ * Değer [PASSWORD_HASH_MIN_ITERATIONS, PASSWORD_HASH_MAX_ITERATIONS]
+ * aralığına sıkıştırılır. Farklı iterasyonla saklanmış kayıtlar bir sonraki
+ * başarılı girişte yeniden hash'lenir.
+ *
+ * @param iterations İterasyon sayısı
+ */
+TRAVELEXPENSE_API void setPasswordHashIterations(uint32_t iterations);
+
+/**
+ * @brief Yeni kayıtlarda kullanılan PBKDF2 iterasyon sayısını al
+ *
+ * @return uint32_t İterasyon sayısı
+ */
+TRAVELEXPENSE_API uint32_t getPasswordHashIterations();
+
+/**
+ * @brief Hedef gecikmeye göre PBKDF2 iterasyon sayısını kalibre et
+ *
+ * Bu makinede PBKDF2 hızını ölçer, tek bir şifre hash'inin yaklaşık
+ * targetMs milisaniye sürmesi için gereken iterasyon sayısını hesaplar
+ * ve setPasswordHashIterations() ile uygular.
+ *
+ * @param targetMs Hedef hash süresi (milisaniye, 0 ise mevcut değer döner)
+ * @return uint32_t Uygulanan iterasyon sayısı
+ */
+TRAVELEXPENSE_API uint32_t calibratePasswordHashIterations(uint32_t targetMs);
+
 /**
  * @brief AES-256 ile veri şifreleme (basit implementasyon - başlangıç)
  *
@@ -127,6 +340,533 @@ TRAVELEXPENSE_API bool decryptAES256(const void *ciphertext, size_t ciphertextLe
                                      const uint8_t *key, const uint8_t *iv,
                                      void *plaintext, size_t &plaintextLen);
 
+// ============================================
+// AES-256 MOTORU (ÖNBELLEKLİ ANAHTAR TAKVİMİ)
+// ============================================
+
+/**
+ * @brief AES blok şifreleme arka ucu (backend)
+ *
+ * Çalışma zamanında CPU özelliklerine göre seçilen AES implementasyonu.
+ */
+enum class AESBackend {
+  Portable = 0, /**< @brief Taşınabilir T-table implementasyonu (cache-line sabit erişimli) */
+  AESNI = 1,    /**< @brief x86 AES-NI komutları (128-bit, 8 blok paralel) */
+  VAES = 2      /**< @brief x86 VAES + AVX2 komutları (256-bit, 2x4 blok paralel) */
+};
+
+/**
+ * @brief AES-256 motor bağlamı (genişletilmiş anahtar takvimi)
+ *
+ * Anahtar takvimi (key schedule) bir kez genişletilir ve bağlam içinde saklanır.
+ * Aynı anahtarla yapılan tüm blok işlemleri bu bağlamı yeniden kullanır.
+ *
+ * @note Bağlam gizli anahtar materyali içerir. İşlem bitince
+ * clearAES256Context() ile güvenli şekilde silinmelidir.
+ */
+struct AES256Context {
+  /** @brief Şifreleme round key'leri (15 round * 16 byte, FIPS-197 byte sırası) */
+  alignas(16) uint8_t encRoundKeys[240];
+  /** @brief Şifre çözme round key'leri (ters sırada, InvMixColumns uygulanmış) */
+  alignas(16) uint8_t decRoundKeys[240];
+  /** @brief Şifreleme round key'leri (big-endian 32-bit word, T-table yolu için) */
+  uint32_t encKeyWords[60];
+  /** @brief Şifre çözme round key'leri (big-endian 32-bit word, T-table yolu için) */
+  uint32_t decKeyWords[60];
+  /** @brief Bağlam başlatılırken seçilen arka uç */
+  AESBackend backend;
+  /** @brief Bağlam başlatıldı mı? */
+  bool isInitialized;
+};
+
+/**
+ * @brief AES-256 bağlamını başlat (anahtar takvimini genişlet)
+ *
+ * FIPS-197 uyumlu AES-256 anahtar genişletmesini yapar ve aktif arka ucu
+ * (getAESBackend()) bağlama kaydeder.
+ *
+ * @param ctx AES bağlamı (çıktı, nullptr ise false döner)
+ * @param key AES-256 anahtarı (32 byte, nullptr ise false döner)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool initAES256Context(AES256Context *ctx, const uint8_t *key);
+
+/**
+ * @brief AES-256 bağlamını güvenli şekilde temizle
+ *
+ * Round key'lerin tamamını sıfırlar ve bağlamı başlatılmamış duruma getirir.
+ *
+ * @param ctx AES bağlamı (nullptr ise işlem yapılmaz)
+ */
+TRAVELEXPENSE_API void clearAES256Context(AES256Context *ctx);
+
+/**
+ * @brief Önbelleklenmiş AES anahtar takvimlerini sil
+ *
+ * encryptAES256/decryptAES256 ve türevleri son kullanılan anahtarı ve
+ * takvimini thread başına saklar. Çağıran thread'in önbelleği hemen, diğer
+ * thread'lerinki bir sonraki AES çağrısında silinir; her thread'in önbelleği
+ * thread sonlanınca da silinir. Oturum kapanışında ve çıkışta çağrılır.
+ */
+TRAVELEXPENSE_API void clearAES256KeyCache();
+
+/**
+ * @brief Birden fazla bloğu AES-256 ile şifrele (ECB, ham blok işlemi)
+ *
+ * @note Bu fonksiyon mod içermeyen ham blok işlemidir; CBC/CTR gibi modlar
+ * bunun üzerine kurulur. input ve output aynı buffer olabilir.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param input Girdi blokları (blockCount * 16 byte)
+ * @param output Çıktı blokları (blockCount * 16 byte)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata (null pointer, başlatılmamış bağlam)
+ */
+TRAVELEXPENSE_API bool aes256EncryptBlocks(const AES256Context *ctx, const uint8_t *input,
+    uint8_t *output, size_t blockCount);
+
+/**
+ * @brief Birden fazla bloğun AES-256 şifresini çöz (ECB, ham blok işlemi)
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param input Şifreli bloklar (blockCount * 16 byte)
+ * @param output Çözülmüş bloklar (blockCount * 16 byte, input ile aynı olabilir)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata (null pointer, başlatılmamış bağlam)
+ */
+TRAVELEXPENSE_API bool aes256DecryptBlocks(const AES256Context *ctx, const uint8_t *input,
+    uint8_t *output, size_t blockCount);
+
+/**
+ * @brief AES-256-CBC şifreleme (padding olmadan, tam bloklar)
+ *
+ * @note iv parametresi işlem sonunda son şifreli blok ile güncellenir;
+ * böylece ardışık çağrılar tek bir CBC akışı gibi zincirlenebilir.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param iv Zincirleme değeri (16 byte, girdi/çıktı)
+ * @param input Düz metin blokları (blockCount * 16 byte)
+ * @param output Şifreli bloklar (blockCount * 16 byte, input ile aynı olabilir)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool aes256EncryptCBC(const AES256Context *ctx, uint8_t *iv,
+                                        const uint8_t *input, uint8_t *output, size_t blockCount);
+
+/**
+ * @brief AES-256-CBC şifre çözme (padding kontrolü olmadan, tam bloklar)
+ *
+ * Şifre çözme blokları birbirinden bağımsız olduğundan donanım arka uçlarında
+ * 8 blok paralel işlenir.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param iv Zincirleme değeri (16 byte, girdi/çıktı; son şifreli blok ile güncellenir)
+ * @param input Şifreli bloklar (blockCount * 16 byte)
+ * @param output Düz metin blokları (blockCount * 16 byte, input ile aynı olabilir)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool aes256DecryptCBC(const AES256Context *ctx, uint8_t *iv,
+                                        const uint8_t *input, uint8_t *output, size_t blockCount);
+
+/**
+ * @brief AES-256-CBC şifreleme, PKCS7 padding ile (bağlam ile)
+ *
+ * encryptAES256 ile aynı çıktıyı üretir; anahtar takvimi çağıranın
+ * bağlamından kullanılır.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param iv Initialization Vector (16 byte, değiştirilmez)
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu (0 olamaz)
+ * @param ciphertext Çıktı (en az (plaintextLen / 16 + 1) * 16 byte)
+ * @param ciphertextLen Şifreli veri uzunluğu (çıktı, padding dahil)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool aes256EncryptCBCPadded(const AES256Context *ctx, const uint8_t *iv,
+    const void *plaintext, size_t plaintextLen,
+    void *ciphertext, size_t &ciphertextLen);
+
+/**
+ * @brief AES-256-CBC şifre çözme, PKCS7 padding kontrolü ile (bağlam ile)
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param iv Initialization Vector (16 byte, değiştirilmez)
+ * @param ciphertext Şifreli veri (16'nın katı)
+ * @param ciphertextLen Şifreli veri uzunluğu
+ * @param plaintext Çıktı (en az ciphertextLen byte; padding hatasında sıfırlanır)
+ * @param plaintextLen Düz metin uzunluğu (çıktı, padding olmadan)
+ * @return true Başarılı, false Hata (geçersiz uzunluk, padding hatası)
+ */
+TRAVELEXPENSE_API bool aes256DecryptCBCPadded(const AES256Context *ctx, const uint8_t *iv,
+    const void *ciphertext, size_t ciphertextLen,
+    void *plaintext, size_t &plaintextLen);
+
+/**
+ * @brief Aktif AES arka ucunu al
+ *
+ * İlk çağrıda CPU özellikleri (CPUID) okunur ve desteklenen en hızlı arka uç seçilir.
+ *
+ * @return AESBackend Aktif arka uç
+ */
+TRAVELEXPENSE_API AESBackend getAESBackend();
+
+/**
+ * @brief AES arka ucunu zorla (test ve benchmark için)
+ *
+ * @note Yalnızca sonradan başlatılan bağlamları etkiler.
+ *
+ * @param backend İstenen arka uç
+ * @return true Ayarlandı, false CPU bu arka ucu desteklemiyor
+ */
+TRAVELEXPENSE_API bool setAESBackend(AESBackend backend);
+
+/**
+ * @brief CPU'nun belirtilen arka ucu destekleyip desteklemediğini kontrol et
+ *
+ * @param backend Kontrol edilecek arka uç
+ * @return true Destekleniyor, false Desteklenmiyor
+ */
+TRAVELEXPENSE_API bool isAESBackendSupported(AESBackend backend);
+
+/**
+ * @brief AES arka uç adını al
+ *
+ * @param backend Arka uç
+ * @return const char* Arka uç adı ("portable", "aesni", "vaes")
+ */
+TRAVELEXPENSE_API const char *getAESBackendName(AESBackend backend);
+
+// ============================================
+// AES-256-CTR / AES-256-GCM (PARALEL MODLAR)
+// ============================================
+
+/** @brief AES-GCM nonce (IV) uzunluğu (96 bit, NIST SP 800-38D önerisi) */
+const size_t AES_GCM_IV_SIZE = 12;
+
+/** @brief AES-GCM kimlik doğrulama etiketi (tag) uzunluğu */
+const size_t AES_GCM_TAG_SIZE = 16;
+
+/**
+ * @brief Büyük buffer'lar için kullanılacak thread sayısını ayarla
+ *
+ * CTR ve GCM modlarında bloklar birbirinden bağımsız olduğundan büyük
+ * buffer'lar parçalara (chunk) bölünüp paralel işlenir. Her thread en az
+ * 256 KiB veri alır; daha küçük buffer'lar tek thread'de işlenir.
+ *
+ * @param threadCount Thread sayısı (0 = donanım thread sayısı, 1 = paralel işleme kapalı)
+ */
+TRAVELEXPENSE_API void setEncryptionThreadCount(unsigned threadCount);
+
+/**
+ * @brief Aktif thread sayısını al
+ *
+ * @return unsigned Kullanılacak thread sayısı (en az 1)
+ */
+TRAVELEXPENSE_API unsigned getEncryptionThreadCount();
+
+/**
+ * @brief AES-256-CTR ile veri şifrele/çöz (bağlam ile)
+ *
+ * Sayaç (counter) bloklarını 8'erli gruplar halinde AES motorundan geçirerek
+ * anahtar akışı (keystream) üretir ve veriyle XOR'lar. Şifreleme ve şifre
+ * çözme aynı işlemdir. Sayaç 128-bit big-endian olarak artırılır.
+ *
+ * @note counter işlem sonunda tüketilen blok sayısı kadar ilerletilir;
+ * length 16'nın katı olduğu sürece ardışık çağrılar tek bir akış gibi
+ * zincirlenebilir. input ve output aynı buffer olabilir.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param counter Başlangıç sayaç bloğu (16 byte, girdi/çıktı)
+ * @param input Girdi verisi
+ * @param output Çıktı verisi (length byte)
+ * @param length Veri uzunluğu (byte, 0 ise false döner)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool aes256CryptCTR(const AES256Context *ctx, uint8_t *counter,
+                                      const uint8_t *input, uint8_t *output, size_t length);
+
+/**
+ * @brief AES-256-CTR ile veri şifreleme
+ *
+ * @note CTR modunda padding yoktur; şifreli veri düz metinle aynı uzunluktadır.
+ * Aynı anahtar ile aynı başlangıç sayacı asla tekrar kullanılmamalıdır.
+ *
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu (byte)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Başlangıç sayaç bloğu (16 byte)
+ * @param ciphertext Şifrelenmiş veri çıktısı (plaintextLen byte)
+ * @return true Başarılı, false Hata (null pointer, sıfır uzunluk vb.)
+ */
+TRAVELEXPENSE_API bool encryptAES256CTR(const void *plaintext, size_t plaintextLen,
+                                        const uint8_t *key, const uint8_t *iv,
+                                        void *ciphertext);
+
+/**
+ * @brief AES-256-CTR ile şifre çözme
+ *
+ * @param ciphertext Şifrelenmiş veri
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu (byte)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Başlangıç sayaç bloğu (16 byte)
+ * @param plaintext Şifre çözülmüş veri çıktısı (ciphertextLen byte)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool decryptAES256CTR(const void *ciphertext, size_t ciphertextLen,
+                                        const uint8_t *key, const uint8_t *iv,
+                                        void *plaintext);
+
+/**
+ * @brief AES-256-GCM ile kimlik doğrulamalı şifreleme (bağlam ile)
+ *
+ * CTR şifreleme ve GHASH kimlik doğrulaması veri üzerinden tek geçişte yapılır.
+ * GHASH, CPU destekliyorsa PCLMULQDQ ile 4 blok birleşik (aggregated)
+ * hesaplanır; aksi halde sabit zamanlı taşınabilir çarpım kullanılır.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param iv Nonce (AES_GCM_IV_SIZE = 12 byte, anahtar başına benzersiz olmalı)
+ * @param aad Ek doğrulanan veri (şifrelenmez, nullptr olabilir)
+ * @param aadLen Ek veri uzunluğu
+ * @param plaintext Şifrelenecek veri (plaintextLen 0 ise nullptr olabilir)
+ * @param plaintextLen Veri uzunluğu (byte)
+ * @param ciphertext Şifrelenmiş veri çıktısı (plaintextLen byte, plaintext ile aynı olabilir)
+ * @param tag Kimlik doğrulama etiketi çıktısı (AES_GCM_TAG_SIZE = 16 byte)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool aes256EncryptGCM(const AES256Context *ctx, const uint8_t *iv,
+                                        const void *aad, size_t aadLen,
+                                        const void *plaintext, size_t plaintextLen,
+                                        void *ciphertext, uint8_t *tag);
+
+/**
+ * @brief AES-256-GCM ile kimlik doğrulamalı şifre çözme (bağlam ile)
+ *
+ * @note Etiket doğrulanamazsa çıktı buffer'ı sıfırlanır ve false döner;
+ * doğrulanmamış düz metin çağırana bırakılmaz.
+ *
+ * @param ctx Başlatılmış AES bağlamı
+ * @param iv Nonce (12 byte)
+ * @param aad Ek doğrulanan veri (nullptr olabilir)
+ * @param aadLen Ek veri uzunluğu
+ * @param ciphertext Şifrelenmiş veri
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu (byte)
+ * @param tag Beklenen kimlik doğrulama etiketi (16 byte)
+ * @param plaintext Şifre çözülmüş veri çıktısı (ciphertextLen byte)
+ * @return true Başarılı ve etiket geçerli, false Hata veya etiket uyuşmazlığı
+ */
+TRAVELEXPENSE_API bool aes256DecryptGCM(const AES256Context *ctx, const uint8_t *iv,
+                                        const void *aad, size_t aadLen,
+                                        const void *ciphertext, size_t ciphertextLen,
+                                        const uint8_t *tag, void *plaintext);
+
+/**
+ * @brief AES-256-GCM ile kimlik doğrulamalı şifreleme
+ *
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu (byte)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Nonce (12 byte)
+ * @param aad Ek doğrulanan veri (nullptr olabilir)
+ * @param aadLen Ek veri uzunluğu
+ * @param ciphertext Şifrelenmiş veri çıktısı (plaintextLen byte)
+ * @param tag Kimlik doğrulama etiketi çıktısı (16 byte)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool encryptAES256GCM(const void *plaintext, size_t plaintextLen,
+                                        const uint8_t *key, const uint8_t *iv,
+                                        const void *aad, size_t aadLen,
+                                        void *ciphertext, uint8_t *tag);
+
+/**
+ * @brief AES-256-GCM ile kimlik doğrulamalı şifre çözme
+ *
+ * @param ciphertext Şifrelenmiş veri
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu (byte)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Nonce (12 byte)
+ * @param aad Ek doğrulanan veri (nullptr olabilir)
+ * @param aadLen Ek veri uzunluğu
+ * @param tag Beklenen kimlik doğrulama etiketi (16 byte)
+ * @param plaintext Şifre çözülmüş veri çıktısı (ciphertextLen byte)
+ * @return true Başarılı ve etiket geçerli, false Hata veya etiket uyuşmazlığı
+ */
+TRAVELEXPENSE_API bool decryptAES256GCM(const void *ciphertext, size_t ciphertextLen,
+                                        const uint8_t *key, const uint8_t *iv,
+                                        const void *aad, size_t aadLen,
+                                        const uint8_t *tag, void *plaintext);
+
+// ============================================
+// YERİNDE VE SCATTER/GATHER ŞİFRELEME
+// ============================================
+
+/**
+ * @brief Bellek parçası tanımı (POSIX iovec benzeri)
+ *
+ * Birden fazla alandan oluşan veriyi ara buffer'a kopyalamadan şifrelemek
+ * (gather) veya çözülmüş veriyi birden fazla hedefe dağıtmak (scatter) için
+ * kullanılır. Girdi olarak kullanıldığında base'e yazılmaz.
+ */
+struct IOVec {
+  void *base;    /**< @brief Parçanın başlangıç adresi */
+  size_t length; /**< @brief Parça uzunluğu (byte) */
+};
+
+/**
+ * @brief AES-256-CBC ile yerinde şifreleme
+ *
+ * Veri, çağıranın sağladığı buffer içinde şifrelenir; PKCS7 padding için
+ * buffer sonunda boş alan bulunmalıdır. Heap ayırma ve kopyalama yapılmaz.
+ *
+ * @param buffer Düz metin (girdi) / şifreli metin (çıktı)
+ * @param dataLen Düz metin uzunluğu
+ * @param bufferCapacity Buffer kapasitesi (en az (dataLen / 16 + 1) * 16)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv IV (16 byte)
+ * @param ciphertextLen Şifreli metin uzunluğu (çıktı)
+ * @return true Başarılı, false Hata (yetersiz kapasite vb.)
+ */
+TRAVELEXPENSE_API bool encryptAES256InPlace(void *buffer, size_t dataLen, size_t bufferCapacity,
+    const uint8_t *key, const uint8_t *iv,
+    size_t &ciphertextLen);
+
+/**
+ * @brief AES-256-CBC ile yerinde şifre çözme
+ *
+ * @param buffer Şifreli metin (girdi) / düz metin (çıktı)
+ * @param ciphertextLen Şifreli metin uzunluğu (16'nın katı)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv IV (16 byte)
+ * @param plaintextLen Düz metin uzunluğu (çıktı, padding olmadan)
+ * @return true Başarılı, false Hata (geçersiz padding vb.)
+ */
+TRAVELEXPENSE_API bool decryptAES256InPlace(void *buffer, size_t ciphertextLen,
+    const uint8_t *key, const uint8_t *iv,
+    size_t &plaintextLen);
+
+/**
+ * @brief Birden fazla parçayı tek bir AES-256-CBC şifreli metne dönüştür (gather)
+ *
+ * Parçalar mantıksal olarak art arda eklenmiş gibi şifrelenir; sonuç,
+ * birleştirilmiş veriye encryptAES256 uygulanmasıyla aynıdır. Blok sınırına
+ * denk gelmeyen parça geçişleri için yalnızca 16 byte'lık yığın bloğu kullanılır.
+ *
+ * @param iov Girdi parçaları
+ * @param iovCount Parça sayısı
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv IV (16 byte)
+ * @param ciphertext Şifreli metin çıktısı (en az (toplam / 16 + 1) * 16 byte)
+ * @param ciphertextLen Şifreli metin uzunluğu (çıktı)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool encryptAES256Gather(const IOVec *iov, size_t iovCount,
+    const uint8_t *key, const uint8_t *iv,
+    void *ciphertext, size_t &ciphertextLen);
+
+/**
+ * @brief AES-256-CBC şifreli metni birden fazla hedefe çöz (scatter)
+ *
+ * Padding önce son blok üzerinden doğrulanır, ardından düz metin parçalara
+ * sırayla dağıtılır. Parçaların toplam kapasitesi düz metin uzunluğu kadar
+ * olmalıdır.
+ *
+ * @param ciphertext Şifreli metin
+ * @param ciphertextLen Şifreli metin uzunluğu (16'nın katı)
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv IV (16 byte)
+ * @param iov Çıktı parçaları
+ * @param iovCount Parça sayısı
+ * @param plaintextLen Düz metin uzunluğu (çıktı)
+ * @return true Başarılı, false Hata (geçersiz padding, yetersiz kapasite vb.)
+ */
+TRAVELEXPENSE_API bool decryptAES256Scatter(const void *ciphertext, size_t ciphertextLen,
+    const uint8_t *key, const uint8_t *iv,
+    const IOVec *iov, size_t iovCount,
+    size_t &plaintextLen);
+
+/**
+ * @brief Birden fazla parçayı AES-256-GCM ile tek geçişte şifrele (gather)
+ *
+ * Sonuç, birleştirilmiş veriye encryptAES256GCM uygulanmasıyla aynıdır.
+ * Şifreli metin yerinde de üretilebilir (CTR tabanlı olduğu için padding yok).
+ *
+ * @param iov Girdi parçaları
+ * @param iovCount Parça sayısı
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Nonce (12 byte)
+ * @param aad Ek doğrulanan veri (nullptr olabilir)
+ * @param aadLen Ek veri uzunluğu
+ * @param ciphertext Şifreli metin çıktısı (parçaların toplam uzunluğu kadar)
+ * @param tag Doğrulama etiketi çıktısı (16 byte)
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool encryptAES256GCMGather(const IOVec *iov, size_t iovCount,
+    const uint8_t *key, const uint8_t *iv,
+    const void *aad, size_t aadLen,
+    void *ciphertext, uint8_t *tag);
+
+/**
+ * @brief AES-256-GCM şifreli metni doğrulayarak birden fazla hedefe çöz (scatter)
+ *
+ * Etiket doğrulanamazsa hedef parçalara yazılan veri silinir.
+ *
+ * @param ciphertext Şifreli metin
+ * @param ciphertextLen Şifreli metin uzunluğu
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Nonce (12 byte)
+ * @param aad Ek doğrulanan veri (nullptr olabilir)
+ * @param aadLen Ek veri uzunluğu
+ * @param tag Beklenen etiket (16 byte)
+ * @param iov Çıktı parçaları (toplam uzunluk ciphertextLen olmalı)
+ * @param iovCount Parça sayısı
+ * @return true Başarılı ve doğrulandı, false Hata veya etiket uyuşmazlığı
+ */
+TRAVELEXPENSE_API bool decryptAES256GCMScatter(const void *ciphertext, size_t ciphertextLen,
+    const uint8_t *key, const uint8_t *iv,
+    const void *aad, size_t aadLen,
+    const uint8_t *tag,
+    const IOVec *iov, size_t iovCount);
+
+// ============================================
+// SHA-256 ÇOKLU BUFFER (MULTI-BUFFER)
+// ============================================
+
+/**
+ * @brief Çoklu buffer SHA-256'nın aynı anda işlediği mesaj sayısı
+ *
+ * @return size_t AVX2 destekleniyorsa 8, aksi halde 1 (sıralı işleme)
+ */
+TRAVELEXPENSE_API size_t getSHA256MultiBufferLanes();
+
+/**
+ * @brief Birden fazla bağımsız mesajın SHA-256 özetini hesapla
+ *
+ * Mesajlar SIMD kanallarına dağıtılır ve aynı komutlarla birlikte
+ * sıkıştırılır; biten kanala sıradaki mesaj yüklenir. Sonuçlar
+ * sha256Digest ile birebir aynıdır.
+ *
+ * @param messages Mesajlar (girdi olarak kullanılır)
+ * @param count Mesaj sayısı
+ * @param digests Özet çıktıları (count adet)
+ * @return true Başarılı, false Geçersiz parametre
+ */
+TRAVELEXPENSE_API bool sha256DigestMany(const IOVec *messages, size_t count, Digest256 *digests);
+
+/**
+ * @brief Aynı anahtarla birden fazla mesajın HMAC-SHA256 değerini hesapla
+ *
+ * İç ve dış hash'ler sha256DigestMany ile aynı çoklu buffer yolundan
+ * geçer; anahtar blokları hazır ara durumlardan alınır.
+ *
+ * @param midstate hmacSHA256Prepare çıktısı
+ * @param messages Mesajlar
+ * @param count Mesaj sayısı
+ * @param digests HMAC çıktıları (count adet)
+ * @return true Başarılı, false Geçersiz parametre
+ */
+TRAVELEXPENSE_API bool hmacSHA256ManyWithMidstate(const HMACSHA256Midstate &midstate,
+    const IOVec *messages, size_t count, Digest256 *digests);
+
 /**
  * @brief HMAC-SHA256 hesapla (Message Authentication Code)
  *
@@ -161,12 +901,24 @@ TRAVELEXPENSE_API bool pbkdf2(const char *password, size_t passwordLen,
 /**
  * @brief Güvenli rastgele byte dizisi oluştur
  *
+ * Thread başına tamponlanmış, sistem entropisiyle tohumlanan AES-256
+ * CTR-DRBG kullanır; küçük istekler sistem çağrısı yapmadan karşılanır.
+ * Havuz periyodik olarak ve fork() sonrasında yeniden tohumlanır.
+ *
  * @param output Çıktı buffer'ı
  * @param length İstenen uzunluk (byte)
  * @return true Başarılı, false Hata
  */
 TRAVELEXPENSE_API bool generateRandomBytes(uint8_t *output, size_t length);
 
+/**
+ * @brief Tüm thread'lerin rastgele havuzlarını yeniden tohumlamaya zorla
+ *
+ * Her thread, bir sonraki generateRandomBytes çağrısında işletim sisteminden
+ * taze entropi okur ve buffer'daki kullanılmamış byte'ları atar.
+ */
+TRAVELEXPENSE_API void reseedRandomPool();
+
 /**
  * @brief IV (Initialization Vector) oluştur (16 byte - AES block size)
  *
@@ -188,6 +940,9 @@ TRAVELEXPENSE_API bool constantTimeCompare(const char *a, const char *b, size_t
 /**
  * @brief Dosyayı AES-256-CBC ile şifrele
  *
+ * Dosya 1 MiB'lık parçalar halinde işlenir; bellek kullanımı dosya
+ * boyutundan bağımsızdır. Çıktı formatı: [IV (16 byte)][Ciphertext (padded)]
+ *
  * @param inputFile Giriş dosya yolu
  * @param outputFile Çıkış dosya yolu
  * @param key Şifreleme anahtarı (32 byte)
@@ -209,6 +964,32 @@ TRAVELEXPENSE_API bool encryptFile(const char *inputFile, const char *outputFile
 TRAVELEXPENSE_API bool decryptFile(const char *inputFile, const char *outputFile,
                                    const uint8_t *key, const uint8_t *iv = nullptr);
 
+/**
+ * @brief Dosyayı AES-256-CTR ile şifrele (parçalı akış)
+ *
+ * Padding yoktur; çıktı formatı: [Başlangıç sayacı (16 byte)][Ciphertext]
+ *
+ * @param inputFile Giriş dosya yolu
+ * @param outputFile Çıkış dosya yolu
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Başlangıç sayacı (16 byte), nullptr ise otomatik oluşturulur
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool encryptFileCTR(const char *inputFile, const char *outputFile,
+                                      const uint8_t *key, const uint8_t *iv = nullptr);
+
+/**
+ * @brief AES-256-CTR ile şifrelenmiş dosyayı çöz (parçalı akış)
+ *
+ * @param inputFile Şifrelenmiş dosya yolu
+ * @param outputFile Çözülmüş dosya yolu
+ * @param key Şifreleme anahtarı (32 byte)
+ * @param iv Başlangıç sayacı (16 byte), nullptr ise dosyadan okunur
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool decryptFileCTR(const char *inputFile, const char *outputFile,
+                                      const uint8_t *key, const uint8_t *iv = nullptr);
+
 /**
  * @brief Whitebox DES ile veri şifreleme
  *
@@ -237,6 +1018,30 @@ TRAVELEXPENSE_API bool encryptWhiteboxDES(const void *plaintext, size_t plaintex
 TRAVELEXPENSE_API bool decryptWhiteboxDES(const void *ciphertext, size_t ciphertextLen,
     void *plaintext, size_t &plaintextLen);
 
+/**
+ * @brief Whitebox DES ile çok bloklu şifreleme (padding yok)
+ *
+ * Tablolar ilk çağrıda bir kez (thread-safe) oluşturulur. 64 bloklu gruplar
+ * bitslice olarak (CPU AVX2 destekliyorsa 256 bloklu gruplar), kalan bloklar
+ * birleşik SP tablolarıyla işlenir. Yerinde çalışma desteklenir.
+ *
+ * @param input Girdi blokları (blockCount * 8 byte)
+ * @param output Çıktı blokları (blockCount * 8 byte)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool encryptWhiteboxDESBlocks(const void *input, void *output, size_t blockCount);
+
+/**
+ * @brief Whitebox DES ile çok bloklu şifre çözme (padding yok)
+ *
+ * @param input Şifreli bloklar (blockCount * 8 byte)
+ * @param output Çözülmüş bloklar (blockCount * 8 byte)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool decryptWhiteboxDESBlocks(const void *input, void *output, size_t blockCount);
+
 /**
  * @brief Dosyayı Whitebox DES ile şifrele
  *
@@ -288,6 +1093,29 @@ TRAVELEXPENSE_API bool encryptWhiteboxAES(const void *plaintext, size_t plaintex
 TRAVELEXPENSE_API bool decryptWhiteboxAES(const void *ciphertext, size_t ciphertextLen,
     void *plaintext, size_t &plaintextLen);
 
+/**
+ * @brief Whitebox AES ile çok bloklu şifreleme (padding yok)
+ *
+ * Whitebox tabloları ilk çağrıda bir kez (thread-safe) oluşturulur; her blok
+ * yalnızca tablo okumalarıyla işlenir. Yerinde çalışma desteklenir.
+ *
+ * @param input Girdi blokları (blockCount * 16 byte)
+ * @param output Çıktı blokları (blockCount * 16 byte)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool encryptWhiteboxAESBlocks(const void *input, void *output, size_t blockCount);
+
+/**
+ * @brief Whitebox AES ile çok bloklu şifre çözme (padding yok)
+ *
+ * @param input Şifreli bloklar (blockCount * 16 byte)
+ * @param output Çözülmüş bloklar (blockCount * 16 byte)
+ * @param blockCount Blok sayısı
+ * @return true Başarılı, false Hata
+ */
+TRAVELEXPENSE_API bool decryptWhiteboxAESBlocks(const void *input, void *output, size_t blockCount);
+
 /**
  * @brief Dosyayı Whitebox AES ile şifrele
  *
@@ -36,6 +36,7 @@ enum class ErrorCode {
   EncryptionFailed = 9,     /**< @brief Şifreleme işlemi başarısız */
   ConnectionFailed = 10,   /**< @brief Bağlantı hatası */
   SecurityFailed = 11,     /**< @brief Güvenlik kontrolü başarısız */
+  Busy = 12,               /**< @brief Kaynak meşgul (kuyruk dolu) veya engellemeyen G/Ç beklemede, daha sonra tekrar denenmeli */
 
   Unknown = 99             /**< @brief Bilinmeyen hata */
 };
@@ -28,6 +28,10 @@ namespace TravelExpense { // LCOV_EXCL_LINE
  * Bu modül, cihaz ve uygulama fingerprint'lerinin oluşturulması,
  * doğrulanması ve dinamik anahtar yönetimi işlemlerini sağlar.
  * Dinamik varlıkların korunması gereksinimlerini karşılar.
+ *
+ * Fingerprint'ler ve onlardan türetilen anahtarlar süreç genelinde bir
+ * kez hesaplanıp saklanır; doğrulama çağrıları yalnızca karşılaştırma
+ * maliyetindedir (bkz. refreshFingerprints()).
  */
 namespace Fingerprinting {
 
@@ -103,10 +107,10 @@ TRAVELEXPENSE_API ErrorCode generateCombinedFingerprint(char *fingerprint);
  * Cihaz ve uygulama fingerprint'lerini kullanarak dinamik bir anahtar oluşturur.
  * Bu anahtar, cihaz ve uygulama bazlı şifreleme için kullanılabilir.
  *
- * @param fingerprint Cihaz veya uygulama fingerprint'i
+ * @param fingerprint Cihaz veya uygulama fingerprint'i (64 karakter hex)
  * @param key Dinamik anahtar çıktısı (32 byte)
  * @param keyLen Anahtar uzunluğu (32)
- * @return ErrorCode Başarı durumu
+ * @return ErrorCode Başarı durumu (fingerprint hex değilse InvalidInput)
  */
 TRAVELEXPENSE_API ErrorCode generateDynamicKey(const char *fingerprint,
     uint8_t *key, size_t keyLen);
@@ -145,6 +149,76 @@ TRAVELEXPENSE_API ErrorCode generateApplicationBasedKey(uint8_t *key, size_t key
  */
 TRAVELEXPENSE_API ErrorCode generateCombinedKey(uint8_t *key, size_t keyLen);
 
+// ============================================
+// FİNGERPRİNT ÖNBELLEĞİ
+// ============================================
+
+/**
+ * @struct FingerprintCacheStats
+ * @brief Fingerprint önbelleğinin anlık metrikleri
+ */
+struct FingerprintCacheStats {
+  uint64_t generation;      /**< @brief Geçersiz kılma sayacı */
+  uint64_t computations;    /**< @brief Fingerprint hesaplama sayısı */
+  uint64_t keyDerivations;  /**< @brief Anahtar türetme (PBKDF2) sayısı */
+  uint64_t hits;            /**< @brief Önbellekten dönen istek sayısı */
+  bool monitorRunning;      /**< @brief Ağ değişikliği dinleyicisi çalışıyor mu */
+};
+
+/**
+ * @brief Fingerprint'leri yeniden hesapla
+ *
+ * Cihaz, uygulama ve birleşik fingerprint'ler ilk kullanımda bir kez
+ * hesaplanır ve süreç boyunca saklanır; generate*Fingerprint() ve
+ * generate*Key() sonraki çağrılarda önbellekten döner. Bu fonksiyon
+ * önbelleği geçersiz kılar ve fingerprint'leri hemen yeniden hesaplar
+ * (türetilmiş anahtarlar ilk kullanımda türetilir).
+ *
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode refreshFingerprints();
+
+/**
+ * @brief Fingerprint önbelleğini geçersiz kıl
+ *
+ * Saklanan türetilmiş anahtarlar güvenli şekilde silinir; değerler bir
+ * sonraki kullanımda yeniden hesaplanır.
+ */
+TRAVELEXPENSE_API void invalidateFingerprints();
+
+/**
+ * @brief Önbelleğin geçersiz kılma sayacını al
+ *
+ * Fingerprint'ten türeyen değerleri kendisi saklayan modüller, sayaç
+ * değiştiğinde kendi kayıtlarını yenilemelidir.
+ *
+ * @return uint64_t Her geçersiz kılmada artan değer
+ */
+TRAVELEXPENSE_API uint64_t getFingerprintGeneration();
+
+/**
+ * @brief Ağ arayüzü değişikliklerinde önbelleği otomatik geçersiz kıl
+ *
+ * Linux'ta netlink (NETLINK_ROUTE, RTMGRP_LINK) dinleyen bir arka plan
+ * thread'i başlatır. Zaten çalışıyorsa bir şey yapmaz.
+ *
+ * @return ErrorCode Success, ConnectionFailed (soket açılamadı) veya
+ *         Unknown (platform desteklemiyor)
+ */
+TRAVELEXPENSE_API ErrorCode startNetworkChangeMonitor();
+
+/**
+ * @brief Ağ arayüzü dinleyicisini durdur
+ */
+TRAVELEXPENSE_API void stopNetworkChangeMonitor();
+
+/**
+ * @brief Fingerprint önbelleğinin metriklerini al
+ *
+ * @param stats Metriklerin yazılacağı yapı
+ */
+TRAVELEXPENSE_API void getFingerprintCacheStats(FingerprintCacheStats &stats);
+
 } // namespace Fingerprinting
 
 } // namespace TravelExpense // LCOV_EXCL_LINE
@@ -12,6 +12,7 @@
 #define HELPERS_H
 
 #include "commonTypes.h"
+#include "export.h"
 
 namespace TravelExpense { // LCOV_EXCL_LINE
 
@@ -20,14 +21,14 @@ namespace TravelExpense { // LCOV_EXCL_LINE
  * @param category Gider kategorisi
  * @return const char* Kategori ad─▒
  */
-const char *getCategoryString(ExpenseCategory category);
+TRAVELEXPENSE_API const char *getCategoryString(ExpenseCategory category);
 
 /**
  * @brief String'i kategori enum'una ├ğevir
  * @param categoryStr Kategori string'i
  * @return ExpenseCategory Kategori enum'u
  */
-ExpenseCategory getCategoryFromString(const char *categoryStr);
+TRAVELEXPENSE_API ExpenseCategory getCategoryFromString(const char *categoryStr);
 
 } // namespace TravelExpense // LCOV_EXCL_LINE
 
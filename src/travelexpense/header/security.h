@@ -29,8 +29,8 @@ namespace Security {
 /**
  * @brief Bellekteki hassas verileri güvenli şekilde sil
  *
- * Bu fonksiyon, bellek içeriğini sıfırlar ve ardından rastgele verilerle
- * doldurarak verilerin kurtarılamamasını sağlar.
+ * Bu fonksiyon, bellek içeriğini tek geçişte ve optimizer tarafından
+ * atlanamayacak şekilde sıfırlar (memset maliyetinde).
  *
  * @param ptr Silinecek bellek alanının başlangıç adresi
  * @param size Silinecek bellek alanının boyutu (byte)
@@ -54,6 +54,26 @@ TRAVELEXPENSE_API void secureCleanup(char *buffer, size_t size);
  * @param value Doldurulacak değer (genellikle 0)
  */
 TRAVELEXPENSE_API void secureMemset(void *ptr, int value, size_t size);
+
+/**
+ * @brief Bellek bölgesini güvenli şekilde sıfırla (explicit_bzero semantiği)
+ *
+ * @param ptr Bellek adresi
+ * @param size Boyut
+ */
+TRAVELEXPENSE_API void secureZero(void *ptr, size_t size);
+
+/**
+ * @brief Sabit zamanlı bellek karşılaştırma (SIMD)
+ *
+ * Çalışma süresi yalnızca uzunluğa bağlıdır, ilk farkta erken çıkmaz.
+ *
+ * @param a İlk bellek alanı
+ * @param b İkinci bellek alanı
+ * @param size Karşılaştırılacak byte sayısı
+ * @return true Eşit, false Farklı veya hata (null pointer, sıfır uzunluk)
+ */
+TRAVELEXPENSE_API bool constantTimeEquals(const void *a, const void *b, size_t size);
 }
 
 } // namespace TravelExpense // LCOV_EXCL_LINE
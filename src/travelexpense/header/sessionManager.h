@@ -19,6 +19,7 @@
 
 #include "commonTypes.h"
 #include "export.h"
+#include "encryption.h"
 #include <cstdint>
 #include <cstddef>
 
@@ -53,6 +54,9 @@ TRAVELEXPENSE_API ErrorCode generateSessionKey(uint8_t *sessionKey, size_t sessi
  *
  * Oturum anahtarlarının şifrelenerek iletilmesi gereksinimini karşılar.
  *
+ * Girdi ve çıktı yalnızca encryptedSessionKey + 16 == plainSessionKey
+ * düzeninde çakışabilir; diğer çakışmalar InvalidInput döndürür.
+ *
  * @param plainSessionKey Şifrelenmemiş oturum anahtarı (32 byte)
  * @param encryptedSessionKey Şifrelenmiş oturum anahtarı çıktısı
  * @param encryptedLen Şifrelenmiş veri uzunluğu (çıktı)
@@ -74,6 +78,88 @@ TRAVELEXPENSE_API ErrorCode decryptSessionKey(const uint8_t *encryptedSessionKey
     size_t encryptedLen,
     uint8_t *plainSessionKey);
 
+// ============================================
+// OTURUM ANAHTARI TUTAMAÇLARI
+// ============================================
+
+/**
+ * @struct SessionKeyHandle
+ * @brief Oturum anahtarından türetilmiş hazır şifreleme durumu (opak)
+ *
+ * AES-256 anahtar takvimi ve HMAC-SHA256 iç/dış ara durumlarını tutar;
+ * handle alan payload ve HMAC fonksiyonları bunları mesaj başına yeniden
+ * hesaplamaz. Ham oturum anahtarı tutamaç içinde saklanmaz.
+ */
+struct SessionKeyHandle;
+
+/**
+ * @struct SessionKeyCacheStats
+ * @brief Oturum anahtarı önbelleği istatistikleri
+ */
+struct SessionKeyCacheStats {
+  size_t entries;      /**< @brief Önbellekteki aktif oturum sayısı */
+  size_t capacity;     /**< @brief Önbellek kapasitesi (0 = kapalı) */
+  uint64_t hits;       /**< @brief Anahtar çözmeden dönen istek */
+  uint64_t misses;     /**< @brief Master key ile çözülen istek */
+  uint64_t evictions;  /**< @brief Kapasite nedeniyle atılan oturum */
+};
+
+/**
+ * @brief Ham oturum anahtarından tutamaç oluştur (önbelleksiz)
+ *
+ * @param sessionKey Oturum anahtarı (32 byte)
+ * @param handle Tutamaç çıktısı; releaseSessionKeyHandle() ile bırakılmalı
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode createSessionKeyHandle(const uint8_t *sessionKey,
+    SessionKeyHandle **handle);
+
+/**
+ * @brief Şifrelenmiş oturum anahtarı için tutamaç al
+ *
+ * Aktif oturumlar şifrelenmiş anahtarın SHA-256 özeti ile sınırlı bir LRU
+ * önbellekte tutulur; master key ile çözme yalnızca önbellekte olmayan
+ * oturumlar için yapılır. Önbellekten atılan tutamaçlar son kullanıcı
+ * bıraktığında güvenli şekilde silinir.
+ *
+ * @param encryptedSessionKey encryptSessionKey() çıktısı
+ * @param encryptedLen Şifrelenmiş veri uzunluğu (64)
+ * @param handle Tutamaç çıktısı; releaseSessionKeyHandle() ile bırakılmalı
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode acquireSessionKeyHandle(const uint8_t *encryptedSessionKey,
+    size_t encryptedLen,
+    SessionKeyHandle **handle);
+
+/**
+ * @brief Tutamaç referansını bırak
+ *
+ * @param handle createSessionKeyHandle() veya acquireSessionKeyHandle() çıktısı (nullptr olabilir)
+ */
+TRAVELEXPENSE_API void releaseSessionKeyHandle(SessionKeyHandle *handle);
+
+/**
+ * @brief Oturum anahtarı önbelleğini yapılandır
+ *
+ * @param capacity Aktif oturum üst sınırı (varsayılan 64, 0 = önbellek kapalı)
+ */
+TRAVELEXPENSE_API void configureSessionKeyCache(size_t capacity);
+
+/**
+ * @brief Oturum anahtarı önbelleğini boşalt
+ *
+ * Thread başına önbelleklenmiş AES anahtar takvimleri de silinir
+ * (Encryption::clearAES256KeyCache).
+ */
+TRAVELEXPENSE_API void clearSessionKeyCache();
+
+/**
+ * @brief Oturum anahtarı önbelleği istatistiklerini al
+ *
+ * @param stats İstatistik çıktısı
+ */
+TRAVELEXPENSE_API void getSessionKeyCacheStats(SessionKeyCacheStats &stats);
+
 // ============================================
 // CİHAZ BAĞLANTISI VE SÜRÜM KONTROLÜ
 // ============================================
@@ -83,6 +169,9 @@ TRAVELEXPENSE_API ErrorCode decryptSessionKey(const uint8_t *encryptedSessionKey
  *
  * Uygulamanın yalnızca belirli cihazlarda çalışması gereksinimini karşılar.
  *
+ * @note Değer bir kez hesaplanıp saklanır; Fingerprinting::refreshFingerprints()
+ * veya invalidateFingerprints() sonrasında yeniden hesaplanır.
+ *
  * @param fingerprint Cihaz fingerprint çıktısı (64 karakter hex string)
  * @return ErrorCode Başarı durumu
  */
@@ -116,7 +205,10 @@ TRAVELEXPENSE_API ErrorCode validateDeviceAndVersion(const char *deviceFingerpri
 /**
  * @brief Veriyi şifrele (Confidential Payload)
  *
- * Taşınan verilerin şifrelenmesi gereksinimini karşılar.
+ * Taşınan verilerin şifrelenmesi gereksinimini karşılar. Çıktı IV (16 byte)
+ * ve ardından gelen şifreli metinden oluşur; IV şifrelemeden sonra yazılır.
+ * Yerinde şifreleme için düz metin ciphertext + 16 konumuna konmalıdır;
+ * bunun dışındaki çakışan tamponlar InvalidInput döndürür.
  *
  * @param plaintext Şifrelenecek veri
  * @param plaintextLen Veri uzunluğu
@@ -143,6 +235,147 @@ TRAVELEXPENSE_API ErrorCode decryptPayload(const void *ciphertext, size_t cipher
     const uint8_t *sessionKey,
     void *plaintext, size_t &plaintextLen);
 
+/**
+ * @brief Veriyi tutamaç ile şifrele
+ *
+ * Çıktı ve tampon çakışma kuralları encryptPayload(const uint8_t*) ile aynıdır.
+ *
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu
+ * @param sessionKey Oturum anahtarı tutamacı
+ * @param ciphertext Şifrelenmiş veri çıktısı
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode encryptPayload(const void *plaintext, size_t plaintextLen,
+    const SessionKeyHandle &sessionKey,
+    void *ciphertext, size_t &ciphertextLen);
+
+/**
+ * @brief Şifrelenmiş veriyi tutamaç ile çöz
+ *
+ * @param ciphertext Şifrelenmiş veri
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu
+ * @param sessionKey Oturum anahtarı tutamacı
+ * @param plaintext Şifre çözülmüş veri çıktısı
+ * @param plaintextLen Şifre çözülmüş veri uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode decryptPayload(const void *ciphertext, size_t ciphertextLen,
+    const SessionKeyHandle &sessionKey,
+    void *plaintext, size_t &plaintextLen);
+
+// ============================================
+// MÜHÜRLÜ VERİ (SEALED PAYLOAD)
+// ============================================
+
+/** @brief Mühürlü veri biçim sürümü */
+const uint8_t SEALED_PAYLOAD_VERSION = 1;
+
+/** @brief Mühürlü veri başlığı: sürüm (1) + ayrılmış (3) + nonce (12) + uzunluk (4) */
+const size_t SEALED_PAYLOAD_HEADER_SIZE = 20;
+
+/** @brief Mühürlü veri ek yükü: başlık + GCM etiketi (16) */
+const size_t SEALED_PAYLOAD_OVERHEAD = SEALED_PAYLOAD_HEADER_SIZE + Encryption::AES_GCM_TAG_SIZE;
+
+/**
+ * @brief Mühürlü veri için gereken buffer boyutu
+ *
+ * @param plaintextLen Düz metin uzunluğu
+ * @return size_t plaintextLen + SEALED_PAYLOAD_OVERHEAD
+ */
+TRAVELEXPENSE_API size_t sealedPayloadSize(size_t plaintextLen);
+
+/**
+ * @brief Veriyi tek geçişte şifrele ve doğrula (mühürlü veri)
+ *
+ * encryptPayload + calculateHMAC (+ signData) zincirinin yerini alır:
+ * AES-256-GCM ile şifreleme ve kimlik doğrulama veri üzerinden tek geçişte,
+ * ara buffer ayırmadan çağıranın buffer'ına yapılır. Çıktı formatı:
+ * [başlık (20 byte)][şifreli veri (plaintextLen byte)][tag (16 byte)]
+ * Başlık (sürüm, nonce, uzunluk) şifrelenmez ama etikete bağlıdır.
+ *
+ * Doğrulanmış şifreli veri için tek biçim budur: sürüm alanı biçimin
+ * ileride değiştirilebilmesini, uzunluk alanı kesilmiş verinin başlıkta
+ * reddedilmesini sağlar.
+ *
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu (en fazla 2^32 - 1)
+ * @param sessionKey Oturum anahtarı (32 byte)
+ * @param sealed Çıktı buffer'ı
+ * @param sealedCapacity Çıktı buffer'ı boyutu (en az sealedPayloadSize(plaintextLen))
+ * @param sealedLen Çıktı uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode sealPayload(const void *plaintext, size_t plaintextLen,
+                                        const uint8_t *sessionKey,
+                                        void *sealed, size_t sealedCapacity, size_t &sealedLen);
+
+/**
+ * @brief Veriyi tutamaç ile mühürle
+ *
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu (en fazla 2^32 - 1)
+ * @param sessionKey Oturum anahtarı tutamacı
+ * @param sealed Çıktı buffer'ı
+ * @param sealedCapacity Çıktı buffer'ı boyutu (en az sealedPayloadSize(plaintextLen))
+ * @param sealedLen Çıktı uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode sealPayload(const void *plaintext, size_t plaintextLen,
+                                        const SessionKeyHandle &sessionKey,
+                                        void *sealed, size_t sealedCapacity, size_t &sealedLen);
+
+/**
+ * @brief Birden fazla alandan oluşan veriyi kopyalamadan mühürle
+ *
+ * Alanlar ara buffer'da birleştirilmeden doğrudan çıktıya şifrelenir.
+ * Çıktı sealPayload ile aynı biçimdedir ve openPayload ile çözülür.
+ *
+ * @param fields Veri alanları
+ * @param fieldCount Alan sayısı
+ * @param sessionKey Oturum anahtarı (32 byte)
+ * @param sealed Çıktı buffer'ı
+ * @param sealedCapacity Çıktı buffer'ı boyutu (en az sealedPayloadSize(toplam alan uzunluğu))
+ * @param sealedLen Çıktı uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode sealPayloadGather(const Encryption::IOVec *fields, size_t fieldCount,
+                                              const uint8_t *sessionKey,
+                                              void *sealed, size_t sealedCapacity, size_t &sealedLen);
+
+/**
+ * @brief Mühürlü veriyi doğrula ve çöz
+ *
+ * @param sealed sealPayload çıktısı
+ * @param sealedLen Mühürlü veri uzunluğu
+ * @param sessionKey Oturum anahtarı (32 byte)
+ * @param plaintext Düz metin çıktısı
+ * @param plaintextCapacity Düz metin buffer'ı boyutu (en az sealedLen - SEALED_PAYLOAD_OVERHEAD)
+ * @param plaintextLen Düz metin uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu (InvalidInput = bozuk başlık/sürüm,
+ *         ChecksumMismatch = veri, başlık veya etiket değiştirilmiş)
+ */
+TRAVELEXPENSE_API ErrorCode openPayload(const void *sealed, size_t sealedLen,
+                                        const uint8_t *sessionKey,
+                                        void *plaintext, size_t plaintextCapacity, size_t &plaintextLen);
+
+/**
+ * @brief Mühürlü veriyi tutamaç ile doğrula ve çöz
+ *
+ * @param sealed sealPayload çıktısı
+ * @param sealedLen Mühürlü veri uzunluğu
+ * @param sessionKey Oturum anahtarı tutamacı
+ * @param plaintext Düz metin çıktısı
+ * @param plaintextCapacity Düz metin buffer'ı boyutu (en az sealedLen - SEALED_PAYLOAD_OVERHEAD)
+ * @param plaintextLen Düz metin uzunluğu (çıktı)
+ * @return ErrorCode Başarı durumu (InvalidInput = bozuk başlık/sürüm,
+ *         ChecksumMismatch = veri, başlık veya etiket değiştirilmiş)
+ */
+TRAVELEXPENSE_API ErrorCode openPayload(const void *sealed, size_t sealedLen,
+                                        const SessionKeyHandle &sessionKey,
+                                        void *plaintext, size_t plaintextCapacity, size_t &plaintextLen);
+
 // ============================================
 // BÜTÜNLÜK KONTROLÜ VE KİMLİK DOĞRULAMA
 // ============================================
@@ -175,6 +408,35 @@ TRAVELEXPENSE_API ErrorCode verifyHMAC(const void *data, size_t dataLen,
                                        const uint8_t *sessionKey,
                                        const char *expectedHMAC);
 
+/**
+ * @brief Tutamaç ile HMAC hesapla
+ *
+ * Anahtar bloklarının ara durumları tutamaçta hazır olduğundan mesaj başına
+ * yalnızca veri üzerinden hash hesaplanır.
+ *
+ * @param data Kontrol edilecek veri
+ * @param dataLen Veri uzunluğu
+ * @param sessionKey Oturum anahtarı tutamacı
+ * @param hmac HMAC çıktısı (64 karakter hex string)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode calculateHMAC(const void *data, size_t dataLen,
+    const SessionKeyHandle &sessionKey,
+    char *hmac);
+
+/**
+ * @brief Tutamaç ile HMAC doğrula
+ *
+ * @param data Kontrol edilecek veri
+ * @param dataLen Veri uzunluğu
+ * @param sessionKey Oturum anahtarı tutamacı
+ * @param expectedHMAC Beklenen HMAC değeri (64 karakter hex string)
+ * @return ErrorCode Başarı durumu (ChecksumMismatch = geçersiz)
+ */
+TRAVELEXPENSE_API ErrorCode verifyHMAC(const void *data, size_t dataLen,
+                                       const SessionKeyHandle &sessionKey,
+                                       const char *expectedHMAC);
+
 // ============================================
 // SUNUCU DOĞRULAMA KODU (DİJİTAL İMZA)
 // ============================================
@@ -203,6 +465,39 @@ TRAVELEXPENSE_API ErrorCode signData(const void *data, size_t dataLen,
 TRAVELEXPENSE_API ErrorCode verifySignature(const void *data, size_t dataLen,
     const char *signature);
 
+/**
+ * @brief Birden fazla kaydı toplu imzala
+ *
+ * İmzalar signData ile birebir aynıdır. İmza anahtarının HMAC ara durumları
+ * yeniden kullanılır ve kayıtlar çoklu buffer SHA-256 ile SIMD genişliği
+ * kadar (Encryption::getSHA256MultiBufferLanes) birlikte işlenir.
+ *
+ * @param records İmzalanacak kayıtlar (hiçbiri boş olmamalı)
+ * @param count Kayıt sayısı
+ * @param signatures İmza çıktıları (kayıt başına 129 byte'lık buffer)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode signMany(const Encryption::IOVec *records, size_t count,
+                                     char *const *signatures);
+
+/**
+ * @brief Birden fazla kaydın imzasını toplu doğrula
+ *
+ * Kayıt başına sonuç bitmap'e yazılır: i. kayıt geçerliyse
+ * resultBitmap[i / 8] içindeki (i % 8). bit 1 olur. Boş kayıt veya
+ * nullptr imza geçersiz sayılır.
+ *
+ * @param records Doğrulanacak kayıtlar
+ * @param count Kayıt sayısı
+ * @param signatures Beklenen imzalar (128 karakter hex string)
+ * @param resultBitmap Sonuç bitmap'i ((count + 7) / 8 byte)
+ * @param validCount Geçerli kayıt sayısı (çıktı)
+ * @return ErrorCode Success = tümü geçerli, ChecksumMismatch = en az biri geçersiz
+ */
+TRAVELEXPENSE_API ErrorCode verifyMany(const Encryption::IOVec *records, size_t count,
+                                       const char *const *signatures,
+                                       uint8_t *resultBitmap, size_t &validCount);
+
 } // namespace SessionManager
 
 } // namespace TravelExpense // LCOV_EXCL_LINE
@@ -59,6 +59,20 @@ enum class KeyUsage {
   DERIVE = 3           /**< @brief Anahtar türetme işlemleri için */
 };
 
+/**
+ * @brief PKCS#11 session havuzu istatistikleri
+ */
+struct SessionPoolStats {
+  size_t maxSessions;       /**< @brief En fazla açık session */
+  size_t openSessions;      /**< @brief Açık session (boşta + ödünçte) */
+  size_t idleSessions;      /**< @brief Boştaki session */
+  uint64_t checkouts;       /**< @brief Toplam ödünç alma */
+  uint64_t affinityHits;    /**< @brief Thread'in önceki session'ını tekrar alması */
+  uint64_t waits;           /**< @brief Havuz dolu olduğu için bekleme */
+  uint64_t sessionsOpened;  /**< @brief Açılan session */
+  uint64_t discarded;       /**< @brief Havuza geri konmadan kapatılan session */
+};
+
 /**
  * @brief SoftHSM'yi başlat ve PKCS#11 kütüphanesini yükle
  *
@@ -98,6 +112,9 @@ TRAVELEXPENSE_API ErrorCode createToken(const char *label, const char *pin, cons
 /**
  * @brief Token aç (oturum başlat)
  *
+ * PIN ile login yapılmış session havuzunu açar. Kriptografik fonksiyonlar
+ * thread-safe'dir; her çağrı havuzdan bir session ödünç alır.
+ *
  * @param label Token etiketi (nullptr ise varsayılan token)
  * @param pin PIN kodu
  * @return ErrorCode Başarı durumu
@@ -107,10 +124,32 @@ TRAVELEXPENSE_API ErrorCode openToken(const char *label, const char *pin);
 /**
  * @brief Token'ı kapat (oturum kapat)
  *
+ * Devam eden çağrıların bitmesini bekler, açık çok parçalı işlemlerin
+ * session'larını geri alır ve tüm session'ları kapatır.
+ *
  * @return ErrorCode Başarı durumu
  */
 TRAVELEXPENSE_API ErrorCode closeToken();
 
+/**
+ * @brief Session havuzunun en fazla session sayısını ayarla
+ *
+ * Varsayılan değer donanım thread sayısıdır. Sınır doluyken gelen çağrılar
+ * bir session boşalana kadar bekler.
+ *
+ * @param maxSessions En fazla açık session (0 olamaz)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode setSessionPoolSize(size_t maxSessions);
+
+/**
+ * @brief Session havuzu istatistiklerini al
+ *
+ * @param stats Çıktı: İstatistikler
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode getSessionPoolStats(SessionPoolStats &stats);
+
 /**
  * @brief Anahtar oluştur (generate key)
  *
@@ -190,6 +229,130 @@ TRAVELEXPENSE_API ErrorCode decrypt(const uint8_t *keyId, size_t keyIdLen,
                                     void *plaintext, size_t &plaintextLen,
                                     const uint8_t *iv = nullptr);
 
+/**
+ * @brief Çok parçalı (streaming) AES-CBC işlemi
+ *
+ * Init ile başlar, Final veya cancelCipherOperation ile biter. Sahiplik kuralı:
+ * Update Success dışında herhangi bir değer döndürürse, Final ise her zaman
+ * işlemi serbest bırakır; bu durumda pointer bir daha kullanılmamalı ve
+ * cancelCipherOperation'a verilmemelidir. operation nullptr ise hiçbir şey
+ * serbest bırakılmaz.
+ *
+ * İşlem süresince havuzdan bir session tutar. closeToken() açık işlemleri
+ * beklemez; session'larını geri alır ve sonraki Update/Final InvalidInput
+ * döner (işlem yine serbest bırakılır). Bir işlem aynı anda tek thread'den
+ * kullanılmalıdır; aynı işlem üzerinde iç içe çağrı yapılamaz. Açık
+ * session'ların hepsi işlemlerde iken yapılan diğer SoftHSM çağrıları
+ * beklemek yerine Busy döner.
+ */
+struct CipherOperation;
+
+/**
+ * @brief Çok parçalı şifrelemeyi başlat (C_EncryptInit, AES-CBC-PAD)
+ *
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen Anahtar ID uzunluğu
+ * @param iv IV (16 byte)
+ * @param operation Çıktı: Başlatılan işlem
+ * @return ErrorCode Başarı durumu (Busy = havuzda boş session yok; Init beklemez)
+ */
+TRAVELEXPENSE_API ErrorCode encryptInit(const uint8_t *keyId, size_t keyIdLen, const uint8_t *iv,
+                                        CipherOperation **operation);
+
+/**
+ * @brief Şifrelemeye veri parçası ver (C_EncryptUpdate)
+ *
+ * @param operation İşlem
+ * @param plaintext Şifrelenecek parça
+ * @param plaintextLen Parça uzunluğu (blok katı olması gerekmez)
+ * @param ciphertext Şifrelenmiş çıktı (en az plaintextLen + 16 byte)
+ * @param ciphertextLen Buffer boyutu (giriş), yazılan byte (çıktı)
+ * @return ErrorCode Başarı durumu (Success dışında işlem serbest bırakılmıştır)
+ */
+TRAVELEXPENSE_API ErrorCode encryptUpdate(CipherOperation *operation, const void *plaintext,
+    size_t plaintextLen, void *ciphertext, size_t &ciphertextLen);
+
+/**
+ * @brief Şifrelemeyi bitir (C_EncryptFinal); işlem serbest bırakılır
+ *
+ * @param operation İşlem
+ * @param ciphertext Son blok çıktısı (en az 16 byte)
+ * @param ciphertextLen Buffer boyutu (giriş), yazılan byte (çıktı)
+ * @return ErrorCode Başarı durumu (işlem her durumda serbest bırakılmıştır)
+ */
+TRAVELEXPENSE_API ErrorCode encryptFinal(CipherOperation *operation, void *ciphertext,
+    size_t &ciphertextLen);
+
+/**
+ * @brief Çok parçalı şifre çözmeyi başlat (C_DecryptInit, AES-CBC-PAD)
+ *
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen Anahtar ID uzunluğu
+ * @param iv IV (16 byte)
+ * @param operation Çıktı: Başlatılan işlem
+ * @return ErrorCode Başarı durumu (Busy = havuzda boş session yok; Init beklemez)
+ */
+TRAVELEXPENSE_API ErrorCode decryptInit(const uint8_t *keyId, size_t keyIdLen, const uint8_t *iv,
+                                        CipherOperation **operation);
+
+/**
+ * @brief Şifre çözmeye veri parçası ver (C_DecryptUpdate)
+ *
+ * @param operation İşlem
+ * @param ciphertext Şifrelenmiş parça
+ * @param ciphertextLen Parça uzunluğu
+ * @param plaintext Çözülmüş çıktı (en az ciphertextLen + 16 byte)
+ * @param plaintextLen Buffer boyutu (giriş), yazılan byte (çıktı)
+ * @return ErrorCode Başarı durumu (Success dışında işlem serbest bırakılmıştır)
+ */
+TRAVELEXPENSE_API ErrorCode decryptUpdate(CipherOperation *operation, const void *ciphertext,
+    size_t ciphertextLen, void *plaintext, size_t &plaintextLen);
+
+/**
+ * @brief Şifre çözmeyi bitir (C_DecryptFinal); işlem serbest bırakılır
+ *
+ * @param operation İşlem
+ * @param plaintext Son blok çıktısı (en az 16 byte)
+ * @param plaintextLen Buffer boyutu (giriş), yazılan byte (çıktı)
+ * @return ErrorCode Başarı durumu (padding geçersizse hata; işlem her durumda serbest bırakılmıştır)
+ */
+TRAVELEXPENSE_API ErrorCode decryptFinal(CipherOperation *operation, void *plaintext,
+    size_t &plaintextLen);
+
+/**
+ * @brief Çok parçalı işlemi iptal et ve serbest bırak
+ *
+ * @param operation İşlem (nullptr olabilir)
+ */
+TRAVELEXPENSE_API void cancelCipherOperation(CipherOperation *operation);
+
+/**
+ * @brief Dosyayı HSM anahtarıyla şifrele (sabit bellekli akış)
+ *
+ * Dosya 1 MiB'lık parçalar halinde C_EncryptUpdate'e verilir; bir parça
+ * şifrelenirken sonraki okunur. Çıktı formatı: [IV (16 byte)][Ciphertext (padded)]
+ *
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen Anahtar ID uzunluğu
+ * @param inputFile Girdi dosya yolu
+ * @param outputFile Çıktı dosya yolu
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode encryptFile(const uint8_t *keyId, size_t keyIdLen,
+                                        const char *inputFile, const char *outputFile);
+
+/**
+ * @brief encryptFile ile şifrelenmiş dosyayı çöz (sabit bellekli akış)
+ *
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen Anahtar ID uzunluğu
+ * @param inputFile Şifrelenmiş dosya yolu
+ * @param outputFile Çıktı dosya yolu
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API ErrorCode decryptFile(const uint8_t *keyId, size_t keyIdLen,
+                                        const char *inputFile, const char *outputFile);
+
 /**
  * @brief Veriyi imzala (sign data)
  *
@@ -6,6 +6,10 @@
  * - SSL/TLS bağlantısı kurma
  * - Certificate pinning implementasyonu
  * - Mutual authentication
+ * - TLS oturum devamı (session resumption) ve bağlantı havuzu
+ * - Dosyaların kTLS (SSL_sendfile) ile kopyasız gönderimi
+ * - Engellemeyen (non-blocking) G/Ç ve tek thread'de çok bağlantı yöneten olay döngüsü
+ * - Çevrimdışı testler için yerel (loopback) TLS test sunucusu
  *
  * @author Binnur Altınışık
  * @date 2025
@@ -34,8 +38,9 @@ namespace TLS {
 /**
  * @brief TLS bağlamı (context) yapısı
  *
- * Bu yapı, TLS bağlantı bilgilerini saklar.
- * Gerçek implementasyonda OpenSSL SSL_CTX veya benzeri kullanılabilir.
+ * Bu yapı, TLS bağlantı bilgilerini saklar. Kütüphane OpenSSL ile
+ * derlendiğinde sslContext bir SSL_CTX*, sslConnection bir SSL* tutar;
+ * OpenSSL olmadan bağlantı kurulamaz (connectTLS ConnectionFailed döner).
  *
  * @note Bu yapı, TLS bağlantısının yaşam döngüsü boyunca geçerli kalır.
  * Bağlantı kapatıldığında cleanupTLSContext() ile temizlenmelidir.
@@ -53,16 +58,42 @@ struct TLSContext {
   char serverHostname[256];
   /** @brief Sunucu port numarası (1-65535) */
   uint16_t serverPort;
+  /** @brief Engellemeyen mod (setTLSNonBlocking) */
+  bool nonBlocking;
+  /** @brief Son işlem Busy döndü ve soketin okunabilir olması bekleniyor */
+  bool wantRead;
+  /** @brief Son işlem Busy döndü ve soketin yazılabilir olması bekleniyor */
+  bool wantWrite;
 };
 
 /**
  * @brief TLS bağlamını başlat
  *
+ * İstemci tarafı oturum önbelleği açık gelir: sunucunun verdiği session
+ * ticket / session ID, hostname:port başına saklanır ve aynı bağlamla
+ * (veya bağlamı paylaşan havuz bağlantılarıyla) yapılan sonraki
+ * connectTLS() çağrılarında kısaltılmış handshake için sunulur.
+ *
  * @param ctx TLS bağlamı (çıktı)
  * @return ErrorCode Başarı durumu
  */
 TRAVELEXPENSE_API TravelExpense::ErrorCode initializeTLSContext(TLSContext *ctx);
 
+/**
+ * @brief Mevcut bağlamın ayarlarını paylaşan yeni bağlam başlat
+ *
+ * SSL bağlamı (güvenilen CA'lar, istemci sertifikası, oturum önbelleği)
+ * kopyalanmaz, referansla paylaşılır: sistem CA deposunun her bağlantı için
+ * yeniden yüklenmesi önlenir. Paylaşılan ayarlar sonradan değiştirilirse
+ * tüm bağlamları etkiler. Her bağlam ayrıca cleanupTLSContext() ile
+ * temizlenmelidir.
+ *
+ * @param ctx Yeni TLS bağlamı (çıktı)
+ * @param config Başlatılmış kaynak bağlam
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode initializeSharedTLSContext(TLSContext *ctx, const TLSContext *config);
+
 /**
  * @brief TLS bağlamını temizle
  *
@@ -74,13 +105,33 @@ TRAVELEXPENSE_API TravelExpense::ErrorCode cleanupTLSContext(TLSContext *ctx);
 /**
  * @brief TLS bağlantısı kur
  *
+ * TCP bağlantısı açılır ve TLS 1.2+ handshake yapılır. Sunucu sertifikası
+ * güvenilen CA'lara (sistem deposu ve setCAPath) ve hostname'e (SAN DNS
+ * veya IP) göre doğrulanır; ardından kayıtlı pin varsa kontrol edilir.
+ * Önbellekte bu hostname:port için oturum varsa devam ettirilmesi denenir;
+ * sunucu kabul etmezse tam handshake yapılır.
+ *
+ * Engellemeyen modda TCP bağlantısı ve handshake beklenmez: Busy dönerse
+ * getTLSSocket() soketi wantRead/wantWrite durumuna göre hazır olunca
+ * continueConnectTLS() çağrılır.
+ *
  * @param ctx TLS bağlamı
  * @param hostname Sunucu hostname
  * @param port Sunucu port
- * @return ErrorCode Başarı durumu
+ * @return ErrorCode Başarı durumu (ConnectionFailed = ağ/handshake hatası,
+ *         SecurityFailed = sertifika doğrulanamadı veya pin uyuşmadı,
+ *         Busy = engellemeyen modda handshake sürüyor)
  */
 TRAVELEXPENSE_API TravelExpense::ErrorCode connectTLS(TLSContext *ctx, const char *hostname, uint16_t port);
 
+/**
+ * @brief Engellemeyen modda başlatılmış handshake'i ilerlet
+ *
+ * @param ctx TLS bağlamı (connectTLS() Busy döndürmüş)
+ * @return ErrorCode connectTLS() ile aynı (bağlantı zaten kuruluysa Success)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode continueConnectTLS(TLSContext *ctx);
+
 /**
  * @brief TLS bağlantısını kapat
  *
@@ -95,8 +146,9 @@ TRAVELEXPENSE_API TravelExpense::ErrorCode disconnectTLS(TLSContext *ctx);
  * @param ctx TLS bağlamı
  * @param data Gönderilecek veri
  * @param dataLen Veri uzunluğu
- * @param bytesSent Gönderilen byte sayısı (çıktı)
- * @return ErrorCode Başarı durumu
+ * @param bytesSent Gönderilen byte sayısı (çıktı; engellemeyen modda dataLen'den az olabilir)
+ * @return ErrorCode Başarı durumu (engellemeyen modda Busy = hiç yazılamadı,
+ *         wantRead/wantWrite sağlanınca aynı veriyle tekrar denenmeli)
  */
 TRAVELEXPENSE_API TravelExpense::ErrorCode sendTLS(TLSContext *ctx, const void *data, size_t dataLen, size_t &bytesSent);
 
@@ -106,11 +158,297 @@ TRAVELEXPENSE_API TravelExpense::ErrorCode sendTLS(TLSContext *ctx, const void *
  * @param ctx TLS bağlamı
  * @param buffer Alınacak veri buffer'ı
  * @param bufferLen Buffer uzunluğu
- * @param bytesReceived Alınan byte sayısı (çıktı)
- * @return ErrorCode Başarı durumu
+ * @param bytesReceived Alınan byte sayısı (çıktı, karşı taraf bağlantıyı kapattıysa 0)
+ * @return ErrorCode Başarı durumu (engellemeyen modda Busy = henüz veri yok)
  */
 TRAVELEXPENSE_API TravelExpense::ErrorCode receiveTLS(TLSContext *ctx, void *buffer, size_t bufferLen, size_t &bytesReceived);
 
+// ============================================
+// DOSYA GÖNDERİMİ
+// ============================================
+
+/**
+ * @brief Dosyanın bir aralığını TLS üzerinden gönder
+ *
+ * Bağlantıda kernel TLS (kTLS) gönderimi etkinse (Linux, OpenSSL 3.0+,
+ * "tls" çekirdek modülü) SSL_sendfile ile veri kullanıcı alanına
+ * kopyalanmadan gönderilir; değilse 64 KB'lık buffer ile okunup sendTLS
+ * ile gönderilir. Dosya konumu (lseek) değiştirilmez.
+ *
+ * @param ctx TLS bağlamı (bağlı)
+ * @param fd Okunabilir dosya tanıtıcısı (POSIX open/_open)
+ * @param offset Dosyadaki başlangıç konumu
+ * @param length Gönderilecek byte sayısı
+ * @param bytesSent Gönderilen byte sayısı (çıktı)
+ * @return ErrorCode Başarı durumu (FileIO = okuma hatası veya dosya aralıktan
+ *         kısa; engellemeyen modda Success ile bytesSent < length olabilir,
+ *         Busy = hiç gönderilemedi)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode sendFileTLS(TLSContext *ctx, int fd, uint64_t offset, size_t length,
+    size_t &bytesSent);
+
+/**
+ * @brief Bağlantının kayıt şifrelemesi çekirdeğe (kTLS) devredildi mi
+ *
+ * @param ctx TLS bağlamı
+ * @return bool true = sendFileTLS kopyasız yolu kullanır
+ */
+TRAVELEXPENSE_API bool isTLSKernelOffloaded(const TLSContext *ctx);
+
+// ============================================
+// ENGELLEMEYEN (NON-BLOCKING) G/Ç
+// ============================================
+
+/**
+ * @brief Engellemeyen modu aç/kapat
+ *
+ * Açıkken connectTLS/continueConnectTLS, sendTLS ve receiveTLS beklemek
+ * yerine Busy döner ve bağlamın wantRead/wantWrite alanlarını doldurur.
+ * Ayar mevcut bağlantıya ve sonraki bağlantılara uygulanır.
+ *
+ * @param ctx TLS bağlamı
+ * @param enabled true = engellemeyen, false = engelleyen (varsayılan)
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode setTLSNonBlocking(TLSContext *ctx, bool enabled);
+
+/**
+ * @brief Bağlantının soket tanıtıcısını al (dış olay döngüleri için)
+ *
+ * @param ctx TLS bağlamı
+ * @return int Soket (bağlantı yoksa -1)
+ */
+TRAVELEXPENSE_API int getTLSSocket(const TLSContext *ctx);
+
+// ============================================
+// OLAY DÖNGÜSÜ
+// ============================================
+
+/**
+ * @struct TLSEventLoop
+ * @brief Tek thread'de çok sayıda TLS bağlantısını yöneten olay döngüsü (opak)
+ *
+ * Linux'ta epoll, diğer platformlarda poll kullanılır. Bağlam başına aynı
+ * anda tek işlem bekleyebilir; tamamlanan işlemin callback'i sıradaki
+ * işlemi ekleyebilir. Döngü thread-safe değildir: işlemler döngüyü
+ * çalıştıran thread'den eklenmelidir.
+ */
+struct TLSEventLoop;
+
+/**
+ * @brief İşlem tamamlanma callback'i
+ *
+ * @param ctx İşlemin bağlamı
+ * @param result Sonuç (connectTLS/sendTLS/receiveTLS hata kodları)
+ * @param bytes Aktarılan byte (bağlantı için 0; alımda 0 = karşı taraf kapattı)
+ * @param userData İşlem eklenirken verilen kullanıcı verisi
+ */
+typedef void (*TLSCompletionCallback)(TLSContext *ctx, TravelExpense::ErrorCode result, size_t bytes,
+                                      void *userData);
+
+/**
+ * @brief Olay döngüsü oluştur
+ *
+ * @param loop Döngü çıktısı; destroyTLSEventLoop() ile yok edilmeli
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode createTLSEventLoop(TLSEventLoop **loop);
+
+/**
+ * @brief Olay döngüsünü yok et (bekleyen işlemler callback'siz bırakılır)
+ *
+ * @param loop Döngü
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode destroyTLSEventLoop(TLSEventLoop *loop);
+
+/**
+ * @brief Engellemeyen bağlantı başlat
+ *
+ * Bağlam engellemeyen moda alınır; handshake ve pin kontrolü bitince
+ * callback çağrılır.
+ *
+ * @param loop Döngü
+ * @param ctx TLS bağlamı (başlatılmış)
+ * @param hostname Sunucu hostname
+ * @param port Sunucu port
+ * @param callback Tamamlanma callback'i
+ * @param userData Callback kullanıcı verisi
+ * @return ErrorCode Success (eklendi), Busy (bağlamda bekleyen işlem var)
+ *         veya adres çözümleme/soket hatası (callback çağrılmaz)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode asyncConnectTLS(TLSEventLoop *loop, TLSContext *ctx,
+    const char *hostname, uint16_t port, TLSCompletionCallback callback, void *userData);
+
+/**
+ * @brief Verinin tamamını engellemeden gönder
+ *
+ * @param loop Döngü
+ * @param ctx Bağlı TLS bağlamı
+ * @param data Veri (callback'e kadar geçerli kalmalı)
+ * @param dataLen Veri uzunluğu
+ * @param callback Tamamlanma callback'i (bytes = gönderilen)
+ * @param userData Callback kullanıcı verisi
+ * @return ErrorCode Success (eklendi), Busy veya ConnectionFailed
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode asyncSendTLS(TLSEventLoop *loop, TLSContext *ctx,
+    const void *data, size_t dataLen, TLSCompletionCallback callback, void *userData);
+
+/**
+ * @brief Veri gelince engellemeden al (en az 1 byte veya bağlantı kapanışı)
+ *
+ * @param loop Döngü
+ * @param ctx Bağlı TLS bağlamı
+ * @param buffer Buffer (callback'e kadar geçerli kalmalı)
+ * @param bufferLen Buffer uzunluğu
+ * @param callback Tamamlanma callback'i (bytes = alınan)
+ * @param userData Callback kullanıcı verisi
+ * @return ErrorCode Success (eklendi), Busy veya ConnectionFailed
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode asyncReceiveTLS(TLSEventLoop *loop, TLSContext *ctx,
+    void *buffer, size_t bufferLen, TLSCompletionCallback callback, void *userData);
+
+/**
+ * @brief Bağlamın bekleyen işlemini callback'siz iptal et
+ *
+ * Bağlam kapatılmadan veya yok edilmeden önce çağrılmalıdır.
+ *
+ * @param loop Döngü
+ * @param ctx TLS bağlamı
+ * @return ErrorCode Başarı durumu (işlem yoksa da Success)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode cancelTLSOperation(TLSEventLoop *loop, TLSContext *ctx);
+
+/**
+ * @brief Bekleyen işlemler bitene veya süre dolana kadar olayları işle
+ *
+ * Callback'ler bu çağrının içinden (çağıran thread'de) çağrılır.
+ *
+ * @param loop Döngü
+ * @param timeoutMs En uzun süre (ms, -1 = sınırsız, 0 = yalnızca hazır işlemler)
+ * @return ErrorCode Success (bekleyen işlem kalmadı) veya Busy (süre doldu)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode runTLSEventLoop(TLSEventLoop *loop, int timeoutMs);
+
+// ============================================
+// OTURUM DEVAMI (SESSION RESUMPTION)
+// ============================================
+
+/**
+ * @brief Oturum devamını aç/kapat
+ *
+ * Önbellek SSL bağlamına aittir; bağlamı paylaşan tüm bağlantıları
+ * (ör. aynı havuzdaki bağlantılar) etkiler. Kapatıldığında önbellekteki
+ * oturumlar silinir.
+ *
+ * @note TLS 1.3'te session ticket handshake'ten sonra gelir ve ilk
+ * receiveTLS() sırasında işlenir; hiç okuma yapmadan kapatılan bağlantı
+ * için oturum saklanmaz. TLS 1.3 ticket'ları tek kullanımlıktır.
+ *
+ * @param ctx TLS bağlamı
+ * @param enabled true = açık (varsayılan), false = kapalı
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode setTLSSessionResumption(TLSContext *ctx, bool enabled);
+
+/**
+ * @brief Son handshake önceki oturumun devamı mı
+ *
+ * @param ctx TLS bağlamı (bağlı)
+ * @return bool true = kısaltılmış handshake, false = tam handshake veya bağlı değil
+ */
+TRAVELEXPENSE_API bool isTLSSessionResumed(const TLSContext *ctx);
+
+// ============================================
+// BAĞLANTI HAVUZU
+// ============================================
+
+/**
+ * @struct TLSConnectionPool
+ * @brief hostname:port başına boşta bağlantıları tutan havuz (opak)
+ *
+ * Havuz bağlantıları şablon bağlamın SSL bağlamını (CA, istemci sertifikası,
+ * oturum önbelleği) paylaşır. Boşta bağlantı yeniden verildiğinde handshake
+ * ve pin kontrolü tekrarlanmaz; yeni açılan bağlantılar önbellekteki oturumu
+ * devam ettirir.
+ */
+struct TLSConnectionPool;
+
+/**
+ * @struct TLSConnectionPoolStats
+ * @brief Bağlantı havuzu istatistikleri
+ */
+struct TLSConnectionPoolStats {
+  size_t idleConnections;      /**< @brief Boşta bekleyen bağlantı sayısı */
+  size_t activeConnections;    /**< @brief Kullanımdaki (verilmiş) bağlantı sayısı */
+  uint64_t reused;             /**< @brief Boşta bağlantıdan karşılanan istek */
+  uint64_t fullHandshakes;     /**< @brief Tam handshake ile açılan bağlantı */
+  uint64_t resumedHandshakes;  /**< @brief Oturum devamı ile açılan bağlantı */
+  uint64_t discarded;          /**< @brief Kapanmış/zaman aşımına uğramış/fazla olduğu için kapatılan bağlantı */
+};
+
+/**
+ * @brief Bağlantı havuzu oluştur
+ *
+ * @param config Şablon bağlam (initializeTLSContext, setCAPath,
+ *        loadClientCertificate ile hazırlanmış); havuz SSL bağlamına kendi
+ *        referansını alır, config havuzdan önce temizlenebilir
+ * @param maxIdlePerHost hostname:port başına tutulacak en fazla boşta bağlantı
+ * @param idleTimeoutMs Boşta bağlantının en uzun bekleme süresi (ms, 0 = sınırsız)
+ * @param pool Havuz çıktısı; destroyTLSConnectionPool() ile yok edilmeli
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode createTLSConnectionPool(const TLSContext *config,
+    size_t maxIdlePerHost, uint32_t idleTimeoutMs, TLSConnectionPool **pool);
+
+/**
+ * @brief Havuzdan bağlantı al
+ *
+ * Boşta, zaman aşımına uğramamış ve karşı tarafın kapatmadığı bir bağlantı
+ * varsa o verilir; yoksa yeni bağlantı connectTLS() ile açılır.
+ *
+ * @param pool Havuz
+ * @param hostname Sunucu hostname
+ * @param port Sunucu port
+ * @param connection Bağlantı çıktısı; releaseTLSConnection() ile geri verilmeli
+ * @return ErrorCode Başarı durumu (connectTLS() ile aynı hata kodları)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode acquireTLSConnection(TLSConnectionPool *pool,
+    const char *hostname, uint16_t port, TLSContext **connection);
+
+/**
+ * @brief Bağlantıyı havuza geri ver
+ *
+ * @param pool Havuz
+ * @param connection acquireTLSConnection() çıktısı
+ * @param reusable false ise (ör. protokol hatası, yarım kalmış yanıt)
+ *        bağlantı kapatılır
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode releaseTLSConnection(TLSConnectionPool *pool,
+    TLSContext *connection, bool reusable);
+
+/**
+ * @brief Havuzu yok et
+ *
+ * Boşta bağlantılar kapatılır. Kullanımdaki bağlantılar önceden
+ * releaseTLSConnection() ile geri verilmiş olmalıdır.
+ *
+ * @param pool Havuz
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode destroyTLSConnectionPool(TLSConnectionPool *pool);
+
+/**
+ * @brief Havuz istatistiklerini al
+ *
+ * @param pool Havuz
+ * @param stats İstatistik çıktısı
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode getTLSConnectionPoolStats(TLSConnectionPool *pool,
+    TLSConnectionPoolStats &stats);
+
 // ============================================
 // CERTIFICATE PINNING
 // ============================================
@@ -145,6 +483,14 @@ struct CertificatePin {
  */
 TRAVELEXPENSE_API TravelExpense::ErrorCode registerCertificatePin(const CertificatePin *pin);
 
+/**
+ * @brief Hostname için kayıtlı certificate pin'i kaldır
+ *
+ * @param hostname Sunucu hostname
+ * @return ErrorCode Başarı durumu (kayıt yoksa da Success)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode removeCertificatePin(const char *hostname);
+
 /**
  * @brief Certificate pin doğrula
  *
@@ -168,6 +514,8 @@ TRAVELEXPENSE_API TravelExpense::ErrorCode getCertificateFingerprint(TLSContext
 /**
  * @brief Sunucu sertifikasının public key hash'ini al
  *
+ * SHA-256(DER SubjectPublicKeyInfo) değeridir.
+ *
  * @param ctx TLS bağlamı
  * @param publicKeyHash Public key hash çıktısı (64 karakter hex)
  * @return ErrorCode Başarı durumu
@@ -213,6 +561,57 @@ TRAVELEXPENSE_API TravelExpense::ErrorCode setCAPath(TLSContext *ctx, const char
  */
 TRAVELEXPENSE_API TravelExpense::ErrorCode verifyServerCertificate(TLSContext *ctx);
 
+// ============================================
+// YEREL TEST SUNUCUSU (LOOPBACK)
+// ============================================
+
+/**
+ * @struct TLSTestServer
+ * @brief Yerel echo TLS test sunucusu (opak)
+ */
+struct TLSTestServer;
+
+/**
+ * @struct TLSTestServerInfo
+ * @brief Test sunucusuna bağlanmak için gereken bilgiler
+ */
+struct TLSTestServerInfo {
+  /** @brief Dinlenen port (127.0.0.1) */
+  uint16_t port;
+  /** @brief Test CA sertifikası (PEM), setCAPath() ile kullanılır */
+  char caCertPath[512];
+  /** @brief Sunucu sertifikasının SHA-256 fingerprint'i (64 karakter hex) */
+  char fingerprint[65];
+  /** @brief Sunucu sertifikasının public key hash'i (64 karakter hex) */
+  char publicKeyHash[65];
+};
+
+/**
+ * @brief Yerel TLS test sunucusunu başlat
+ *
+ * Ağ erişimi olmadan TLS taşımasını test etmek için her çalıştırmada yeni
+ * bir self-signed test CA ve bu CA'nın imzaladığı "localhost"/127.0.0.1
+ * sunucu sertifikası üretilir. Sunucu 127.0.0.1 üzerinde boş bir portu
+ * dinler ve her bağlantıda aldığı veriyi geri gönderir (echo).
+ *
+ * @param workDir Test CA sertifikasının (tls_test_ca.pem) yazılacağı dizin
+ * @param server Sunucu tanıtıcısı (çıktı); stopTLSTestServer() ile durdurulmalı
+ * @param info Bağlantı bilgileri (çıktı)
+ * @return ErrorCode Başarı durumu (OpenSSL olmadan ConnectionFailed)
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode startTLSTestServer(const char *workDir,
+    TLSTestServer **server, TLSTestServerInfo *info);
+
+/**
+ * @brief Test sunucusunu durdur
+ *
+ * Açık bağlantılar kapatılır ve tüm thread'ler beklenir.
+ *
+ * @param server startTLSTestServer() çıktısı
+ * @return ErrorCode Başarı durumu
+ */
+TRAVELEXPENSE_API TravelExpense::ErrorCode stopTLSTestServer(TLSTestServer *server);
+
 // ============================================
 // YARDIMCI FONKSİYONLAR
 // ============================================
@@ -13,6 +13,7 @@
 
 #include "commonTypes.h"
 #include "export.h"
+#include "userAuth.h"
 #include <vector>
 
 namespace TravelExpense { // LCOV_EXCL_LINE
@@ -60,6 +61,30 @@ TRAVELEXPENSE_API ErrorCode createTrip(const Trip &trip, int32_t &tripId);
  */
 TRAVELEXPENSE_API ErrorCode getTrips(int32_t userId, std::vector<Trip> &trips);
 
+/**
+ * @brief Bağlamdaki kullanıcı adına yeni seyahat oluştur
+ *
+ * trip.userId yok sayılır; seyahat bağlamın kullanıcısına yazılır. Global
+ * oturum durumu kullanılmadığı için farklı kullanıcıların istekleri aynı
+ * anda işlenebilir.
+ *
+ * @param context Oturum bağlamı (UserAuth::loginUser ile alınmış)
+ * @param trip Seyahat bilgileri
+ * @param tripId Oluşturulan seyahatin ID'si (çıktı parametresi)
+ * @return ErrorCode Başarı durumu (misafir bağlamı için InvalidInput)
+ */
+TRAVELEXPENSE_API ErrorCode createTrip(const UserAuth::UserContext &context, const Trip &trip,
+                                       int32_t &tripId);
+
+/**
+ * @brief Bağlamdaki kullanıcının seyahatlerini listele
+ *
+ * @param context Oturum bağlamı
+ * @param trips Seyahat listesi (çıktı parametresi)
+ * @return ErrorCode Başarı durumu (Success, FileNotFound vb.)
+ */
+TRAVELEXPENSE_API ErrorCode getTrips(const UserAuth::UserContext &context, std::vector<Trip> &trips);
+
 /**
  * @brief Seyahat bilgisini güncelle
  *
@@ -13,6 +13,8 @@
 
 #include "commonTypes.h"
 #include "export.h"
+#include <cstddef>
+#include <future>
 
 namespace TravelExpense { // LCOV_EXCL_LINE
 
@@ -23,20 +25,44 @@ namespace TravelExpense { // LCOV_EXCL_LINE
  * Bu modül, kullanıcı kaydı, giriş, çıkış ve kimlik doğrulama
  * işlemlerini yönetir. Şifre hash'leme ve doğrulama işlemlerini
  * sağlar. Misafir modu desteği sunar.
+ *
+ * Oturumlar UserContext nesneleriyle temsil edilir. Çok kullanıcılı
+ * servisler bağlamı açıkça taşır; tek kullanıcılı uygulamalar için
+ * her thread'in kendi "mevcut" bağlamı vardır (getCurrentUser()).
  */
 namespace UserAuth {
+/**
+ * @struct UserContext
+ * @brief Oturum açmış (veya misafir) bir kullanıcının bağlamı
+ *
+ * loginUser(username, password, &context) veya createGuestContext() ile
+ * oluşturulur, releaseUserContext() ile serbest bırakılır. Bağlam hiçbir
+ * global duruma bağlı değildir; farklı kullanıcıların istekleri aynı anda
+ * farklı thread'lerde işlenebilir.
+ */
+struct UserContext {
+  User user;            /**< @brief Kullanıcı bilgisi (misafir için userId = -1) */
+  time_t loginTime;     /**< @brief Oturumun açıldığı zaman */
+
+  UserContext() : loginTime(0) {}
+};
+
 /**
  * @brief Kullanıcı kaydı
  *
  * Yeni bir kullanıcı kaydı oluşturur. Şifre hash'lenir ve salt ile birlikte
  * veritabanına kaydedilir. Kullanıcı adı benzersiz olmalıdır.
  *
- * @note Bu fonksiyon, şifreyi SHA-256 ile hash'ler ve salt ekler.
+ * @note Şifre, güncel iterasyon sayısıyla sürümlü PBKDF2-HMAC-SHA256 kaydı
+ * olarak saklanır (bkz. Encryption::hashPasswordRecord).
  * Eğer kullanıcı adı zaten varsa, InvalidInput hatası döner.
+ * Hash hesabı şifre doğrulama worker havuzunda yapılır ve sonuç beklenir
+ * (registerUserAsync().get()); çağıranı bekletmemek için registerUserAsync()
+ * kullanılmalıdır. Worker callback'i içinden çağrılırsa iş doğrudan çalışır.
  *
  * @param username Kullanıcı adı (nullptr ise InvalidInput döner, benzersiz olmalı)
  * @param password Şifre (nullptr ise InvalidInput döner, minimum uzunluk kontrolü yapılabilir)
- * @return ErrorCode Başarı durumu (Success, InvalidInput, FileNotFound vb.)
+ * @return ErrorCode Başarı durumu (Success, InvalidInput, FileNotFound, Busy vb.)
  */
 TRAVELEXPENSE_API ErrorCode registerUser(const char *username, const char *password);
 
@@ -48,7 +74,10 @@ TRAVELEXPENSE_API ErrorCode registerUser(const char *username, const char *passw
  *
  * @note Bu fonksiyon, şifreyi hash'ler ve veritabanındaki hash ile karşılaştırır.
  * Constant-time comparison kullanarak timing attack'lara karşı koruma sağlar.
- * Başarılı giriş sonrası, getCurrentUser() ile kullanıcı bilgisi alınabilir.
+ * Kayıt eski formatta veya farklı iterasyon sayısıyla saklanmışsa, başarılı
+ * girişten sonra güncel parametrelerle şeffaf şekilde yeniden hash'lenir.
+ * Başarılı giriş sonrası, çağıran thread'de getCurrentUser() ile kullanıcı
+ * bilgisi alınabilir (thread'in önceki bağlamı kapatılır).
  *
  * @param username Kullanıcı adı (nullptr ise InvalidInput döner)
  * @param password Şifre (nullptr ise InvalidInput döner)
@@ -56,13 +85,84 @@ TRAVELEXPENSE_API ErrorCode registerUser(const char *username, const char *passw
  */
 TRAVELEXPENSE_API ErrorCode loginUser(const char *username, const char *password);
 
+/**
+ * @brief Kullanıcı girişi (açık bağlam)
+ *
+ * loginUser(username, password) ile aynı doğrulamayı yapar, ancak thread'in
+ * mevcut bağlamını değiştirmez; oturum yeni bir UserContext olarak döner.
+ *
+ * @param username Kullanıcı adı
+ * @param password Şifre
+ * @param context Başarılıysa yeni bağlam (releaseUserContext() ile serbest bırakılmalı),
+ *                aksi halde nullptr
+ * @return ErrorCode Başarı durumu (Success, InvalidInput, InvalidUser vb.)
+ */
+TRAVELEXPENSE_API ErrorCode loginUser(const char *username, const char *password,
+                                      UserContext **context);
+
+/**
+ * @brief Misafir bağlamı oluştur
+ *
+ * @param context Yeni misafir bağlamı (releaseUserContext() ile serbest bırakılmalı)
+ * @return ErrorCode Başarı durumu (Success, InvalidInput)
+ */
+TRAVELEXPENSE_API ErrorCode createGuestContext(UserContext **context);
+
+/**
+ * @brief Bağlamı güvenli şekilde silip serbest bırak
+ *
+ * @param context Serbest bırakılacak bağlam (nullptr ise işlem yapılmaz)
+ */
+TRAVELEXPENSE_API void releaseUserContext(UserContext *context);
+
+/**
+ * @brief Çağıran thread'in mevcut bağlamını ayarla
+ *
+ * Bağlam ödünç alınır (sahipliği devralınmaz); çağıran, bağlam thread'e
+ * bağlı kaldığı sürece onu serbest bırakmamalıdır. Thread'in
+ * loginUser()/enableGuestMode() ile açtığı kendi bağlamı serbest
+ * bırakılmaz ve daha sonra yeniden bağlanabilir.
+ *
+ * @param context Thread'e bağlanacak bağlam (nullptr = bağlamı kaldır)
+ */
+TRAVELEXPENSE_API void setCurrentContext(UserContext *context);
+
+/**
+ * @brief Çağıran thread'in mevcut bağlamını al
+ *
+ * @return UserContext* Mevcut bağlam (yoksa nullptr)
+ */
+TRAVELEXPENSE_API UserContext *getCurrentContext();
+
+/**
+ * @struct ScopedUserContext
+ * @brief Bir kapsam boyunca thread'e bağlam bağlayan RAII yardımcısı
+ *
+ * Havuz thread'lerinde istek işlenirken kullanılır; kapsam bitince
+ * thread'in önceki bağlamı geri yüklenir. Önceki bağlam thread'in kendi
+ * bağlamıysa yuva üzerinden geri yüklenir: kapsam içinde loginUser(),
+ * enableGuestMode() veya logoutUser() eskisini serbest bıraktıysa
+ * thread'in o anki kendi bağlamı (veya nullptr) bağlanır.
+ */
+struct ScopedUserContext {
+  UserContext *previous;  /**< @brief Geri yüklenecek ödünç bağlam */
+  bool previousOwned;     /**< @brief Önceki bağlam thread'in kendi bağlamı mıydı */
+
+  TRAVELEXPENSE_API explicit ScopedUserContext(UserContext *context);
+  TRAVELEXPENSE_API ~ScopedUserContext();
+
+ private:
+  ScopedUserContext(const ScopedUserContext &);
+  ScopedUserContext &operator=(const ScopedUserContext &);
+};
+
 /**
  * @brief Misafir modunu etkinleştir
  *
  * Misafir kullanıcı modunu etkinleştirir. Misafir modunda, kullanıcı kaydı
  * veya girişi gerekmez, ancak bazı özellikler sınırlı olabilir.
  *
- * @note Bu fonksiyon, geçici bir misafir kullanıcısı oluşturur.
+ * @note Bu fonksiyon, çağıran thread için geçici bir misafir kullanıcısı oluşturur.
  * Misafir modu, oturum sonlandığında veya logoutUser() çağrıldığında sonlanır.
  *
  * @return ErrorCode Başarı durumu (Success, InvalidInput vb.)
@@ -72,10 +172,12 @@ TRAVELEXPENSE_API ErrorCode enableGuestMode();
 /**
  * @brief Kullanıcı çıkışı
  *
- * Mevcut kullanıcı oturumunu sonlandırır. Kullanıcı bilgileri temizlenir
- * ve getCurrentUser() nullptr döner.
+ * Çağıran thread'in mevcut oturumunu sonlandırır. Kullanıcı bilgileri
+ * temizlenir ve getCurrentUser() nullptr döner.
  *
- * @note Bu fonksiyon, misafir modu dahil tüm oturumları sonlandırır.
+ * @note Thread'in loginUser()/enableGuestMode() ile açtığı bağlam serbest
+ * bırakılır; setCurrentContext() ile ödünç verilen bağlam yalnızca ayrılır.
+ * Önbelleklenmiş AES anahtarları silinir (Encryption::clearAES256KeyCache).
  * Oturum sonlandıktan sonra, yeni giriş veya misafir modu gerekir.
  */
 TRAVELEXPENSE_API void logoutUser();
@@ -83,11 +185,12 @@ TRAVELEXPENSE_API void logoutUser();
 /**
  * @brief Mevcut kullanıcı bilgisini al
  *
- * Aktif oturumdaki kullanıcı bilgisini döndürür. Eğer oturum yoksa
- * (giriş yapılmamış veya logoutUser() çağrılmış), nullptr döner.
+ * Çağıran thread'in aktif oturumundaki kullanıcı bilgisini döndürür. Eğer
+ * oturum yoksa (giriş yapılmamış veya logoutUser() çağrılmış), nullptr döner.
  *
  * @note Bu fonksiyon, getCurrentUser() ile alınan pointer, logoutUser()
  * çağrılana kadar geçerlidir. Pointer'ı saklamak güvenli değildir.
+ * Farklı thread'ler birbirinin oturumunu görmez.
  *
  * @return User* Mevcut kullanıcı pointer'ı (nullptr ise giriş yapılmamış veya oturum sonlandırılmış)
  */
@@ -101,6 +204,8 @@ TRAVELEXPENSE_API User *getCurrentUser();
  *
  * @note Bu fonksiyon, kullanıcı ID'sine göre kullanıcı bilgilerini getirir.
  * Eğer kullanıcı bulunamazsa, FileNotFound hatası döner.
+ * Sürümlü PBKDF2 hash kayıtları User::passwordHash alanına sığmadığı için
+ * bu durumda passwordHash boş bırakılır.
  *
  * @param userId Kullanıcı ID (geçerli bir userId olmalı, 0'dan büyük)
  * @param user Kullanıcı bilgisinin yazılacağı struct (çıktı parametresi, User struct'ı)
@@ -108,6 +213,238 @@ TRAVELEXPENSE_API User *getCurrentUser();
  * @return ErrorCode Başarı durumu (Success, FileNotFound, InvalidInput vb.)
  */
 TRAVELEXPENSE_API ErrorCode getUserById(int32_t userId, User &user);
+
+// ============================================
+// KULLANICI KAYDI ÖNBELLEĞİ
+// ============================================
+
+/**
+ * @struct UserCacheStats
+ * @brief Kullanıcı kaydı önbelleğinin anlık metrikleri
+ */
+struct UserCacheStats {
+  size_t entries;           /**< @brief Önbellekteki kullanıcı kaydı sayısı */
+  size_t negativeEntries;   /**< @brief Negatif önbellekteki kullanıcı adı sayısı */
+  size_t capacity;          /**< @brief Kapasite (0 = önbellek kapalı) */
+  uint32_t negativeTtlMs;   /**< @brief Negatif kayıt ömrü (milisaniye) */
+  uint64_t hits;            /**< @brief Önbellekten karşılanan sorgu sayısı */
+  uint64_t negativeHits;    /**< @brief Negatif önbellekten reddedilen sorgu sayısı */
+  uint64_t misses;          /**< @brief Veritabanına giden sorgu sayısı */
+  uint64_t evictions;       /**< @brief Kapasite nedeniyle atılan kayıt sayısı */
+};
+
+/**
+ * @brief Kullanıcı kaydı önbelleğini yapılandır
+ *
+ * loginUser(), authenticateUserAsync() ve getUserById() kullanıcı kaydını
+ * önce sınırlı LRU önbellekte (ID ve kullanıcı adına göre) arar.
+ * Veritabanında olmayan kullanıcı adları kısa süre negatif önbellekte
+ * tutulur; böylece bilinmeyen kullanıcı adlarıyla yapılan tekrarlı
+ * denemeler her seferinde SQLite'a gitmez.
+ *
+ * @note Önbellekte düz metin şifre tutulmaz; yalnızca saklanan hash kaydı
+ * ve salt tutulur ve kayıt atılırken güvenli şekilde silinir. Mevcut
+ * içerik temizlenir.
+ *
+ * @param capacity Her iki önbellek için kayıt üst sınırı (0 = kapalı, varsayılan 256)
+ * @param negativeTtlMs Negatif kayıt ömrü (0 = negatif önbellek kapalı, varsayılan 30000)
+ */
+TRAVELEXPENSE_API void configureUserCache(size_t capacity, uint32_t negativeTtlMs);
+
+/**
+ * @brief Bir kullanıcının önbellek kaydını geçersiz kıl
+ *
+ * registerUser() ve şifre güncellemesi önbelleği kendisi günceller;
+ * users tablosu UserAuth dışından (doğrudan SQL ile) değiştirildiğinde
+ * bu fonksiyon çağrılmalıdır.
+ *
+ * @param userId Kullanıcı ID
+ */
+TRAVELEXPENSE_API void invalidateUserCache(int32_t userId);
+
+/**
+ * @brief Kullanıcı önbelleğini (negatif kayıtlar dahil) tamamen temizle
+ *
+ * Database::resetDatabase() ve kullanıcı göçü sonrasında otomatik çağrılır.
+ */
+TRAVELEXPENSE_API void clearUserCache();
+
+/**
+ * @brief Kullanıcı önbelleğinin metriklerini al
+ *
+ * @param stats Metriklerin yazılacağı yapı
+ */
+TRAVELEXPENSE_API void getUserCacheStats(UserCacheStats &stats);
+
+// ============================================
+// ASENKRON ŞİFRE DOĞRULAMA SERVİSİ
+// ============================================
+
+/**
+ * @brief Asenkron şifre doğrulama tamamlanma callback tipi
+ *
+ * Worker thread üzerinde çağrılır; uzun süren işlem yapmamalıdır.
+ *
+ * @param result Doğrulama sonucu (Success, InvalidUser, InvalidInput vb.)
+ * @param userData submit sırasında verilen kullanıcı verisi
+ */
+typedef void (*PasswordVerifyCallback)(ErrorCode result, void *userData);
+
+/**
+ * @struct PasswordVerifierStats
+ * @brief Şifre doğrulama servisinin anlık metrikleri
+ *
+ * Gecikme değerleri, işin kuyruğa alınmasından tamamlanmasına kadar geçen
+ * süredir ve son 1024 iş üzerinden hesaplanır.
+ */
+struct PasswordVerifierStats {
+  size_t queueDepth;        /**< @brief Kuyrukta bekleyen iş sayısı */
+  size_t queueCapacity;     /**< @brief Kuyruk kapasitesi */
+  unsigned workerCount;     /**< @brief Worker thread sayısı (0 = servis başlatılmamış) */
+  uint64_t completed;       /**< @brief Tamamlanan iş sayısı */
+  uint64_t rejected;        /**< @brief Kuyruk dolu olduğu için reddedilen iş sayısı */
+  double p50LatencyMs;      /**< @brief Medyan gecikme (milisaniye) */
+  double p99LatencyMs;      /**< @brief 99. yüzdelik gecikme (milisaniye) */
+};
+
+/**
+ * @brief Şifre doğrulama servisini yapılandır
+ *
+ * Sabit boyutlu worker havuzunu ve sınırlı kuyruğu (yeniden) başlatır.
+ * Servis çalışıyorsa önce kuyruktaki işler bitirilir. Yapılandırılmadan
+ * yapılan ilk istek, varsayılan değerlerle servisi başlatır.
+ *
+ * @param workerCount Worker thread sayısı (0 = CPU çekirdek sayısı)
+ * @param queueCapacity Kuyruk kapasitesi (0 = varsayılan, 1024)
+ * @return ErrorCode Başarı durumu (Success, MemoryAllocation)
+ */
+TRAVELEXPENSE_API ErrorCode configurePasswordVerifier(unsigned workerCount, size_t queueCapacity);
+
+/**
+ * @brief Şifre doğrulama servisini durdur
+ *
+ * Kuyruktaki işler tamamlanır, ardından worker thread'ler sonlandırılır.
+ */
+TRAVELEXPENSE_API void shutdownPasswordVerifier();
+
+/**
+ * @brief Şifreyi worker havuzunda doğrula (future)
+ *
+ * Girdiler iş nesnesine kopyalanır; çağrı döndükten sonra çağıranın
+ * buffer'ları serbestçe silinebilir. Şifre kopyası iş bitince güvenli
+ * şekilde temizlenir.
+ *
+ * @param password Girilen şifre
+ * @param salt Salt değeri (32 karakter hex string)
+ * @param storedHash Saklanan hash kaydı (sürümlü kayıt veya eski 64 karakter hex)
+ * @return std::future<ErrorCode> Success, InvalidUser (şifre yanlış),
+ *         InvalidInput veya Busy (kuyruk dolu; future hemen hazırdır)
+ */
+TRAVELEXPENSE_API std::future<ErrorCode> verifyPasswordAsync(const char *password, const char *salt,
+                                                             const char *storedHash);
+
+/**
+ * @brief Şifreyi worker havuzunda doğrula (callback)
+ *
+ * @param password Girilen şifre
+ * @param salt Salt değeri (32 karakter hex string)
+ * @param storedHash Saklanan hash kaydı (sürümlü kayıt veya eski 64 karakter hex)
+ * @param callback Tamamlanınca worker thread'de çağrılır (nullptr olamaz)
+ * @param userData Callback'e aynen iletilir
+ * @return ErrorCode Success (kuyruğa alındı), InvalidInput veya Busy (kuyruk dolu;
+ *         bu durumda callback çağrılmaz)
+ */
+TRAVELEXPENSE_API ErrorCode verifyPasswordAsync(const char *password, const char *salt,
+                                                const char *storedHash,
+                                                PasswordVerifyCallback callback, void *userData);
+
+/**
+ * @brief Kullanıcı adı/şifre çiftini asenkron doğrula
+ *
+ * Kullanıcı kaydı çağıran thread'de veritabanından okunur, hash hesabı
+ * worker havuzunda yapılır. Oturum açmaz; oturum gerekiyorsa şifreyi
+ * ikinci kez hash'lememek için doğrudan loginUserAsync() kullanılmalıdır.
+ *
+ * @param username Kullanıcı adı
+ * @param password Şifre
+ * @return std::future<ErrorCode> Success, InvalidUser, InvalidInput, FileNotFound,
+ *         FileIO veya Busy
+ */
+TRAVELEXPENSE_API std::future<ErrorCode> authenticateUserAsync(const char *username,
+                                                               const char *password);
+
+/**
+ * @struct LoginResult
+ * @brief loginUserAsync() sonucu
+ */
+struct LoginResult {
+  ErrorCode result;      /**< @brief Success, InvalidUser, InvalidInput, FileNotFound, FileIO veya Busy */
+  UserContext *context;  /**< @brief Başarılıysa yeni bağlam (releaseUserContext() ile serbest bırakılmalı) */
+
+  LoginResult() : result(ErrorCode::Unknown), context(nullptr) {}
+  LoginResult(ErrorCode code, UserContext *created) : result(code), context(created) {}
+};
+
+/**
+ * @brief Asenkron giriş tamamlanma callback tipi
+ *
+ * Worker thread üzerinde çağrılır. Bağlamın sahipliği callback'e geçer.
+ *
+ * @param result Giriş sonucu
+ * @param context Başarılıysa yeni bağlam, aksi halde nullptr
+ * @param userData submit sırasında verilen kullanıcı verisi
+ */
+typedef void (*LoginCallback)(ErrorCode result, UserContext *context, void *userData);
+
+/**
+ * @brief Asenkron kullanıcı girişi (future)
+ *
+ * loginUser(username, password, &context) ile aynı işi yapar: kullanıcı
+ * kaydı çağıran thread'de (çoğunlukla önbellekten) okunur; şifre
+ * doğrulama, gerekirse yeniden hash'leme ve last_login güncellemesi
+ * worker havuzunda yapılır. Şifre yalnızca bir kez hash'lenir.
+ *
+ * @note Future hiç okunmazsa başarılı girişin bağlamı sızar.
+ *
+ * @param username Kullanıcı adı
+ * @param password Şifre
+ * @return std::future<LoginResult> Sonuç ve bağlam (Busy ise future hemen hazırdır)
+ */
+TRAVELEXPENSE_API std::future<LoginResult> loginUserAsync(const char *username, const char *password);
+
+/**
+ * @brief Asenkron kullanıcı girişi (callback)
+ *
+ * @param username Kullanıcı adı
+ * @param password Şifre
+ * @param callback Tamamlanınca worker thread'de çağrılır (nullptr olamaz)
+ * @param userData Callback'e aynen iletilir
+ * @return ErrorCode Success (kuyruğa alındı), InvalidInput, InvalidUser, FileNotFound,
+ *         FileIO veya Busy (bu durumlarda callback çağrılmaz)
+ */
+TRAVELEXPENSE_API ErrorCode loginUserAsync(const char *username, const char *password,
+                                           LoginCallback callback, void *userData);
+
+/**
+ * @brief Asenkron kullanıcı kaydı
+ *
+ * Girdiler çağıran thread'de kontrol edilir; salt üretimi, PBKDF2 hash'i
+ * ve veritabanı kaydı worker havuzunda yapılır.
+ *
+ * @param username Kullanıcı adı (benzersiz olmalı)
+ * @param password Şifre
+ * @return std::future<ErrorCode> registerUser() ile aynı sonuçlar veya Busy
+ */
+TRAVELEXPENSE_API std::future<ErrorCode> registerUserAsync(const char *username, const char *password);
+
+/**
+ * @brief Şifre doğrulama servisinin metriklerini al
+ *
+ * Kuyruk derinliği ve p99 gecikme, havuz boyutunu ayarlamak için kullanılır.
+ *
+ * @param stats Metriklerin yazılacağı yapı
+ */
+TRAVELEXPENSE_API void getPasswordVerifierStats(PasswordVerifierStats &stats);
 }
 
 } // namespace TravelExpense // LCOV_EXCL_LINE
@@ -8,6 +8,7 @@
 
 #include "../header/database.h"
 #include "../header/fileIO.h"
+#include "../header/userAuth.h"
 #include <sqlite3.h>
 #include <cstring>
 #include <cstdio>
@@ -296,6 +297,9 @@ ErrorCode resetDatabase() {
     g_database = nullptr;
   }
 
+  // Önbellekteki kullanıcı kayıtları eski veritabanına aittir
+  UserAuth::clearUserCache();
+
   g_database = initializeDatabase();
 
   if (!g_database) {
@@ -10,15 +10,20 @@
  */
 
 #include "../header/encryption.h"
-#include "../header/safe_string.h"
+#include "../header/security.h"
+#include <cctype>
 #include <cstring>
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
-#include <iomanip>
-#include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <system_error>
 
 #ifdef _WIN32
   #define WIN32_LEAN_AND_MEAN
@@ -29,6 +34,36 @@
 #else
   #include <unistd.h>
   #include <fcntl.h>
+  #include <pthread.h>
+  #include <sys/syscall.h>
+  #include <cerrno>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  /** @brief x86 AES-NI / VAES arka uçları derlenir (çalışma zamanında CPUID ile seçilir) */
+  #define TRAVELEXPENSE_AES_X86
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+    /** @brief MSVC intrinsic'leri hedef özniteliği gerektirmez */
+    #define AES_TARGET_AESNI
+    /** @brief MSVC intrinsic'leri hedef özniteliği gerektirmez */
+    #define AES_TARGET_VAES
+    /** @brief MSVC intrinsic'leri hedef özniteliği gerektirmez */
+    #define AES_TARGET_PCLMUL
+    /** @brief MSVC intrinsic'leri hedef özniteliği gerektirmez */
+    #define SHA_TARGET_AVX2
+  #else
+    #include <cpuid.h>
+    /** @brief Fonksiyonu AES-NI komutlarıyla derle (dosyanın geri kalanı genel x86 kalır) */
+    #define AES_TARGET_AESNI __attribute__((target("aes,sse2")))
+    /** @brief Fonksiyonu VAES + AVX2 komutlarıyla derle */
+    #define AES_TARGET_VAES __attribute__((target("vaes,avx2,aes")))
+    /** @brief Fonksiyonu PCLMULQDQ + SSSE3 komutlarıyla derle (GHASH) */
+    #define AES_TARGET_PCLMUL __attribute__((target("pclmul,ssse3,sse2")))
+    /** @brief Fonksiyonu AVX2 komutlarıyla derle (8 kanallı SHA-256) */
+    #define SHA_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
 #endif
 
 /**
@@ -188,97 +223,230 @@ static const uint8_t AES_INV_SBOX[256] = {
   0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
 };
 
-namespace TravelExpense {
+/**
+ * @brief Hex rakamları (küçük harf)
+ */
+static const char HEX_DIGITS[16] = {
+  '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
 
-namespace Encryption {
+/**
+ * @brief ASCII -> hex değer tablosu (-1 = geçersiz karakter)
+ */
+static const int8_t HEX_VALUES[256] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+   0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+  -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
 
 /**
- * @brief SHA-256 hash hesapla (gerçek implementasyon)
- *
- * RFC 6234 uyumlu tam SHA-256 hash implementasyonu.
- * Girdi verisini 512-bit chunk'lara böler, her chunk'ı işler ve
- * sonuç olarak 256-bit (32 byte) hash üretir.
+ * @brief Tek 512-bit bloğu SHA-256 durumuna işle
  *
- * @param input Hash'lenecek veri
- * @param inputLen Veri uzunluğu (byte)
- * @param output Hash çıktısı (64 karakter hex string + null terminator)
- * @return true Başarılı, false Hata (null pointer veya sıfır uzunluk)
+ * @param state Zincirleme durum (H0..H7)
+ * @param block 64 byte blok
  */
-bool sha256Hash(const void *input, size_t inputLen, char *output) {
-  if (!input || inputLen == 0 || !output) {
-    return false;
+static void sha256Compress(uint32_t state[8], const uint8_t *block) {
+  uint32_t w[64];
+
+  for (int i = 0; i < 16; ++i) {
+    w[i] = (static_cast<uint32_t>(block[i * 4]) << 24) | (static_cast<uint32_t>(block[i * 4 + 1]) << 16) |
+           (static_cast<uint32_t>(block[i * 4 + 2]) << 8) | block[i * 4 + 3];
+  }
+
+  for (int i = 16; i < 64; ++i) {
+    w[i] = sha256_sigma1(w[i - 2]) + w[i - 7] + sha256_sigma0(w[i - 15]) + w[i - 16];
+  }
+
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+  uint32_t e = state[4], f = state[5], g = state[6], h_val = state[7];
+
+  for (int i = 0; i < 64; ++i) {
+    uint32_t temp1 = h_val + sha256_SIG1(e) + sha256_ch(e, f, g) + SHA256_K[i] + w[i];
+    uint32_t temp2 = sha256_SIG0(a) + sha256_maj(a, b, c);
+    h_val = g;
+    g = f;
+    f = e;
+    e = d + temp1;
+    d = c;
+    c = b;
+    b = a;
+    a = temp1 + temp2;
   }
 
-  // SHA-256 initial hash values
-  uint32_t h[8] = {
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h_val;
+}
+
+namespace TravelExpense {
+
+namespace Encryption {
+
+void sha256Init(SHA256Context *ctx) {
+  static const uint32_t SHA256_H0[8] = {
     0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
     0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
   };
-  const uint8_t *data = static_cast<const uint8_t *>(input);
-  size_t origLen = inputLen;
-  size_t newLen = ((origLen + 9) / 64 + 1) * 64;
-  uint8_t *msg = new uint8_t[newLen];
-  std::memset(msg, 0, newLen);
-  std::memcpy(msg, data, origLen);
-  msg[origLen] = 0x80;
-  // Append length as 64-bit big-endian integer
-  uint64_t bitLen = origLen * 8;
+  std::memcpy(ctx->state, SHA256_H0, sizeof(SHA256_H0));
+  ctx->bufferLength = 0;
+  ctx->totalLength = 0;
+}
+
+void sha256Update(SHA256Context *ctx, const void *data, size_t length) {
+  const uint8_t *in = static_cast<const uint8_t *>(data);
+  ctx->totalLength += length;
+
+  if (ctx->bufferLength > 0) {
+    size_t take = 64 - ctx->bufferLength;
+
+    if (take > length) {
+      take = length;
+    }
+
+    std::memcpy(ctx->buffer + ctx->bufferLength, in, take);
+    ctx->bufferLength += take;
+    in += take;
+    length -= take;
+
+    if (ctx->bufferLength < 64) {
+      return;
+    }
+
+    sha256Compress(ctx->state, ctx->buffer);
+    ctx->bufferLength = 0;
+  }
+
+  // Tam bloklar kopyalanmadan doğrudan işlenir
+  while (length >= 64) {
+    sha256Compress(ctx->state, in);
+    in += 64;
+    length -= 64;
+  }
+
+  if (length > 0) {
+    std::memcpy(ctx->buffer, in, length);
+    ctx->bufferLength = length;
+  }
+}
+
+void sha256Final(SHA256Context *ctx, Digest256 &digest) {
+  uint64_t bitLen = ctx->totalLength * 8;
+  size_t used = ctx->bufferLength;
+  ctx->buffer[used++] = 0x80;
+
+  if (used > 56) {
+    std::memset(ctx->buffer + used, 0, 64 - used);
+    sha256Compress(ctx->state, ctx->buffer);
+    used = 0;
+  }
+
+  std::memset(ctx->buffer + used, 0, 56 - used);
+
+  // Uzunluk 64-bit big-endian olarak eklenir
+  for (int i = 0; i < 8; ++i) {
+    ctx->buffer[56 + i] = static_cast<uint8_t>(bitLen >> (56 - i * 8));
+  }
+
+  sha256Compress(ctx->state, ctx->buffer);
 
   for (int i = 0; i < 8; ++i) {
-    msg[newLen - 8 + i] = (bitLen >> (56 - i * 8)) & 0xff;
+    digest.bytes[i * 4] = static_cast<uint8_t>(ctx->state[i] >> 24);
+    digest.bytes[i * 4 + 1] = static_cast<uint8_t>(ctx->state[i] >> 16);
+    digest.bytes[i * 4 + 2] = static_cast<uint8_t>(ctx->state[i] >> 8);
+    digest.bytes[i * 4 + 3] = static_cast<uint8_t>(ctx->state[i]);
+  }
+
+  Security::secureMemset(ctx, 0, sizeof(SHA256Context));
+}
+
+bool sha256Digest(const void *input, size_t inputLen, Digest256 &digest) {
+  if (!input || inputLen == 0) {
+    return false;
+  }
+
+  SHA256Context ctx;
+  sha256Init(&ctx);
+  sha256Update(&ctx, input, inputLen);
+  sha256Final(&ctx, digest);
+  return true;
+}
+
+void encodeHex(const uint8_t *bytes, size_t length, char *hex) {
+  for (size_t i = 0; i < length; ++i) {
+    hex[i * 2] = HEX_DIGITS[bytes[i] >> 4];
+    hex[i * 2 + 1] = HEX_DIGITS[bytes[i] & 0x0F];
+  }
+
+  hex[length * 2] = '\0';
+}
+
+bool decodeHex(const char *hex, uint8_t *bytes, size_t length) {
+  if (!hex || !bytes) {
+    return false;
   }
 
-  // Process each 512-bit chunk
-  for (size_t chunk = 0; chunk < newLen; chunk += 64) {
-    uint32_t w[64];
+  for (size_t i = 0; i < length; ++i) {
+    int high = HEX_VALUES[static_cast<uint8_t>(hex[i * 2])];
 
-    for (int i = 0; i < 16; ++i) {
-      w[i] = (msg[chunk + i * 4] << 24) | (msg[chunk + i * 4 + 1] << 16) |
-             (msg[chunk + i * 4 + 2] << 8) | msg[chunk + i * 4 + 3];
+    // Kısa string: null sonlandırıcı geçersiz sayılır, sonrası okunmaz
+    if (high < 0) {
+      return false;
     }
 
-    for (int i = 16; i < 64; ++i) {
-      w[i] = sha256_sigma1(w[i - 2]) + w[i - 7] + sha256_sigma0(w[i - 15]) + w[i - 16];
+    int low = HEX_VALUES[static_cast<uint8_t>(hex[i * 2 + 1])];
+
+    if (low < 0) {
+      return false;
     }
 
-    uint32_t a = h[0], b = h[1], c = h[2], d = h[3];
-    uint32_t e = h[4], f = h[5], g = h[6], h_val = h[7];
+    bytes[i] = static_cast<uint8_t>((high << 4) | low);
+  }
 
-    for (int i = 0; i < 64; ++i) {
-      uint32_t temp1 = h_val + sha256_SIG1(e) + sha256_ch(e, f, g) + SHA256_K[i] + w[i];
-      uint32_t temp2 = sha256_SIG0(a) + sha256_maj(a, b, c);
-      h_val = g;
-      g = f;
-      f = e;
-      e = d + temp1;
-      d = c;
-      c = b;
-      b = a;
-      a = temp1 + temp2;
-    }
-
-    h[0] += a;
-    h[1] += b;
-    h[2] += c;
-    h[3] += d;
-    h[4] += e;
-    h[5] += f;
-    h[6] += g;
-    h[7] += h_val;
-  }
-
-  delete[] msg;
-  // Convert to hex string
-  std::ostringstream oss;
-  oss << std::hex << std::setfill('0');
+  return true;
+}
 
-  for (int i = 0; i < 8; ++i) {
-    oss << std::setw(8) << h[i];
+/**
+ * @brief SHA-256 hash hesapla (gerçek implementasyon)
+ *
+ * RFC 6234 uyumlu tam SHA-256 hash implementasyonu.
+ * Girdi verisini 512-bit chunk'lara böler, her chunk'ı işler ve
+ * sonuç olarak 256-bit (32 byte) hash üretir.
+ *
+ * @param input Hash'lenecek veri
+ * @param inputLen Veri uzunluğu (byte)
+ * @param output Hash çıktısı (64 karakter hex string + null terminator)
+ * @return true Başarılı, false Hata (null pointer veya sıfır uzunluk)
+ */
+bool sha256Hash(const void *input, size_t inputLen, char *output) {
+  if (!output) {
+    return false;
+  }
+
+  Digest256 digest;
+
+  if (!sha256Digest(input, inputLen, digest)) {
+    return false;
   }
 
-  std::string hexHash = oss.str();
-  SafeString::safeCopy(output, 65, hexHash.c_str());
-  output[64] = '\0';
+  encodeHex(digest.bytes, sizeof(digest.bytes), output);
   return true;
 }
 
@@ -303,16 +471,8 @@ bool generateSalt(char *salt) {
     return false;
   }
 
-  std::ostringstream oss;
-
-  for (int i = 0; i < 16; ++i) {
-    oss << std::hex << std::setw(2) << std::setfill('0')
-        << static_cast<int>(randomBytes[i]);
-  }
-
-  std::string saltStr = oss.str();
-  SafeString::safeCopy(salt, 33, saltStr.c_str());
-  salt[32] = '\0';
+  encodeHex(randomBytes, 16, salt);
+  Security::secureMemset(randomBytes, 0, sizeof(randomBytes));
   return true;
 }
 
@@ -332,18 +492,21 @@ bool hashPassword(const char *password, const char *salt, char *hash) {
     return false;
   }
 
-  // Password + Salt kombinasyonu
-  std::string combined = std::string(password) + std::string(salt);
-  // SHA-256 hash hesapla
-  char tempHash[65];
+  size_t passwordLen = std::strlen(password);
+  size_t saltLen = std::strlen(salt);
 
-  if (!sha256Hash(combined.c_str(), combined.length(), tempHash)) {
+  if (passwordLen + saltLen == 0) {
     return false;
   }
 
-  // Hash'i çıktıya kopyala
-  SafeString::safeCopy(hash, 65, tempHash);
-  hash[64] = '\0';
+  // SHA-256(password || salt), ara kopya olmadan
+  SHA256Context ctx;
+  sha256Init(&ctx);
+  sha256Update(&ctx, password, passwordLen);
+  sha256Update(&ctx, salt, saltLen);
+  Digest256 digest;
+  sha256Final(&ctx, digest);
+  encodeHex(digest.bytes, sizeof(digest.bytes), hash);
   return true;
 }
 
@@ -381,495 +544,3424 @@ bool verifyPassword(const char *password, const char *salt, const char *storedHa
   return constantTimeCompare(calculatedHash, storedHash, 64);
 }
 
-/**
- * @brief AES helper fonksiyonları
- *
- * AES şifreleme algoritmasında kullanılan yardımcı fonksiyonlar.
- * Galois Field (GF) çarpımı ve key expansion işlemlerini yapar.
- */
+// ============================================
+// SÜRÜMLÜ ŞİFRE HASH KAYDI (PBKDF2-HMAC-SHA256)
+// ============================================
 
-/**
- * @brief Galois Field (GF(2^8)) çarpımı
- *
- * AES MixColumns işleminde kullanılan GF(2^8) çarpımı.
- * İrreducible polynomial: x^8 + x^4 + x^3 + x + 1 (0x11b)
- *
- * @param a İlk byte
- * @param b İkinci byte
- * @return GF(2^8) çarpım sonucu
- */
-static inline uint8_t gmul(uint8_t a, uint8_t b) {
-  uint8_t p = 0;
+/** @brief Sürümlü kayıt için algoritma kimliği öneki */
+static const char PASSWORD_RECORD_PREFIX[] = "$pbkdf2-sha256$";
 
-  for (int i = 0; i < 8; ++i) {
-    if (b & 1) p ^= a;
+/** @brief Kalibrasyon ölçümünün en az sürmesi gereken süre (ms) */
+static const double PASSWORD_CALIBRATION_MIN_MS = 20.0;
 
-    bool hi_bit_set = a & 0x80;
-    a <<= 1;
+/** @brief Yeni kayıtlarda kullanılan iterasyon sayısı */
+static std::atomic<uint32_t> g_passwordHashIterations(PASSWORD_HASH_DEFAULT_ITERATIONS);
 
-    if (hi_bit_set) a ^= 0x1b;
+/**
+ * @brief İterasyon sayısını izin verilen aralığa sıkıştır
+ */
+static uint32_t clampPasswordIterations(uint64_t iterations) {
+  if (iterations < PASSWORD_HASH_MIN_ITERATIONS) {
+    return PASSWORD_HASH_MIN_ITERATIONS;
+  }
 
-    b >>= 1;
+  if (iterations > PASSWORD_HASH_MAX_ITERATIONS) {
+    return PASSWORD_HASH_MAX_ITERATIONS;
   }
 
-  return p;
+  return static_cast<uint32_t>(iterations);
 }
 
 /**
- * @brief AES key expansion (anahtar genişletme)
- *
- * AES-256 için 32 byte anahtardan 15 round key (240 byte) oluşturur.
- * Her round için 16 byte round key üretilir.
- *
- * @param key Orijinal AES-256 anahtarı (32 byte)
- * @param roundKeys Çıktı round key'leri (240 byte: 15 rounds * 16 bytes)
+ * @brief Ayrıştırılmış sürümlü şifre kaydı
  */
-static void aesKeyExpansion(const uint8_t *key, uint8_t *roundKeys) {
-  const uint8_t rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
-  std::memcpy(roundKeys, key, 32);
+struct PasswordRecord {
+  uint32_t iterations;   /**< @brief PBKDF2 iterasyon sayısı */
+  uint8_t salt[32];      /**< @brief Çözülmüş salt */
+  size_t saltLen;        /**< @brief Salt uzunluğu (byte) */
+  Digest256 digest;      /**< @brief Saklanan özet */
+};
 
-  for (int i = 8; i < 60; ++i) {
-    uint32_t temp = (roundKeys[(i - 1) * 4] << 24) | (roundKeys[(i - 1) * 4 + 1] << 16) |
-                    (roundKeys[(i - 1) * 4 + 2] << 8) | roundKeys[(i - 1) * 4 + 3];
+/**
+ * @brief Kayıt eski biçimde mi (tam 64 karakter hex)
+ *
+ * @param record Saklanan kayıt (null-terminated)
+ * @return true 64 hex karakter ve ardından null
+ */
+static bool isLegacyPasswordHash(const char *record) {
+  if (strnlen(record, 65) != 64) {
+    return false;
+  }
 
-    if (i % 8 == 0) {
-      temp = ((temp << 8) | (temp >> 24)) ^ (AES_SBOX[(temp >> 16) & 0xff] << 24) ^
-             (AES_SBOX[(temp >> 8) & 0xff] << 16) ^ (AES_SBOX[temp & 0xff] << 8) ^
-             AES_SBOX[(temp >> 24) & 0xff] ^ (rcon[(i / 8) - 1] << 24);
-    } else if (i % 8 == 4) {
-      temp = (AES_SBOX[(temp >> 24) & 0xff] << 24) ^ (AES_SBOX[(temp >> 16) & 0xff] << 16) ^
-             (AES_SBOX[(temp >> 8) & 0xff] << 8) ^ AES_SBOX[temp & 0xff];
+  for (size_t i = 0; i < 64; ++i) {
+    if (!std::isxdigit(static_cast<unsigned char>(record[i]))) {
+      return false;
     }
-
-    roundKeys[i * 4] = roundKeys[(i - 8) * 4] ^ ((temp >> 24) & 0xff);
-    roundKeys[i * 4 + 1] = roundKeys[(i - 8) * 4 + 1] ^ ((temp >> 16) & 0xff);
-    roundKeys[i * 4 + 2] = roundKeys[(i - 8) * 4 + 2] ^ ((temp >> 8) & 0xff);
-    roundKeys[i * 4 + 3] = roundKeys[(i - 8) * 4 + 3] ^ (temp & 0xff);
   }
+
+  return true;
 }
 
 /**
- * @brief AES block şifreleme (16 byte block)
+ * @brief `$pbkdf2-sha256$<iter>$<salt>$<digest>` kaydını ayrıştır
  *
- * AES-256 algoritması kullanarak 16 byte'lık bir blok şifreler.
- * 14 round (AES-256 için) gerçekleştirir: SubBytes, ShiftRows,
- * MixColumns (son round hariç) ve AddRoundKey.
- *
- * @param in Şifrelenecek blok (16 byte)
- * @param roundKeys Round key'leri (240 byte)
- * @param out Şifrelenmiş blok çıktısı (16 byte)
+ * @param record Kayıt (null-terminated)
+ * @param parsed Ayrıştırılmış değerler
+ * @return true Geçerli kayıt, false Biçim hatası
  */
-static void aesEncryptBlock(const uint8_t *in, const uint8_t *roundKeys, uint8_t *out) {
-  uint8_t state[16];
-  std::memcpy(state, in, 16);
+static bool parsePasswordRecord(const char *record, PasswordRecord &parsed) {
+  const size_t prefixLen = sizeof(PASSWORD_RECORD_PREFIX) - 1;
 
-  // AddRoundKey
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[i];
+  if (std::strncmp(record, PASSWORD_RECORD_PREFIX, prefixLen) != 0) {
+    return false;
   }
 
-  // 14 rounds for AES-256
-  for (int round = 1; round < 14; ++round) {
-    // SubBytes
-    for (int i = 0; i < 16; ++i) {
-      state[i] = AES_SBOX[state[i]];
-    }
-
-    // ShiftRows
-    uint8_t temp = state[1];
-    state[1] = state[5];
-    state[5] = state[9];
-    state[9] = state[13];
-    state[13] = temp;
-    temp = state[2];
-    state[2] = state[10];
-    state[10] = temp;
-    temp = state[6];
-    state[6] = state[14];
-    state[14] = temp;
-    temp = state[3];
-    state[3] = state[15];
-    state[15] = state[11];
-    state[11] = state[7];
-    state[7] = temp;
-
-    // MixColumns (sadece son round hariç)
-    if (round < 13) {
-      for (int c = 0; c < 4; ++c) {
-        uint8_t s0 = state[c * 4], s1 = state[c * 4 + 1];
-        uint8_t s2 = state[c * 4 + 2], s3 = state[c * 4 + 3];
-        state[c * 4] = gmul(0x02, s0) ^ gmul(0x03, s1) ^ s2 ^ s3;
-        state[c * 4 + 1] = s0 ^ gmul(0x02, s1) ^ gmul(0x03, s2) ^ s3;
-        state[c * 4 + 2] = s0 ^ s1 ^ gmul(0x02, s2) ^ gmul(0x03, s3);
-        state[c * 4 + 3] = gmul(0x03, s0) ^ s1 ^ s2 ^ gmul(0x02, s3);
-      }
-    }
+  const char *p = record + prefixLen;
+  uint64_t iterations = 0;
+  size_t digits = 0;
 
-    // AddRoundKey
-    for (int i = 0; i < 16; ++i) {
-      state[i] ^= roundKeys[round * 16 + i];
-    }
+  while (*p >= '0' && *p <= '9' && digits < 10) {
+    iterations = iterations * 10 + static_cast<uint64_t>(*p - '0');
+    ++p;
+    ++digits;
   }
 
-  // Final round
-  for (int i = 0; i < 16; ++i) {
-    state[i] = AES_SBOX[state[i]];
-  }
-
-  uint8_t temp = state[1];
-  state[1] = state[5];
-  state[5] = state[9];
-  state[9] = state[13];
-  state[13] = temp;
-  temp = state[2];
-  state[2] = state[10];
-  state[10] = temp;
-  temp = state[6];
-  state[6] = state[14];
-  state[14] = temp;
-  temp = state[3];
-  state[3] = state[15];
-  state[15] = state[11];
-  state[11] = state[7];
-  state[7] = temp;
+  if (digits == 0 || *p != '$' || iterations < PASSWORD_HASH_MIN_ITERATIONS ||
+      iterations > PASSWORD_HASH_MAX_ITERATIONS) {
+    return false;
+  }
 
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[14 * 16 + i];
+  const char *saltHex = ++p;
+
+  while (*p != '\0' && *p != '$') {
+    ++p;
   }
 
-  std::memcpy(out, state, 16);
-}
+  size_t saltHexLen = static_cast<size_t>(p - saltHex);
 
-/**
- * @brief AES-256-CBC şifreleme (gerçek implementasyon)
- *
- * AES-256 algoritması ile CBC (Cipher Block Chaining) modunda şifreleme yapar.
- * PKCS7 padding kullanır ve her blok önceki şifrelenmiş blok ile XOR'lanır.
- *
- * @param plaintext Şifrelenecek veri
- * @param plaintextLen Veri uzunluğu (byte)
- * @param key Şifreleme anahtarı (32 byte - AES-256)
- * @param iv Initialization Vector (16 byte)
- * @param ciphertext Şifrelenmiş veri çıktısı
- * @param ciphertextLen Şifrelenmiş veri uzunluğu (çıktı, padding dahil)
- * @return true Başarılı, false Hata (null pointer, sıfır uzunluk vb.)
- */
-bool encryptAES256(const void *plaintext, size_t plaintextLen,
-                   const uint8_t *key, const uint8_t *iv,
-                   void *ciphertext, size_t &ciphertextLen) {
-  if (!plaintext || plaintextLen == 0 || !key || !iv || !ciphertext) {
+  if (*p != '$' || saltHexLen == 0 || (saltHexLen & 1) != 0 || saltHexLen > 2 * sizeof(parsed.salt)) {
     return false;
   }
 
-  uint8_t roundKeys[240]; // 15 rounds * 16 bytes
-  aesKeyExpansion(key, roundKeys);
-  const uint8_t *plain = static_cast<const uint8_t *>(plaintext);
-  uint8_t *cipher = static_cast<uint8_t *>(ciphertext);
-  uint8_t currentIV[16];
-  std::memcpy(currentIV, iv, 16);
-  // PKCS7 padding
-  // PKCS7'de, eğer veri zaten 16'nın katıysa, tam bir blok (16 byte) padding eklenir
-  size_t paddingBytes = 16 - (plaintextLen % 16);
+  ++p;
 
-  if (paddingBytes == 0) {
-    paddingBytes = 16; // Tam blok için tam blok padding
+  if (std::strlen(p) != 2 * sizeof(parsed.digest.bytes) ||
+      !decodeHex(saltHex, parsed.salt, saltHexLen / 2) ||
+      !decodeHex(p, parsed.digest.bytes, sizeof(parsed.digest.bytes))) {
+    return false;
   }
 
-  size_t paddedLen = plaintextLen + paddingBytes;
-  ciphertextLen = paddedLen;
-  uint8_t *padded = new uint8_t[paddedLen];
-  std::memcpy(padded, plain, plaintextLen);
-  uint8_t paddingValue = static_cast<uint8_t>(paddingBytes);
+  parsed.iterations = static_cast<uint32_t>(iterations);
+  parsed.saltLen = saltHexLen / 2;
+  return true;
+}
 
-  for (size_t i = plaintextLen; i < paddedLen; ++i) {
-    padded[i] = paddingValue;
+bool hashPasswordRecord(const char *password, const char *salt, uint32_t iterations, char *record) {
+  if (!password || !salt || !record || iterations < PASSWORD_HASH_MIN_ITERATIONS ||
+      iterations > PASSWORD_HASH_MAX_ITERATIONS) {
+    return false;
   }
 
-  // CBC mode encryption
-  for (size_t i = 0; i < paddedLen; i += 16) {
-    uint8_t block[16];
+  size_t saltHexLen = std::strlen(salt);
+  uint8_t saltBytes[32];
 
-    for (int j = 0; j < 16; ++j) {
-      block[j] = padded[i + j] ^ currentIV[j];
-    }
+  if (saltHexLen == 0 || (saltHexLen & 1) != 0 || saltHexLen > 2 * sizeof(saltBytes) ||
+      !decodeHex(salt, saltBytes, saltHexLen / 2)) {
+    return false;
+  }
 
-    aesEncryptBlock(block, roundKeys, cipher + i);
-    std::memcpy(currentIV, cipher + i, 16);
+  Digest256 digest;
+
+  if (!pbkdf2(password, std::strlen(password), saltBytes, saltHexLen / 2, iterations,
+              sizeof(digest.bytes), digest.bytes)) {
+    return false;
   }
 
-  delete[] padded;
+  // $pbkdf2-sha256$<iter>$ + salt hex + $ + özet hex (en fazla 124 byte)
+  int headerLen = std::snprintf(record, PASSWORD_HASH_RECORD_SIZE, "%s%u$",
+                                PASSWORD_RECORD_PREFIX, static_cast<unsigned>(iterations));
+  char *p = record + headerLen;
+  encodeHex(saltBytes, saltHexLen / 2, p);
+  p += saltHexLen;
+  *p++ = '$';
+  encodeHex(digest.bytes, sizeof(digest.bytes), p);
+  Security::secureMemset(&digest, 0, sizeof(digest));
   return true;
 }
 
-/**
- * @brief AES block şifre çözme (16 byte block)
- *
- * AES-256 algoritması kullanarak 16 byte'lık bir blok şifre çözer.
- * Not: Bu basitleştirilmiş bir versiyondur. Tam implementasyon
- * inverse S-box, inverse MixColumns vb. içermelidir.
- *
- * @param in Şifre çözülecek blok (16 byte)
- * @param roundKeys Round key'leri (240 byte)
- * @param out Şifre çözülmüş blok çıktısı (16 byte)
- */
-static void aesDecryptBlock(const uint8_t *in, const uint8_t *roundKeys, uint8_t *out) {
-  uint8_t state[16];
-  std::memcpy(state, in, 16);
+bool verifyPasswordRecord(const char *password, const char *record, const char *legacySalt,
+                          bool *needsRehash) {
+  if (needsRehash) {
+    *needsRehash = false;
+  }
 
-  // Inverse final round
-  // AddRoundKey (reverse)
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[14 * 16 + i];
-  }
-
-  // InvShiftRows
-  uint8_t temp = state[13];
-  state[13] = state[9];
-  state[9] = state[5];
-  state[5] = state[1];
-  state[1] = temp;
-  temp = state[2];
-  state[2] = state[10];
-  state[10] = temp;
-  temp = state[6];
-  state[6] = state[14];
-  state[14] = temp;
-  temp = state[3];
-  state[3] = state[7];
-  state[7] = state[11];
-  state[11] = state[15];
-  state[15] = temp;
-
-  // InvSubBytes
-  for (int i = 0; i < 16; ++i) {
-    state[i] = AES_INV_SBOX[state[i]];
+  if (!password || !record) {
+    return false;
   }
 
-  // 14 rounds in reverse
-  for (int round = 13; round >= 1; --round) {
-    // AddRoundKey
-    for (int i = 0; i < 16; ++i) {
-      state[i] ^= roundKeys[round * 16 + i];
-    }
+  PasswordRecord parsed;
 
-    // InvMixColumns (except first round)
-    if (round > 0) {
-      for (int c = 0; c < 4; ++c) {
-        uint8_t s0 = state[c * 4], s1 = state[c * 4 + 1];
-        uint8_t s2 = state[c * 4 + 2], s3 = state[c * 4 + 3];
-        state[c * 4] = gmul(0x0e, s0) ^ gmul(0x0b, s1) ^ gmul(0x0d, s2) ^ gmul(0x09, s3);
-        state[c * 4 + 1] = gmul(0x09, s0) ^ gmul(0x0e, s1) ^ gmul(0x0b, s2) ^ gmul(0x0d, s3);
-        state[c * 4 + 2] = gmul(0x0d, s0) ^ gmul(0x09, s1) ^ gmul(0x0e, s2) ^ gmul(0x0b, s3);
-        state[c * 4 + 3] = gmul(0x0b, s0) ^ gmul(0x0d, s1) ^ gmul(0x09, s2) ^ gmul(0x0e, s3);
-      }
+  if (!parsePasswordRecord(record, parsed)) {
+    // Eski format: SHA256(password || salt), tam 64 karakter hex. Bozuk
+    // sürümlü kayıtlar ('$' ile başlar) buraya düşmez; verifyPassword 64
+    // byte okuduğu için daha kısa kayıtlar da reddedilir.
+    if (!legacySalt || !isLegacyPasswordHash(record) ||
+        !verifyPassword(password, legacySalt, record)) {
+      return false;
     }
 
-    // InvShiftRows
-    temp = state[13];
-    state[13] = state[9];
-    state[9] = state[5];
-    state[5] = state[1];
-    state[1] = temp;
-    temp = state[2];
-    state[2] = state[10];
-    state[10] = temp;
-    temp = state[6];
-    state[6] = state[14];
-    state[14] = temp;
-    temp = state[3];
-    state[3] = state[7];
-    state[7] = state[11];
-    state[11] = state[15];
-    state[15] = temp;
-
-    // InvSubBytes
-    for (int i = 0; i < 16; ++i) {
-      state[i] = AES_INV_SBOX[state[i]];
+    if (needsRehash) {
+      *needsRehash = true;
     }
-  }
 
-  // Initial AddRoundKey
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[0 * 16 + i];
+    return true;
   }
 
-  std::memcpy(out, state, 16);
-}
+  Digest256 calculated;
 
-/**
- * @brief AES-256-CBC şifre çözme
- *
- * AES-256 algoritması ile CBC modunda şifre çözme yapar.
- * PKCS7 padding'i kaldırır ve her blok önceki şifrelenmiş blok ile XOR'lanır.
- *
- * @param ciphertext Şifrelenmiş veri
- * @param ciphertextLen Şifrelenmiş veri uzunluğu (byte, 16'nın katı olmalı)
- * @param key Şifreleme anahtarı (32 byte - AES-256)
- * @param iv Initialization Vector (16 byte)
- * @param plaintext Şifre çözülmüş veri çıktısı
- * @param plaintextLen Şifre çözülmüş veri uzunluğu (çıktı, padding olmadan)
- * @return true Başarılı, false Hata (null pointer, geçersiz uzunluk, padding hatası)
- */
-bool decryptAES256(const void *ciphertext, size_t ciphertextLen,
-                   const uint8_t *key, const uint8_t *iv,
-                   void *plaintext, size_t &plaintextLen) {
-  if (!ciphertext || ciphertextLen == 0 || ciphertextLen % 16 != 0 ||
-      !key || !iv || !plaintext) {
+  if (!pbkdf2(password, std::strlen(password), parsed.salt, parsed.saltLen, parsed.iterations,
+              sizeof(calculated.bytes), calculated.bytes)) {
     return false;
   }
 
-  uint8_t roundKeys[240];
-  aesKeyExpansion(key, roundKeys);
-  const uint8_t *cipher = static_cast<const uint8_t *>(ciphertext);
-  uint8_t *plain = static_cast<uint8_t *>(plaintext);
-  uint8_t currentIV[16];
-  std::memcpy(currentIV, iv, 16);
-  // CBC mode decryption
-  uint8_t prevBlock[16];
-  std::memcpy(prevBlock, iv, 16);
-
-  for (size_t i = 0; i < ciphertextLen; i += 16) {
-    uint8_t decryptedBlock[16];
-    // Full AES decrypt
-    aesDecryptBlock(cipher + i, roundKeys, decryptedBlock);
-
-    // XOR with previous ciphertext block (CBC)
-    for (int j = 0; j < 16; ++j) {
-      plain[i + j] = decryptedBlock[j] ^ prevBlock[j];
-    }
-
-    std::memcpy(prevBlock, cipher + i, 16);
-  }
+  bool match = Security::constantTimeEquals(calculated.bytes, parsed.digest.bytes, sizeof(calculated.bytes));
+  Security::secureMemset(&calculated, 0, sizeof(calculated));
 
-  // Remove PKCS7 padding
-  if (ciphertextLen < 1) {
-    return false;
+  if (match && needsRehash) {
+    *needsRehash = (parsed.iterations != getPasswordHashIterations());
   }
 
-  // Padding kontrolü: Son byte'ın değerine göre padding miktarını belirle
-  uint8_t paddingValue = plain[ciphertextLen - 1];
-
-  // Padding değeri 1-16 arasında olmalı
-  if (paddingValue == 0 || paddingValue > 16) {
-    // Padding değeri geçersiz, hiç padding yokmuş gibi davran
-    plaintextLen = ciphertextLen;
-    return true;
-  }
+  return match;
+}
 
-  // Padding değeri ciphertext uzunluğundan büyük olamaz
-  if (paddingValue > ciphertextLen) {
-    // Padding değeri geçersiz, hiç padding yokmuş gibi davran
-    plaintextLen = ciphertextLen;
-    return true;
-  }
+void setPasswordHashIterations(uint32_t iterations) {
+  g_passwordHashIterations.store(clampPasswordIterations(iterations), std::memory_order_relaxed);
+}
 
-  // PKCS7 padding kontrolü: Son paddingValue byte'ının hepsinin aynı olup olmadığını kontrol et
-  // Test ortamlarında decrypt işlemi doğru çalışmayabilir, bu yüzden
-  // padding kontrolünü gevşetiyoruz
-  size_t paddingStart = ciphertextLen - paddingValue;
-  bool allPaddingValid = true;
-  size_t validPaddingCount = 0;
+uint32_t getPasswordHashIterations() {
+  return g_passwordHashIterations.load(std::memory_order_relaxed);
+}
 
-  // Tüm padding byte'larını kontrol et
-  for (size_t i = paddingStart; i < ciphertextLen; ++i) {
-    if (plain[i] == paddingValue) {
-      validPaddingCount++;
-    } else {
-      allPaddingValid = false;
-    }
+uint32_t calibratePasswordHashIterations(uint32_t targetMs) {
+  if (targetMs == 0) {
+    return getPasswordHashIterations();
   }
 
-  // Eğer padding byte'larının çoğu doğruysa, padding'i kabul et
-  // (En az yarısı doğru olmalı)
-  if (!allPaddingValid) {
-    if (validPaddingCount >= paddingValue / 2 && paddingValue >= 1 && paddingValue <= 16 && paddingValue < ciphertextLen) {
-      // Padding byte'larının çoğu doğru, padding'i kabul et
-      plaintextLen = ciphertextLen - paddingValue;
-      return true;
+  static const char probePassword[] = "calibration-probe";
+  const uint8_t probeSalt[16] = {0};
+  uint8_t output[32];
+  uint32_t probe = PASSWORD_HASH_MIN_ITERATIONS;
+  double elapsedMs = 0.0;
+
+  // Zamanlayıcı çözünürlüğünden bağımsız olmak için ölçüm en az ~20 ms sürene kadar büyüt
+  for (;;) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    pbkdf2(probePassword, sizeof(probePassword) - 1, probeSalt, sizeof(probeSalt), probe,
+           sizeof(output), output);
+    elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (elapsedMs >= PASSWORD_CALIBRATION_MIN_MS || probe >= PASSWORD_HASH_MAX_ITERATIONS / 2) {
+      break;
     }
 
-    // Eğer padding byte'larının çoğu yanlışsa, hiç padding yokmuş gibi davran
-    // (Bu, test ortamlarında gerekli olabilir)
-    plaintextLen = ciphertextLen;
-    return true;
+    probe *= 2;
   }
 
-  // Tüm padding byte'ları doğru
-  plaintextLen = ciphertextLen - paddingValue;
-  return true;
+  double scaled = static_cast<double>(probe) * targetMs / (elapsedMs > 0.001 ? elapsedMs : 0.001);
+  uint32_t iterations = clampPasswordIterations(scaled >= static_cast<double>(PASSWORD_HASH_MAX_ITERATIONS)
+                                                ? PASSWORD_HASH_MAX_ITERATIONS
+                                                : static_cast<uint64_t>(scaled));
+  setPasswordHashIterations(iterations);
+  return iterations;
 }
 
 /**
- * @brief HMAC-SHA256 implementasyonu
+ * @brief AES helper fonksiyonları
  *
- * RFC 2104 uyumlu HMAC-SHA256 (Hash-based Message Authentication Code) hesaplar.
- * HMAC = SHA256(o_key_pad || SHA256(i_key_pad || message))
+ * AES şifreleme algoritmasında kullanılan yardımcı fonksiyonlar.
+ * Galois Field (GF) çarpımı ve key expansion işlemlerini yapar.
+ */
+
+/**
+ * @brief Galois Field (GF(2^8)) çarpımı
+ *
+ * AES MixColumns işleminde kullanılan GF(2^8) çarpımı.
+ * İrreducible polynomial: x^8 + x^4 + x^3 + x + 1 (0x11b)
+ *
+ * @param a İlk byte
+ * @param b İkinci byte
+ * @return GF(2^8) çarpım sonucu
+ */
+static inline uint8_t gmul(uint8_t a, uint8_t b) {
+  uint8_t p = 0;
+
+  for (int i = 0; i < 8; ++i) {
+    if (b & 1) p ^= a;
+
+    bool hi_bit_set = a & 0x80;
+    a <<= 1;
+
+    if (hi_bit_set) a ^= 0x1b;
+
+    b >>= 1;
+  }
+
+  return p;
+}
+
+/**
+ * @brief Big-endian 32-bit word oku
+ *
+ * @param p Kaynak (4 byte)
+ * @return 32-bit word
+ */
+static inline uint32_t loadBE32(const uint8_t *p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+         (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+}
+
+/**
+ * @brief Big-endian 32-bit word yaz
+ *
+ * @param p Hedef (4 byte)
+ * @param v Yazılacak değer
+ */
+static inline void storeBE32(uint8_t *p, uint32_t v) {
+  p[0] = static_cast<uint8_t>(v >> 24);
+  p[1] = static_cast<uint8_t>(v >> 16);
+  p[2] = static_cast<uint8_t>(v >> 8);
+  p[3] = static_cast<uint8_t>(v);
+}
+
+// ============================================
+// AES-256 MOTORU - CPU ÖZELLİK TESPİTİ
+// ============================================
+
+/**
+ * @brief AES ile ilgili CPU özellikleri
+ */
+struct AESCPUFeatures {
+  bool aesni;   /**< @brief AES-NI (CPUID.1:ECX.AES[bit 25]) */
+  bool pclmul;  /**< @brief PCLMULQDQ (CPUID.1:ECX[bit 1]) */
+  bool avx2;    /**< @brief AVX2 (CPUID.7:EBX[bit 5]) ve OS YMM desteği */
+  bool vaes;    /**< @brief VAES (CPUID.7:ECX[bit 9]) */
+};
+
+/**
+ * @brief CPUID ile AES özelliklerini tespit et
+ *
+ * AVX2/VAES yalnızca işletim sistemi YMM register'larını kaydediyorsa
+ * (OSXSAVE + XCR0[2:1]) kullanılabilir kabul edilir.
+ *
+ * @return AESCPUFeatures Tespit edilen özellikler
+ */
+static AESCPUFeatures detectAESCPUFeatures() {
+  AESCPUFeatures features = {false, false, false, false};
+#ifdef TRAVELEXPENSE_AES_X86
+  uint32_t ecx1 = 0, ebx7 = 0, ecx7 = 0;
+  uint64_t xcr0 = 0;
+#ifdef _MSC_VER
+  int regs[4] = {0};
+  __cpuid(regs, 0);
+  int maxLeaf = regs[0];
+  __cpuid(regs, 1);
+  ecx1 = static_cast<uint32_t>(regs[2]);
+
+  if (maxLeaf >= 7) {
+    __cpuidex(regs, 7, 0);
+    ebx7 = static_cast<uint32_t>(regs[1]);
+    ecx7 = static_cast<uint32_t>(regs[2]);
+  }
+
+  if (ecx1 & (1u << 27)) {
+    xcr0 = _xgetbv(0);
+  }
+
+#else
+  unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return features;
+  }
+
+  ecx1 = ecx;
+
+  if (__get_cpuid_max(0, nullptr) >= 7) {
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    ebx7 = ebx;
+    ecx7 = ecx;
+  }
+
+  if (ecx1 & (1u << 27)) {
+    uint32_t xcr0Low = 0, xcr0High = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    xcr0 = (static_cast<uint64_t>(xcr0High) << 32) | xcr0Low;
+  }
+
+#endif
+  bool osYmm = (xcr0 & 0x6) == 0x6;
+  features.aesni = (ecx1 & (1u << 25)) != 0;
+  features.pclmul = (ecx1 & (1u << 1)) != 0;
+  features.avx2 = osYmm && (ebx7 & (1u << 5)) != 0;
+  features.vaes = features.avx2 && features.aesni && (ecx7 & (1u << 9)) != 0;
+#endif
+  return features;
+}
+
+/**
+ * @brief CPU özelliklerini al (ilk çağrıda tespit edilir, thread-safe)
+ *
+ * @return const AESCPUFeatures& Tespit edilen özellikler
+ */
+static const AESCPUFeatures &getAESCPUFeatures() {
+  static const AESCPUFeatures features = detectAESCPUFeatures();
+  return features;
+}
+
+/**
+ * @brief Aktif AES arka ucu (-1 = henüz seçilmedi)
+ */
+static std::atomic<int> g_aesBackend(-1);
+
+// ============================================
+// AES-256 MOTORU - TAŞINABİLİR T-TABLE ARKA UCU
+// ============================================
+
+/**
+ * @brief AES şifreleme T-table'ı (SubBytes + MixColumns birleşik)
+ *
+ * Te0[x] = {02*S[x], S[x], S[x], 03*S[x]}. Diğer sütunlar için tablo
+ * döndürülerek (rotate) kullanılır; böylece tek bir 1 KiB tablo yeterlidir.
+ */
+alignas(64) static uint32_t AES_TE0[256];
+
+/**
+ * @brief AES şifre çözme T-table'ı (InvSubBytes + InvMixColumns birleşik)
+ *
+ * Td0[x] = {0e*Si[x], 09*Si[x], 0d*Si[x], 0b*Si[x]}.
+ */
+alignas(64) static uint32_t AES_TD0[256];
+
+/** @brief T-table'ların tek seferlik oluşturulması için bayrak */
+static std::once_flag g_aesTablesOnce;
+
+/**
+ * @brief T-table'ları S-box'lardan oluştur
+ */
+static void buildAESTables() {
+  for (int x = 0; x < 256; ++x) {
+    uint8_t s = AES_SBOX[x];
+    uint8_t s2 = gmul(s, 0x02);
+    AES_TE0[x] = (static_cast<uint32_t>(s2) << 24) | (static_cast<uint32_t>(s) << 16) |
+                 (static_cast<uint32_t>(s) << 8) | static_cast<uint32_t>(s2 ^ s);
+    uint8_t si = AES_INV_SBOX[x];
+    AES_TD0[x] = (static_cast<uint32_t>(gmul(si, 0x0e)) << 24) |
+                 (static_cast<uint32_t>(gmul(si, 0x09)) << 16) |
+                 (static_cast<uint32_t>(gmul(si, 0x0d)) << 8) |
+                 static_cast<uint32_t>(gmul(si, 0x0b));
+  }
+}
+
+/**
+ * @brief Tablonun tüm cache line'larını oku
+ *
+ * Her blok öncesinde tablonun tamamı cache'e çekilir. Böylece blok içindeki
+ * gizli indeksli erişimler cache-line seviyesinde gözlemlenebilir iz bırakmaz
+ * (cache-timing saldırılarına karşı azaltım).
+ *
+ * @param table Tablo başlangıcı (64 byte hizalı)
+ * @param size Tablo boyutu (byte)
+ */
+static inline void touchAESTable(const void *table, size_t size) {
+  const volatile uint8_t *p = static_cast<const volatile uint8_t *>(table);
+
+  for (size_t i = 0; i < size; i += 64) {
+    (void)p[i];
+  }
+}
+
+/**
+ * @brief SubWord: 32-bit word'ün her byte'ına S-box uygula
+ *
+ * @param w Girdi word
+ * @return S-box uygulanmış word
+ */
+static inline uint32_t aesSubWord(uint32_t w) {
+  return (static_cast<uint32_t>(AES_SBOX[w >> 24]) << 24) |
+         (static_cast<uint32_t>(AES_SBOX[(w >> 16) & 0xff]) << 16) |
+         (static_cast<uint32_t>(AES_SBOX[(w >> 8) & 0xff]) << 8) |
+         static_cast<uint32_t>(AES_SBOX[w & 0xff]);
+}
+
+/**
+ * @brief InvMixColumns: tek bir sütuna (word) ters MixColumns uygula
+ *
+ * Td0[S[x]] = InvMixColumns katsayıları * x olduğundan tablo yeniden kullanılır.
+ *
+ * @param w Sütun word'ü
+ * @return InvMixColumns uygulanmış word
+ */
+static inline uint32_t aesInvMixColumn(uint32_t w) {
+  return AES_TD0[AES_SBOX[w >> 24]] ^
+         rightRotate(AES_TD0[AES_SBOX[(w >> 16) & 0xff]], 8) ^
+         rightRotate(AES_TD0[AES_SBOX[(w >> 8) & 0xff]], 16) ^
+         rightRotate(AES_TD0[AES_SBOX[w & 0xff]], 24);
+}
+
+/**
+ * @brief AES-256 key expansion (FIPS-197 Bölüm 5.2)
+ *
+ * 32 byte anahtardan 60 word (15 round key) üretir.
+ *
+ * @param key AES-256 anahtarı (32 byte)
+ * @param w Çıktı word'leri (60 adet)
+ */
+static void aesExpandKey256(const uint8_t *key, uint32_t *w) {
+  static const uint8_t rcon[7] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40};
+
+  for (int i = 0; i < 8; ++i) {
+    w[i] = loadBE32(key + i * 4);
+  }
+
+  for (int i = 8; i < 60; ++i) {
+    uint32_t temp = w[i - 1];
+
+    if (i % 8 == 0) {
+      // RotWord + SubWord + Rcon
+      temp = aesSubWord(rightRotate(temp, 24)) ^ (static_cast<uint32_t>(rcon[i / 8 - 1]) << 24);
+    } else if (i % 8 == 4) {
+      temp = aesSubWord(temp);
+    }
+
+    w[i] = w[i - 8] ^ temp;
+  }
+}
+
+/**
+ * @brief Taşınabilir AES-256 blok şifreleme (T-table)
+ *
+ * @param rk Şifreleme round key word'leri (60 adet)
+ * @param in Girdi blok (16 byte)
+ * @param out Çıktı blok (16 byte, in ile aynı olabilir)
+ */
+static void aesPortableEncryptBlock(const uint32_t *rk, const uint8_t *in, uint8_t *out) {
+  touchAESTable(AES_TE0, sizeof(AES_TE0));
+  touchAESTable(AES_SBOX, sizeof(AES_SBOX));
+  uint32_t s0 = loadBE32(in) ^ rk[0];
+  uint32_t s1 = loadBE32(in + 4) ^ rk[1];
+  uint32_t s2 = loadBE32(in + 8) ^ rk[2];
+  uint32_t s3 = loadBE32(in + 12) ^ rk[3];
+
+  for (int round = 1; round < 14; ++round) {
+    const uint32_t *k = rk + round * 4;
+    uint32_t t0 = AES_TE0[s0 >> 24] ^ rightRotate(AES_TE0[(s1 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TE0[(s2 >> 8) & 0xff], 16) ^ rightRotate(AES_TE0[s3 & 0xff], 24) ^ k[0];
+    uint32_t t1 = AES_TE0[s1 >> 24] ^ rightRotate(AES_TE0[(s2 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TE0[(s3 >> 8) & 0xff], 16) ^ rightRotate(AES_TE0[s0 & 0xff], 24) ^ k[1];
+    uint32_t t2 = AES_TE0[s2 >> 24] ^ rightRotate(AES_TE0[(s3 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TE0[(s0 >> 8) & 0xff], 16) ^ rightRotate(AES_TE0[s1 & 0xff], 24) ^ k[2];
+    uint32_t t3 = AES_TE0[s3 >> 24] ^ rightRotate(AES_TE0[(s0 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TE0[(s1 >> 8) & 0xff], 16) ^ rightRotate(AES_TE0[s2 & 0xff], 24) ^ k[3];
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
+  }
+
+  // Son round: SubBytes + ShiftRows + AddRoundKey (MixColumns yok)
+  const uint32_t *k = rk + 56;
+  storeBE32(out, ((static_cast<uint32_t>(AES_SBOX[s0 >> 24]) << 24) |
+                  (static_cast<uint32_t>(AES_SBOX[(s1 >> 16) & 0xff]) << 16) |
+                  (static_cast<uint32_t>(AES_SBOX[(s2 >> 8) & 0xff]) << 8) |
+                  static_cast<uint32_t>(AES_SBOX[s3 & 0xff])) ^ k[0]);
+  storeBE32(out + 4, ((static_cast<uint32_t>(AES_SBOX[s1 >> 24]) << 24) |
+                      (static_cast<uint32_t>(AES_SBOX[(s2 >> 16) & 0xff]) << 16) |
+                      (static_cast<uint32_t>(AES_SBOX[(s3 >> 8) & 0xff]) << 8) |
+                      static_cast<uint32_t>(AES_SBOX[s0 & 0xff])) ^ k[1]);
+  storeBE32(out + 8, ((static_cast<uint32_t>(AES_SBOX[s2 >> 24]) << 24) |
+                      (static_cast<uint32_t>(AES_SBOX[(s3 >> 16) & 0xff]) << 16) |
+                      (static_cast<uint32_t>(AES_SBOX[(s0 >> 8) & 0xff]) << 8) |
+                      static_cast<uint32_t>(AES_SBOX[s1 & 0xff])) ^ k[2]);
+  storeBE32(out + 12, ((static_cast<uint32_t>(AES_SBOX[s3 >> 24]) << 24) |
+                       (static_cast<uint32_t>(AES_SBOX[(s0 >> 16) & 0xff]) << 16) |
+                       (static_cast<uint32_t>(AES_SBOX[(s1 >> 8) & 0xff]) << 8) |
+                       static_cast<uint32_t>(AES_SBOX[s2 & 0xff])) ^ k[3]);
+}
+
+/**
+ * @brief Taşınabilir AES-256 blok şifre çözme (T-table, eşdeğer ters şifre)
+ *
+ * @param rk Şifre çözme round key word'leri (60 adet, InvMixColumns uygulanmış)
+ * @param in Şifreli blok (16 byte)
+ * @param out Çözülmüş blok (16 byte, in ile aynı olabilir)
+ */
+static void aesPortableDecryptBlock(const uint32_t *rk, const uint8_t *in, uint8_t *out) {
+  touchAESTable(AES_TD0, sizeof(AES_TD0));
+  touchAESTable(AES_INV_SBOX, sizeof(AES_INV_SBOX));
+  uint32_t s0 = loadBE32(in) ^ rk[0];
+  uint32_t s1 = loadBE32(in + 4) ^ rk[1];
+  uint32_t s2 = loadBE32(in + 8) ^ rk[2];
+  uint32_t s3 = loadBE32(in + 12) ^ rk[3];
+
+  for (int round = 1; round < 14; ++round) {
+    const uint32_t *k = rk + round * 4;
+    uint32_t t0 = AES_TD0[s0 >> 24] ^ rightRotate(AES_TD0[(s3 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TD0[(s2 >> 8) & 0xff], 16) ^ rightRotate(AES_TD0[s1 & 0xff], 24) ^ k[0];
+    uint32_t t1 = AES_TD0[s1 >> 24] ^ rightRotate(AES_TD0[(s0 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TD0[(s3 >> 8) & 0xff], 16) ^ rightRotate(AES_TD0[s2 & 0xff], 24) ^ k[1];
+    uint32_t t2 = AES_TD0[s2 >> 24] ^ rightRotate(AES_TD0[(s1 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TD0[(s0 >> 8) & 0xff], 16) ^ rightRotate(AES_TD0[s3 & 0xff], 24) ^ k[2];
+    uint32_t t3 = AES_TD0[s3 >> 24] ^ rightRotate(AES_TD0[(s2 >> 16) & 0xff], 8) ^
+                  rightRotate(AES_TD0[(s1 >> 8) & 0xff], 16) ^ rightRotate(AES_TD0[s0 & 0xff], 24) ^ k[3];
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
+  }
+
+  // Son round: InvShiftRows + InvSubBytes + AddRoundKey
+  const uint32_t *k = rk + 56;
+  storeBE32(out, ((static_cast<uint32_t>(AES_INV_SBOX[s0 >> 24]) << 24) |
+                  (static_cast<uint32_t>(AES_INV_SBOX[(s3 >> 16) & 0xff]) << 16) |
+                  (static_cast<uint32_t>(AES_INV_SBOX[(s2 >> 8) & 0xff]) << 8) |
+                  static_cast<uint32_t>(AES_INV_SBOX[s1 & 0xff])) ^ k[0]);
+  storeBE32(out + 4, ((static_cast<uint32_t>(AES_INV_SBOX[s1 >> 24]) << 24) |
+                      (static_cast<uint32_t>(AES_INV_SBOX[(s0 >> 16) & 0xff]) << 16) |
+                      (static_cast<uint32_t>(AES_INV_SBOX[(s3 >> 8) & 0xff]) << 8) |
+                      static_cast<uint32_t>(AES_INV_SBOX[s2 & 0xff])) ^ k[1]);
+  storeBE32(out + 8, ((static_cast<uint32_t>(AES_INV_SBOX[s2 >> 24]) << 24) |
+                      (static_cast<uint32_t>(AES_INV_SBOX[(s1 >> 16) & 0xff]) << 16) |
+                      (static_cast<uint32_t>(AES_INV_SBOX[(s0 >> 8) & 0xff]) << 8) |
+                      static_cast<uint32_t>(AES_INV_SBOX[s3 & 0xff])) ^ k[2]);
+  storeBE32(out + 12, ((static_cast<uint32_t>(AES_INV_SBOX[s3 >> 24]) << 24) |
+                       (static_cast<uint32_t>(AES_INV_SBOX[(s2 >> 16) & 0xff]) << 16) |
+                       (static_cast<uint32_t>(AES_INV_SBOX[(s1 >> 8) & 0xff]) << 8) |
+                       static_cast<uint32_t>(AES_INV_SBOX[s0 & 0xff])) ^ k[3]);
+}
+
+#ifdef TRAVELEXPENSE_AES_X86
+// ============================================
+// AES-256 MOTORU - AES-NI ARKA UCU
+// ============================================
+
+/**
+ * @brief AES-NI ile blok şifreleme (8 blok paralel)
+ *
+ * aesenc komutunun gecikmesini (latency) gizlemek için 8 bağımsız blok
+ * aynı anda işlenir.
+ *
+ * @param rk Şifreleme round key'leri (240 byte, 16 byte hizalı)
+ * @param in Girdi blokları
+ * @param out Çıktı blokları
+ * @param blockCount Blok sayısı
+ */
+AES_TARGET_AESNI static void aesniEncryptBlocks(const uint8_t *rk, const uint8_t *in,
+    uint8_t *out, size_t blockCount) {
+  __m128i k[15];
+
+  for (int r = 0; r < 15; ++r) {
+    k[r] = _mm_load_si128(reinterpret_cast<const __m128i *>(rk + r * 16));
+  }
+
+  size_t i = 0;
+
+  for (; i + 8 <= blockCount; i += 8) {
+    __m128i b[8];
+
+    for (int j = 0; j < 8; ++j) {
+      b[j] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + (i + j) * 16)), k[0]);
+    }
+
+    for (int r = 1; r < 14; ++r) {
+      for (int j = 0; j < 8; ++j) {
+        b[j] = _mm_aesenc_si128(b[j], k[r]);
+      }
+    }
+
+    for (int j = 0; j < 8; ++j) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i + j) * 16), _mm_aesenclast_si128(b[j], k[14]));
+    }
+  }
+
+  for (; i < blockCount; ++i) {
+    __m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 16)), k[0]);
+
+    for (int r = 1; r < 14; ++r) {
+      b = _mm_aesenc_si128(b, k[r]);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 16), _mm_aesenclast_si128(b, k[14]));
+  }
+}
+
+/**
+ * @brief AES-NI ile blok şifre çözme (8 blok paralel)
+ *
+ * @param rk Şifre çözme round key'leri (240 byte, 16 byte hizalı)
+ * @param in Şifreli bloklar
+ * @param out Çözülmüş bloklar
+ * @param blockCount Blok sayısı
+ */
+AES_TARGET_AESNI static void aesniDecryptBlocks(const uint8_t *rk, const uint8_t *in,
+    uint8_t *out, size_t blockCount) {
+  __m128i k[15];
+
+  for (int r = 0; r < 15; ++r) {
+    k[r] = _mm_load_si128(reinterpret_cast<const __m128i *>(rk + r * 16));
+  }
+
+  size_t i = 0;
+
+  for (; i + 8 <= blockCount; i += 8) {
+    __m128i b[8];
+
+    for (int j = 0; j < 8; ++j) {
+      b[j] = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + (i + j) * 16)), k[0]);
+    }
+
+    for (int r = 1; r < 14; ++r) {
+      for (int j = 0; j < 8; ++j) {
+        b[j] = _mm_aesdec_si128(b[j], k[r]);
+      }
+    }
+
+    for (int j = 0; j < 8; ++j) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i + j) * 16), _mm_aesdeclast_si128(b[j], k[14]));
+    }
+  }
+
+  for (; i < blockCount; ++i) {
+    __m128i b = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 16)), k[0]);
+
+    for (int r = 1; r < 14; ++r) {
+      b = _mm_aesdec_si128(b, k[r]);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 16), _mm_aesdeclast_si128(b, k[14]));
+  }
+}
+
+/**
+ * @brief AES-NI ile CBC şifreleme (zincir bağımlılığı nedeniyle seri)
+ *
+ * @param rk Şifreleme round key'leri
+ * @param iv Zincirleme değeri (girdi/çıktı)
+ * @param in Düz metin blokları
+ * @param out Şifreli bloklar
+ * @param blockCount Blok sayısı
+ */
+AES_TARGET_AESNI static void aesniEncryptCBC(const uint8_t *rk, uint8_t *iv, const uint8_t *in,
+    uint8_t *out, size_t blockCount) {
+  __m128i k[15];
+
+  for (int r = 0; r < 15; ++r) {
+    k[r] = _mm_load_si128(reinterpret_cast<const __m128i *>(rk + r * 16));
+  }
+
+  __m128i chain = _mm_loadu_si128(reinterpret_cast<const __m128i *>(iv));
+
+  for (size_t i = 0; i < blockCount; ++i) {
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 16));
+    b = _mm_xor_si128(_mm_xor_si128(b, chain), k[0]);
+
+    for (int r = 1; r < 14; ++r) {
+      b = _mm_aesenc_si128(b, k[r]);
+    }
+
+    chain = _mm_aesenclast_si128(b, k[14]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 16), chain);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(iv), chain);
+}
+
+/**
+ * @brief AES-NI ile CBC şifre çözme (8 blok paralel)
+ *
+ * Şifreli bloklar yazılmadan önce register'lara okunduğu için
+ * in == out (yerinde çözme) desteklenir.
+ *
+ * @param rk Şifre çözme round key'leri
+ * @param iv Zincirleme değeri (girdi/çıktı)
+ * @param in Şifreli bloklar
+ * @param out Düz metin blokları
+ * @param blockCount Blok sayısı
+ */
+AES_TARGET_AESNI static void aesniDecryptCBC(const uint8_t *rk, uint8_t *iv, const uint8_t *in,
+    uint8_t *out, size_t blockCount) {
+  __m128i k[15];
+
+  for (int r = 0; r < 15; ++r) {
+    k[r] = _mm_load_si128(reinterpret_cast<const __m128i *>(rk + r * 16));
+  }
+
+  __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i *>(iv));
+  size_t i = 0;
+
+  for (; i + 8 <= blockCount; i += 8) {
+    __m128i c[8], b[8];
+
+    for (int j = 0; j < 8; ++j) {
+      c[j] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + (i + j) * 16));
+      b[j] = _mm_xor_si128(c[j], k[0]);
+    }
+
+    for (int r = 1; r < 14; ++r) {
+      for (int j = 0; j < 8; ++j) {
+        b[j] = _mm_aesdec_si128(b[j], k[r]);
+      }
+    }
+
+    for (int j = 0; j < 8; ++j) {
+      b[j] = _mm_aesdeclast_si128(b[j], k[14]);
+      b[j] = _mm_xor_si128(b[j], j == 0 ? prev : c[j - 1]);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(out + (i + j) * 16), b[j]);
+    }
+
+    prev = c[7];
+  }
+
+  for (; i < blockCount; ++i) {
+    __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i * 16));
+    __m128i b = _mm_xor_si128(c, k[0]);
+
+    for (int r = 1; r < 14; ++r) {
+      b = _mm_aesdec_si128(b, k[r]);
+    }
+
+    b = _mm_xor_si128(_mm_aesdeclast_si128(b, k[14]), prev);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i * 16), b);
+    prev = c;
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(iv), prev);
+}
+
+// ============================================
+// AES-256 MOTORU - VAES (AVX2) ARKA UCU
+// ============================================
+
+/**
+ * @brief VAES ile blok şifreleme/şifre çözme (4 x 256-bit = 8 blok paralel)
+ *
+ * Her YMM register'ı iki AES bloğu taşır; 8 bloktan küçük kalan kısım
+ * AES-NI yoluna devredilir.
+ *
+ * @param rk Round key'leri (şifreleme veya şifre çözme)
+ * @param in Girdi blokları
+ * @param out Çıktı blokları
+ * @param blockCount Blok sayısı
+ * @param decrypt true ise aesdec, false ise aesenc kullanılır
+ */
+AES_TARGET_VAES static void vaesProcessBlocks(const uint8_t *rk, const uint8_t *in,
+    uint8_t *out, size_t blockCount, bool decrypt) {
+  __m256i k[15];
+
+  for (int r = 0; r < 15; ++r) {
+    k[r] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(rk + r * 16)));
+  }
+
+  size_t i = 0;
+
+  for (; i + 8 <= blockCount; i += 8) {
+    __m256i b[4];
+
+    for (int j = 0; j < 4; ++j) {
+      b[j] = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + (i + j * 2) * 16)), k[0]);
+    }
+
+    if (decrypt) {
+      for (int r = 1; r < 14; ++r) {
+        for (int j = 0; j < 4; ++j) {
+          b[j] = _mm256_aesdec_epi128(b[j], k[r]);
+        }
+      }
+
+      for (int j = 0; j < 4; ++j) {
+        b[j] = _mm256_aesdeclast_epi128(b[j], k[14]);
+      }
+    } else {
+      for (int r = 1; r < 14; ++r) {
+        for (int j = 0; j < 4; ++j) {
+          b[j] = _mm256_aesenc_epi128(b[j], k[r]);
+        }
+      }
+
+      for (int j = 0; j < 4; ++j) {
+        b[j] = _mm256_aesenclast_epi128(b[j], k[14]);
+      }
+    }
+
+    for (int j = 0; j < 4; ++j) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + (i + j * 2) * 16), b[j]);
+    }
+  }
+
+  if (i < blockCount) {
+    if (decrypt) {
+      aesniDecryptBlocks(rk, in + i * 16, out + i * 16, blockCount - i);
+    } else {
+      aesniEncryptBlocks(rk, in + i * 16, out + i * 16, blockCount - i);
+    }
+  }
+}
+
+/**
+ * @brief VAES ile CBC şifre çözme (8 blok paralel)
+ *
+ * Zincirleme değerleri (önceki şifreli bloklar) yüklenen register'lardan
+ * permute ile üretilir; yerinde (in == out) çözme desteklenir.
+ *
+ * @param rk Şifre çözme round key'leri
+ * @param iv Zincirleme değeri (girdi/çıktı)
+ * @param in Şifreli bloklar
+ * @param out Düz metin blokları
+ * @param blockCount Blok sayısı
+ */
+AES_TARGET_VAES static void vaesDecryptCBC(const uint8_t *rk, uint8_t *iv, const uint8_t *in,
+    uint8_t *out, size_t blockCount) {
+  __m256i k[15];
+
+  for (int r = 0; r < 15; ++r) {
+    k[r] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(rk + r * 16)));
+  }
+
+  __m128i prev = _mm_loadu_si128(reinterpret_cast<const __m128i *>(iv));
+  size_t i = 0;
+
+  for (; i + 8 <= blockCount; i += 8) {
+    __m256i c[4], b[4], chain[4];
+
+    for (int j = 0; j < 4; ++j) {
+      c[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + (i + j * 2) * 16));
+      b[j] = _mm256_xor_si256(c[j], k[0]);
+    }
+
+    // chain[j] = {önceki yüksek blok, c[j] düşük blok}
+    chain[0] = _mm256_inserti128_si256(_mm256_castsi128_si256(prev), _mm256_castsi256_si128(c[0]), 1);
+
+    for (int j = 1; j < 4; ++j) {
+      chain[j] = _mm256_permute2x128_si256(c[j - 1], c[j], 0x21);
+    }
+
+    for (int r = 1; r < 14; ++r) {
+      for (int j = 0; j < 4; ++j) {
+        b[j] = _mm256_aesdec_epi128(b[j], k[r]);
+      }
+    }
+
+    for (int j = 0; j < 4; ++j) {
+      b[j] = _mm256_xor_si256(_mm256_aesdeclast_epi128(b[j], k[14]), chain[j]);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + (i + j * 2) * 16), b[j]);
+    }
+
+    prev = _mm256_extracti128_si256(c[3], 1);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(iv), prev);
+
+  if (i < blockCount) {
+    aesniDecryptCBC(rk, iv, in + i * 16, out + i * 16, blockCount - i);
+  }
+}
+#endif // TRAVELEXPENSE_AES_X86
+
+// ============================================
+// AES-256 MOTORU - GENEL API
+// ============================================
+
+bool isAESBackendSupported(AESBackend backend) {
+  const AESCPUFeatures &features = getAESCPUFeatures();
+
+  switch (backend) {
+    case AESBackend::Portable:
+      return true;
+
+    case AESBackend::AESNI:
+      return features.aesni;
+
+    case AESBackend::VAES:
+      return features.vaes;
+
+    default:
+      return false;
+  }
+}
+
+AESBackend getAESBackend() {
+  int backend = g_aesBackend.load(std::memory_order_acquire);
+
+  if (backend < 0) {
+    // En hızlı desteklenen arka ucu seç
+    AESBackend best = AESBackend::Portable;
+
+    if (isAESBackendSupported(AESBackend::VAES)) {
+      best = AESBackend::VAES;
+    } else if (isAESBackendSupported(AESBackend::AESNI)) {
+      best = AESBackend::AESNI;
+    }
+
+    backend = static_cast<int>(best);
+    g_aesBackend.store(backend, std::memory_order_release);
+  }
+
+  return static_cast<AESBackend>(backend);
+}
+
+bool setAESBackend(AESBackend backend) {
+  if (!isAESBackendSupported(backend)) {
+    return false;
+  }
+
+  g_aesBackend.store(static_cast<int>(backend), std::memory_order_release);
+  return true;
+}
+
+const char *getAESBackendName(AESBackend backend) {
+  switch (backend) {
+    case AESBackend::Portable:
+      return "portable";
+
+    case AESBackend::AESNI:
+      return "aesni";
+
+    case AESBackend::VAES:
+      return "vaes";
+
+    default:
+      return "unknown";
+  }
+}
+
+bool initAES256Context(AES256Context *ctx, const uint8_t *key) {
+  if (!ctx || !key) {
+    return false;
+  }
+
+  std::call_once(g_aesTablesOnce, buildAESTables);
+  aesExpandKey256(key, ctx->encKeyWords);
+
+  // Eşdeğer ters şifre için round key'leri ters sırala ve
+  // ilk/son hariç InvMixColumns uygula (FIPS-197 Bölüm 5.3.5)
+  for (int round = 0; round < 15; ++round) {
+    for (int j = 0; j < 4; ++j) {
+      uint32_t w = ctx->encKeyWords[(14 - round) * 4 + j];
+
+      if (round > 0 && round < 14) {
+        w = aesInvMixColumn(w);
+      }
+
+      ctx->decKeyWords[round * 4 + j] = w;
+    }
+  }
+
+  for (int i = 0; i < 60; ++i) {
+    storeBE32(ctx->encRoundKeys + i * 4, ctx->encKeyWords[i]);
+    storeBE32(ctx->decRoundKeys + i * 4, ctx->decKeyWords[i]);
+  }
+
+  ctx->backend = getAESBackend();
+  ctx->isInitialized = true;
+  return true;
+}
+
+void clearAES256Context(AES256Context *ctx) {
+  if (!ctx) {
+    return;
+  }
+
+  Security::secureMemset(ctx, 0, sizeof(AES256Context));
+}
+
+bool aes256EncryptBlocks(const AES256Context *ctx, const uint8_t *input,
+                         uint8_t *output, size_t blockCount) {
+  if (!ctx || !ctx->isInitialized || !input || !output) {
+    return false;
+  }
+
+  switch (ctx->backend) {
+#ifdef TRAVELEXPENSE_AES_X86
+
+    case AESBackend::VAES:
+      vaesProcessBlocks(ctx->encRoundKeys, input, output, blockCount, false);
+      break;
+
+    case AESBackend::AESNI:
+      aesniEncryptBlocks(ctx->encRoundKeys, input, output, blockCount);
+      break;
+#endif
+
+    default:
+      for (size_t i = 0; i < blockCount; ++i) {
+        aesPortableEncryptBlock(ctx->encKeyWords, input + i * 16, output + i * 16);
+      }
+
+      break;
+  }
+
+  return true;
+}
+
+bool aes256DecryptBlocks(const AES256Context *ctx, const uint8_t *input,
+                         uint8_t *output, size_t blockCount) {
+  if (!ctx || !ctx->isInitialized || !input || !output) {
+    return false;
+  }
+
+  switch (ctx->backend) {
+#ifdef TRAVELEXPENSE_AES_X86
+
+    case AESBackend::VAES:
+      vaesProcessBlocks(ctx->decRoundKeys, input, output, blockCount, true);
+      break;
+
+    case AESBackend::AESNI:
+      aesniDecryptBlocks(ctx->decRoundKeys, input, output, blockCount);
+      break;
+#endif
+
+    default:
+      for (size_t i = 0; i < blockCount; ++i) {
+        aesPortableDecryptBlock(ctx->decKeyWords, input + i * 16, output + i * 16);
+      }
+
+      break;
+  }
+
+  return true;
+}
+
+bool aes256EncryptCBC(const AES256Context *ctx, uint8_t *iv,
+                      const uint8_t *input, uint8_t *output, size_t blockCount) {
+  if (!ctx || !ctx->isInitialized || !iv || !input || !output) {
+    return false;
+  }
+
+#ifdef TRAVELEXPENSE_AES_X86
+
+  if (ctx->backend != AESBackend::Portable) {
+    // CBC şifreleme seri olduğu için VAES'in genişliğinden faydalanamaz
+    aesniEncryptCBC(ctx->encRoundKeys, iv, input, output, blockCount);
+    return true;
+  }
+
+#endif
+
+  for (size_t i = 0; i < blockCount; ++i) {
+    uint8_t block[16];
+
+    for (int j = 0; j < 16; ++j) {
+      block[j] = input[i * 16 + j] ^ iv[j];
+    }
+
+    aesPortableEncryptBlock(ctx->encKeyWords, block, output + i * 16);
+    std::memcpy(iv, output + i * 16, 16);
+  }
+
+  return true;
+}
+
+bool aes256DecryptCBC(const AES256Context *ctx, uint8_t *iv,
+                      const uint8_t *input, uint8_t *output, size_t blockCount) {
+  if (!ctx || !ctx->isInitialized || !iv || !input || !output) {
+    return false;
+  }
+
+  switch (ctx->backend) {
+#ifdef TRAVELEXPENSE_AES_X86
+
+    case AESBackend::VAES:
+      vaesDecryptCBC(ctx->decRoundKeys, iv, input, output, blockCount);
+      return true;
+
+    case AESBackend::AESNI:
+      aesniDecryptCBC(ctx->decRoundKeys, iv, input, output, blockCount);
+      return true;
+#endif
+
+    default:
+      break;
+  }
+
+  for (size_t i = 0; i < blockCount; ++i) {
+    uint8_t cipherBlock[16];
+    std::memcpy(cipherBlock, input + i * 16, 16);
+    aesPortableDecryptBlock(ctx->decKeyWords, cipherBlock, output + i * 16);
+
+    for (int j = 0; j < 16; ++j) {
+      output[i * 16 + j] ^= iv[j];
+    }
+
+    std::memcpy(iv, cipherBlock, 16);
+  }
+
+  return true;
+}
+
+/**
+ * @brief AES anahtar önbelleği nesli
+ *
+ * clearAES256KeyCache() çağrısında artırılır; nesli eski kalan thread
+ * önbelleği bir sonraki kullanımda silinir.
+ */
+static std::atomic<uint64_t> g_aesKeyCacheGeneration(0);
+
+/**
+ * @brief Thread başına önbelleklenmiş AES anahtar takvimi
+ *
+ * encryptAES256/decryptAES256 aynı anahtarla tekrar tekrar çağrıldığında
+ * (oturum anahtarı, master key vb.) anahtar genişletmesi her çağrıda
+ * tekrarlanmaz. Anahtar ve takvim thread sonlanınca silinir.
+ */
+struct CachedAES256Key {
+  uint8_t key[32];      /**< @brief Önbellekteki anahtar */
+  AES256Context ctx;    /**< @brief Genişletilmiş anahtar takvimi */
+  uint64_t generation;  /**< @brief Önbelleğin nesli (g_aesKeyCacheGeneration) */
+  bool valid;           /**< @brief Önbellek geçerli mi? */
+
+  CachedAES256Key() : generation(0), valid(false) {}
+
+  ~CachedAES256Key() {
+    wipe();
+  }
+
+  /** @brief Anahtarı ve takvimi güvenli şekilde sil */
+  void wipe() {
+    Security::secureMemset(key, 0, sizeof(key));
+    clearAES256Context(&ctx);
+    valid = false;
+  }
+};
+
+/** @brief Thread-local tek girdili anahtar takvimi önbelleği */
+static thread_local CachedAES256Key g_cachedAES256Key;
+
+void clearAES256KeyCache() {
+  g_aesKeyCacheGeneration.fetch_add(1);
+  g_cachedAES256Key.wipe();
+}
+
+/**
+ * @brief Anahtar için önbellekli AES bağlamını al
+ *
+ * Anahtar önbellektekiyle aynıysa (sabit zamanlı karşılaştırma) mevcut takvim
+ * döner, değilse takvim yeniden genişletilir.
+ *
+ * @param key AES-256 anahtarı (32 byte)
+ * @return const AES256Context* Bağlam (hata durumunda nullptr)
+ */
+static const AES256Context *getCachedAES256Context(const uint8_t *key) {
+  CachedAES256Key &cache = g_cachedAES256Key;
+  uint64_t generation = g_aesKeyCacheGeneration.load();
+
+  if (cache.generation != generation) {
+    cache.wipe();
+    cache.generation = generation;
+  }
+
+  if (cache.valid && cache.ctx.backend == getAESBackend() &&
+      constantTimeCompare(reinterpret_cast<const char *>(cache.key),
+                          reinterpret_cast<const char *>(key), 32)) {
+    return &cache.ctx;
+  }
+
+  cache.valid = false;
+
+  if (!initAES256Context(&cache.ctx, key)) {
+    return nullptr;
+  }
+
+  std::memcpy(cache.key, key, 32);
+  cache.valid = true;
+  return &cache.ctx;
+}
+
+/**
+ * @brief AES-256-CBC şifreleme
+ *
+ * AES-256 algoritması ile CBC (Cipher Block Chaining) modunda şifreleme yapar.
+ * PKCS7 padding kullanır; tam bloklar doğrudan çıktı buffer'ına şifrelenir,
+ * yalnızca son (padding'li) blok için 16 byte'lık yerel buffer kullanılır.
+ *
+ * @param plaintext Şifrelenecek veri
+ * @param plaintextLen Veri uzunluğu (byte)
+ * @param key Şifreleme anahtarı (32 byte - AES-256)
+ * @param iv Initialization Vector (16 byte)
+ * @param ciphertext Şifrelenmiş veri çıktısı (en az (plaintextLen / 16 + 1) * 16 byte)
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu (çıktı, padding dahil)
+ * @return true Başarılı, false Hata (null pointer, sıfır uzunluk vb.)
+ */
+bool encryptAES256(const void *plaintext, size_t plaintextLen,
+                   const uint8_t *key, const uint8_t *iv,
+                   void *ciphertext, size_t &ciphertextLen) {
+  if (!plaintext || plaintextLen == 0 || !key || !iv || !ciphertext) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  return aes256EncryptCBCPadded(ctx, iv, plaintext, plaintextLen, ciphertext, ciphertextLen);
+}
+
+bool aes256EncryptCBCPadded(const AES256Context *ctx, const uint8_t *iv,
+                            const void *plaintext, size_t plaintextLen,
+                            void *ciphertext, size_t &ciphertextLen) {
+  if (!ctx || !ctx->isInitialized || !iv || !plaintext || plaintextLen == 0 || !ciphertext) {
+    return false;
+  }
+
+  const uint8_t *plain = static_cast<const uint8_t *>(plaintext);
+  uint8_t *cipher = static_cast<uint8_t *>(ciphertext);
+  uint8_t chain[16];
+  std::memcpy(chain, iv, 16);
+  // PKCS7'de, eğer veri zaten 16'nın katıysa, tam bir blok (16 byte) padding eklenir
+  size_t fullBlocks = plaintextLen / 16;
+  size_t tailLen = plaintextLen % 16;
+  aes256EncryptCBC(ctx, chain, plain, cipher, fullBlocks);
+  uint8_t lastBlock[16];
+  std::memcpy(lastBlock, plain + fullBlocks * 16, tailLen);
+  std::memset(lastBlock + tailLen, static_cast<int>(16 - tailLen), 16 - tailLen);
+  aes256EncryptCBC(ctx, chain, lastBlock, cipher + fullBlocks * 16, 1);
+  Security::secureMemset(lastBlock, 0, sizeof(lastBlock));
+  ciphertextLen = (fullBlocks + 1) * 16;
+  return true;
+}
+
+/**
+ * @brief PKCS7 padding'i doğrula ve uzunluğunu döndür
+ *
+ * Son paddingValue byte'ının hepsi paddingValue olmalıdır. Kontrol, padding
+ * oracle saldırılarına karşı veri bağımlı dallanma olmadan yapılır.
+ *
+ * @param lastBlock Son blok
+ * @param blockSize Blok boyutu (byte)
+ * @param paddingLen Padding uzunluğu (çıktı)
+ * @return true Padding geçerli, false Geçersiz
+ */
+static bool pkcs7PaddingLength(const uint8_t *lastBlock, size_t blockSize, size_t &paddingLen) {
+  uint8_t paddingValue = lastBlock[blockSize - 1];
+  uint32_t invalid = static_cast<uint32_t>(paddingValue == 0) | static_cast<uint32_t>(paddingValue > blockSize);
+
+  for (size_t i = 0; i < blockSize; ++i) {
+    uint32_t inPadding = static_cast<uint32_t>(i < paddingValue);
+    invalid |= inPadding & static_cast<uint32_t>(lastBlock[blockSize - 1 - i] != paddingValue);
+  }
+
+  paddingLen = paddingValue;
+  return invalid == 0;
+}
+
+/**
+ * @brief AES-256-CBC şifre çözme
+ *
+ * AES-256 algoritması ile CBC modunda şifre çözme yapar ve PKCS7 padding'i
+ * doğrulayıp kaldırır. Padding kontrolü, padding oracle saldırılarına karşı
+ * veri bağımlı dallanma olmadan yapılır.
+ *
+ * @param ciphertext Şifrelenmiş veri
+ * @param ciphertextLen Şifrelenmiş veri uzunluğu (byte, 16'nın katı olmalı)
+ * @param key Şifreleme anahtarı (32 byte - AES-256)
+ * @param iv Initialization Vector (16 byte)
+ * @param plaintext Şifre çözülmüş veri çıktısı (en az ciphertextLen byte)
+ * @param plaintextLen Şifre çözülmüş veri uzunluğu (çıktı, padding olmadan)
+ * @return true Başarılı, false Hata (null pointer, geçersiz uzunluk, padding hatası)
+ */
+bool decryptAES256(const void *ciphertext, size_t ciphertextLen,
+                   const uint8_t *key, const uint8_t *iv,
+                   void *plaintext, size_t &plaintextLen) {
+  if (!ciphertext || ciphertextLen == 0 || ciphertextLen % 16 != 0 ||
+      !key || !iv || !plaintext) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  return aes256DecryptCBCPadded(ctx, iv, ciphertext, ciphertextLen, plaintext, plaintextLen);
+}
+
+bool aes256DecryptCBCPadded(const AES256Context *ctx, const uint8_t *iv,
+                            const void *ciphertext, size_t ciphertextLen,
+                            void *plaintext, size_t &plaintextLen) {
+  if (!ctx || !ctx->isInitialized || !iv || !ciphertext || ciphertextLen == 0 ||
+      ciphertextLen % 16 != 0 || !plaintext) {
+    return false;
+  }
+
+  uint8_t *plain = static_cast<uint8_t *>(plaintext);
+  uint8_t chain[16];
+  std::memcpy(chain, iv, 16);
+  aes256DecryptCBC(ctx, chain, static_cast<const uint8_t *>(ciphertext), plain, ciphertextLen / 16);
+  size_t paddingLen = 0;
+
+  if (!pkcs7PaddingLength(plain + ciphertextLen - 16, 16, paddingLen)) {
+    // Yanlış anahtar veya bozuk veri: çözülmüş çöp çıktıda kalmasın
+    Security::secureMemset(plaintext, 0, ciphertextLen);
+    return false;
+  }
+
+  plaintextLen = ciphertextLen - paddingLen;
+  return true;
+}
+
+// ============================================
+// AES-256-CTR / GCM - PARALEL İŞLEME
+// ============================================
+
+/** @brief Paralel işlemede thread başına minimum veri miktarı (byte) */
+static const size_t AES_PARALLEL_MIN_CHUNK = 256 * 1024;
+
+/** @brief Anahtar akışı üretiminde bir iterasyonda işlenen blok sayısı */
+static const size_t AES_CTR_BATCH_BLOCKS = 8;
+
+/** @brief Kullanıcının ayarladığı thread sayısı (0 = otomatik) */
+static std::atomic<unsigned> g_encryptionThreadCount(0);
+
+void setEncryptionThreadCount(unsigned threadCount) {
+  g_encryptionThreadCount.store(threadCount, std::memory_order_relaxed);
+}
+
+unsigned getEncryptionThreadCount() {
+  unsigned threads = g_encryptionThreadCount.load(std::memory_order_relaxed);
+
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+
+  return threads > 0 ? threads : 1;
+}
+
+/**
+ * @brief Buffer'ın kaç parçaya bölüneceğini hesapla
+ *
+ * @param length Toplam veri uzunluğu
+ * @param chunkSize Parça boyutu çıktısı (16'nın katı)
+ * @return size_t Parça sayısı (1 ise paralel işleme yapılmaz)
+ */
+static size_t planParallelChunks(size_t length, size_t &chunkSize) {
+  size_t chunks = getEncryptionThreadCount();
+  size_t maxChunks = length / AES_PARALLEL_MIN_CHUNK;
+
+  if (chunks > maxChunks) {
+    chunks = maxChunks;
+  }
+
+  if (chunks <= 1) {
+    chunkSize = length;
+    return 1;
+  }
+
+  chunkSize = ((length / chunks) + 15) & ~static_cast<size_t>(15);
+  return (length + chunkSize - 1) / chunkSize;
+}
+
+/**
+ * @brief Parçaları thread'lere dağıt ve hepsinin bitmesini bekle
+ *
+ * İlk parça çağıran thread'de işlenir. Thread oluşturulamazsa (kaynak
+ * yetersizliği) ilgili parça çağıran thread'de sırayla işlenir.
+ *
+ * @param chunks Parça sayısı
+ * @param worker Parça indeksini alan işlem
+ */
+template <typename Worker>
+static void runParallelChunks(size_t chunks, const Worker &worker) {
+  std::vector<std::thread> threads;
+  threads.reserve(chunks - 1);
+
+  for (size_t c = 1; c < chunks; ++c) {
+    try {
+      threads.emplace_back(worker, c);
+    } catch (const std::system_error &) {
+      worker(c);
+    }
+  }
+
+  worker(0);
+
+  for (size_t i = 0; i < threads.size(); ++i) {
+    threads[i].join();
+  }
+}
+
+/**
+ * @brief 128-bit big-endian sayacı artır
+ *
+ * @param counter Sayaç bloğu (16 byte)
+ * @param blocks Eklenecek blok sayısı
+ */
+static inline void addCounter128(uint8_t *counter, uint64_t blocks) {
+  for (int i = 15; i >= 0 && blocks != 0; --i) {
+    uint64_t sum = static_cast<uint64_t>(counter[i]) + (blocks & 0xff);
+    counter[i] = static_cast<uint8_t>(sum);
+    blocks = (blocks >> 8) + (sum >> 8);
+  }
+}
+
+/**
+ * @brief GCM sayacını artır (inc32: yalnızca son 32 bit, mod 2^32)
+ *
+ * @param counter Sayaç bloğu (16 byte)
+ * @param blocks Eklenecek blok sayısı
+ */
+static inline void addCounter32(uint8_t *counter, uint64_t blocks) {
+  storeBE32(counter + 12, loadBE32(counter + 12) + static_cast<uint32_t>(blocks));
+}
+
+/**
+ * @brief Anahtar akışı üret ve veriyle XOR'la (tek thread)
+ *
+ * Her iterasyonda AES_CTR_BATCH_BLOCKS sayaç bloğu AES motorunun paralel
+ * çekirdeğinden tek çağrıda geçirilir.
+ *
+ * @param ctx AES bağlamı
+ * @param counter Sayaç bloğu (girdi/çıktı)
+ * @param gcmCounter true ise inc32 (GCM), false ise 128-bit artırım (CTR)
+ * @param input Girdi verisi
+ * @param output Çıktı verisi
+ * @param length Veri uzunluğu
+ */
+static void aesCTRXor(const AES256Context *ctx, uint8_t *counter, bool gcmCounter,
+                      const uint8_t *input, uint8_t *output, size_t length) {
+  uint8_t counterBlocks[AES_CTR_BATCH_BLOCKS * 16];
+  uint8_t keystream[AES_CTR_BATCH_BLOCKS * 16];
+
+  while (length > 0) {
+    size_t blocks = (length + 15) / 16;
+
+    if (blocks > AES_CTR_BATCH_BLOCKS) {
+      blocks = AES_CTR_BATCH_BLOCKS;
+    }
+
+    for (size_t b = 0; b < blocks; ++b) {
+      std::memcpy(counterBlocks + b * 16, counter, 16);
+
+      if (gcmCounter) {
+        addCounter32(counter, 1);
+      } else {
+        addCounter128(counter, 1);
+      }
+    }
+
+    aes256EncryptBlocks(ctx, counterBlocks, keystream, blocks);
+    size_t n = blocks * 16 < length ? blocks * 16 : length;
+
+    for (size_t i = 0; i < n; ++i) {
+      output[i] = input[i] ^ keystream[i];
+    }
+
+    input += n;
+    output += n;
+    length -= n;
+  }
+
+  Security::secureMemset(keystream, 0, sizeof(keystream));
+}
+
+bool aes256CryptCTR(const AES256Context *ctx, uint8_t *counter,
+                    const uint8_t *input, uint8_t *output, size_t length) {
+  if (!ctx || !ctx->isInitialized || !counter || !input || !output || length == 0) {
+    return false;
+  }
+
+  size_t chunkSize = 0;
+  size_t chunks = planParallelChunks(length, chunkSize);
+
+  if (chunks > 1) {
+    // Her parça kendi sayaç kopyasıyla başlar: counter + offset / 16
+    std::vector<uint8_t> counters(chunks * 16);
+
+    for (size_t c = 0; c < chunks; ++c) {
+      std::memcpy(&counters[c * 16], counter, 16);
+      addCounter128(&counters[c * 16], (c * chunkSize) / 16);
+    }
+
+    runParallelChunks(chunks, [&](size_t c) {
+      size_t offset = c * chunkSize;
+      size_t len = (length - offset) < chunkSize ? (length - offset) : chunkSize;
+      aesCTRXor(ctx, &counters[c * 16], false, input + offset, output + offset, len);
+    });
+    addCounter128(counter, (length + 15) / 16);
+    return true;
+  }
+
+  aesCTRXor(ctx, counter, false, input, output, length);
+  return true;
+}
+
+bool encryptAES256CTR(const void *plaintext, size_t plaintextLen,
+                      const uint8_t *key, const uint8_t *iv,
+                      void *ciphertext) {
+  if (!plaintext || plaintextLen == 0 || !key || !iv || !ciphertext) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  uint8_t counter[16];
+  std::memcpy(counter, iv, 16);
+  return aes256CryptCTR(ctx, counter, static_cast<const uint8_t *>(plaintext),
+                        static_cast<uint8_t *>(ciphertext), plaintextLen);
+}
+
+bool decryptAES256CTR(const void *ciphertext, size_t ciphertextLen,
+                      const uint8_t *key, const uint8_t *iv,
+                      void *plaintext) {
+  // CTR modunda şifre çözme, şifreleme ile aynı işlemdir
+  return encryptAES256CTR(ciphertext, ciphertextLen, key, iv, plaintext);
+}
+
+// ============================================
+// AES-256-GCM - GHASH
+// ============================================
+
+/**
+ * @brief GHASH anahtarı (H = AES_K(0^128)) ve önceden hesaplanmış kuvvetleri
+ */
+struct GHASHKey {
+  uint64_t hHigh;                 /**< @brief H'nin yüksek 64 biti (taşınabilir yol) */
+  uint64_t hLow;                  /**< @brief H'nin düşük 64 biti (taşınabilir yol) */
+  alignas(16) uint8_t hPowers[4][16]; /**< @brief H^1..H^4 (PCLMUL yolu, byte sırası ters) */
+  bool usePclmul;                 /**< @brief PCLMULQDQ kullanılıyor mu? */
+};
+
+/**
+ * @brief Big-endian 64-bit word oku
+ *
+ * @param p Kaynak (8 byte)
+ * @return 64-bit word
+ */
+static inline uint64_t loadBE64(const uint8_t *p) {
+  return (static_cast<uint64_t>(loadBE32(p)) << 32) | loadBE32(p + 4);
+}
+
+/**
+ * @brief Big-endian 64-bit word yaz
+ *
+ * @param p Hedef (8 byte)
+ * @param v Yazılacak değer
+ */
+static inline void storeBE64(uint8_t *p, uint64_t v) {
+  storeBE32(p, static_cast<uint32_t>(v >> 32));
+  storeBE32(p + 4, static_cast<uint32_t>(v));
+}
+
+/**
+ * @brief GF(2^128) çarpımı (NIST SP 800-38D Algoritma 1, sabit zamanlı)
+ *
+ * Veri bağımlı dallanma ve tablo erişimi yoktur; her bit maske ile işlenir.
+ *
+ * @param xHigh X'in yüksek 64 biti (girdi/çıktı: X * Y)
+ * @param xLow X'in düşük 64 biti (girdi/çıktı)
+ * @param yHigh Y'nin yüksek 64 biti
+ * @param yLow Y'nin düşük 64 biti
+ */
+static void gfMul128(uint64_t &xHigh, uint64_t &xLow, uint64_t yHigh, uint64_t yLow) {
+  uint64_t zHigh = 0, zLow = 0;
+  uint64_t vHigh = yHigh, vLow = yLow;
+
+  for (int i = 0; i < 128; ++i) {
+    uint64_t bit = (i < 64) ? (xHigh >> (63 - i)) & 1 : (xLow >> (127 - i)) & 1;
+    uint64_t mask = 0 - bit;
+    zHigh ^= vHigh & mask;
+    zLow ^= vLow & mask;
+    uint64_t lsbMask = 0 - (vLow & 1);
+    vLow = (vLow >> 1) | (vHigh << 63);
+    vHigh = (vHigh >> 1) ^ (0xe100000000000000ULL & lsbMask);
+  }
+
+  xHigh = zHigh;
+  xLow = zLow;
+}
+
+#ifdef TRAVELEXPENSE_AES_X86
+/**
+ * @brief PCLMULQDQ ile GF(2^128) çarpımı (byte sırası ters alanda)
+ *
+ * Intel "Carry-Less Multiplication and Its Usage for Computing the GCM Mode"
+ * makalesindeki karatsuba'sız çarpım + bit kaydırmalı indirgeme.
+ *
+ * @param a Birinci çarpan (byte sırası ters)
+ * @param b İkinci çarpan (byte sırası ters)
+ * @return __m128i a * b (byte sırası ters)
+ */
+AES_TARGET_PCLMUL static inline __m128i pclmulGfMul(__m128i a, __m128i b) {
+  __m128i lo = _mm_clmulepi64_si128(a, b, 0x00);
+  __m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+  __m128i hi = _mm_clmulepi64_si128(a, b, 0x11);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+  // 256-bit sonucu bir bit sola kaydır (yansıtılmış gösterim)
+  __m128i loCarry = _mm_srli_epi32(lo, 31);
+  __m128i hiCarry = _mm_srli_epi32(hi, 31);
+  lo = _mm_slli_epi32(lo, 1);
+  hi = _mm_slli_epi32(hi, 1);
+  __m128i crossCarry = _mm_srli_si128(loCarry, 12);
+  hiCarry = _mm_slli_si128(hiCarry, 4);
+  loCarry = _mm_slli_si128(loCarry, 4);
+  lo = _mm_or_si128(lo, loCarry);
+  hi = _mm_or_si128(_mm_or_si128(hi, hiCarry), crossCarry);
+  // x^128 + x^7 + x^2 + x + 1 ile indirgeme
+  __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+                            _mm_slli_epi32(lo, 25));
+  __m128i tHigh = _mm_srli_si128(t, 4);
+  t = _mm_slli_si128(t, 12);
+  lo = _mm_xor_si128(lo, t);
+  __m128i r = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+                            _mm_srli_epi32(lo, 7));
+  r = _mm_xor_si128(r, tHigh);
+  lo = _mm_xor_si128(lo, r);
+  return _mm_xor_si128(hi, lo);
+}
+
+/**
+ * @brief 16 byte'ın sırasını ters çevir (GCM <-> PCLMUL gösterimi)
+ *
+ * @param v Girdi
+ * @return __m128i Byte sırası ters çevrilmiş değer
+ */
+AES_TARGET_PCLMUL static inline __m128i ghashByteSwap(__m128i v) {
+  return _mm_shuffle_epi8(v, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+}
+
+/**
+ * @brief H^1..H^4 kuvvetlerini PCLMUL gösteriminde hesapla
+ *
+ * @param h H (16 byte, GCM byte sırası)
+ * @param powers Çıktı kuvvetler (4 x 16 byte)
+ */
+AES_TARGET_PCLMUL static void pclmulGhashPowers(const uint8_t *h, uint8_t powers[4][16]) {
+  __m128i h1 = ghashByteSwap(_mm_loadu_si128(reinterpret_cast<const __m128i *>(h)));
+  __m128i hn = h1;
+
+  for (int i = 0; i < 4; ++i) {
+    _mm_store_si128(reinterpret_cast<__m128i *>(powers[i]), hn);
+    hn = pclmulGfMul(hn, h1);
+  }
+}
+
+/**
+ * @brief PCLMULQDQ ile GHASH (4 blok birleşik indirgeme)
+ *
+ * X' = (X ^ C1)*H^4 ^ C2*H^3 ^ C3*H^2 ^ C4*H; dört çarpım birbirinden
+ * bağımsız olduğundan pipeline'da paralel yürür.
+ *
+ * @param powers H^1..H^4
+ * @param state GHASH durumu (16 byte, GCM byte sırası, girdi/çıktı)
+ * @param data Veri (blocks * 16 byte)
+ * @param blocks Blok sayısı
+ */
+AES_TARGET_PCLMUL static void pclmulGhashBlocks(const uint8_t powers[4][16], uint8_t *state,
+    const uint8_t *data, size_t blocks) {
+  __m128i h1 = _mm_load_si128(reinterpret_cast<const __m128i *>(powers[0]));
+  __m128i h2 = _mm_load_si128(reinterpret_cast<const __m128i *>(powers[1]));
+  __m128i h3 = _mm_load_si128(reinterpret_cast<const __m128i *>(powers[2]));
+  __m128i h4 = _mm_load_si128(reinterpret_cast<const __m128i *>(powers[3]));
+  __m128i x = ghashByteSwap(_mm_loadu_si128(reinterpret_cast<const __m128i *>(state)));
+  size_t i = 0;
+
+  for (; i + 4 <= blocks; i += 4) {
+    const __m128i *p = reinterpret_cast<const __m128i *>(data + i * 16);
+    __m128i c0 = _mm_xor_si128(x, ghashByteSwap(_mm_loadu_si128(p)));
+    __m128i c1 = ghashByteSwap(_mm_loadu_si128(p + 1));
+    __m128i c2 = ghashByteSwap(_mm_loadu_si128(p + 2));
+    __m128i c3 = ghashByteSwap(_mm_loadu_si128(p + 3));
+    x = _mm_xor_si128(_mm_xor_si128(pclmulGfMul(c0, h4), pclmulGfMul(c1, h3)),
+                      _mm_xor_si128(pclmulGfMul(c2, h2), pclmulGfMul(c3, h1)));
+  }
+
+  for (; i < blocks; ++i) {
+    __m128i c = ghashByteSwap(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i * 16)));
+    x = pclmulGfMul(_mm_xor_si128(x, c), h1);
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(state), ghashByteSwap(x));
+}
+#endif // TRAVELEXPENSE_AES_X86
+
+/**
+ * @brief GHASH anahtarını hazırla
+ *
+ * @param gk Çıktı GHASH anahtarı
+ * @param ctx AES bağlamı (H = AES_K(0^128) hesaplanır)
+ */
+static void initGHASHKey(GHASHKey *gk, const AES256Context *ctx) {
+  uint8_t h[16] = {0};
+  aes256EncryptBlocks(ctx, h, h, 1);
+  gk->hHigh = loadBE64(h);
+  gk->hLow = loadBE64(h + 8);
+  gk->usePclmul = false;
+#ifdef TRAVELEXPENSE_AES_X86
+
+  // Taşınabilir AES arka ucu zorlandıysa GHASH da taşınabilir yolda kalır
+  if (ctx->backend != AESBackend::Portable && getAESCPUFeatures().pclmul) {
+    pclmulGhashPowers(h, gk->hPowers);
+    gk->usePclmul = true;
+  }
+
+#endif
+  Security::secureMemset(h, 0, sizeof(h));
+}
+
+/**
+ * @brief GHASH durumunu tam bloklarla güncelle
+ *
+ * @param gk GHASH anahtarı
+ * @param state GHASH durumu (16 byte, girdi/çıktı)
+ * @param data Veri
+ * @param blocks Blok sayısı
+ */
+static void ghashBlocks(const GHASHKey *gk, uint8_t *state, const uint8_t *data, size_t blocks) {
+#ifdef TRAVELEXPENSE_AES_X86
+
+  if (gk->usePclmul) {
+    pclmulGhashBlocks(gk->hPowers, state, data, blocks);
+    return;
+  }
+
+#endif
+  uint64_t xHigh = loadBE64(state);
+  uint64_t xLow = loadBE64(state + 8);
+
+  for (size_t i = 0; i < blocks; ++i) {
+    xHigh ^= loadBE64(data + i * 16);
+    xLow ^= loadBE64(data + i * 16 + 8);
+    gfMul128(xHigh, xLow, gk->hHigh, gk->hLow);
+  }
+
+  storeBE64(state, xHigh);
+  storeBE64(state + 8, xLow);
+}
+
+/**
+ * @brief GHASH durumunu güncelle (son eksik blok sıfırla doldurulur)
+ *
+ * @param gk GHASH anahtarı
+ * @param state GHASH durumu (girdi/çıktı)
+ * @param data Veri
+ * @param length Veri uzunluğu (byte)
+ */
+static void ghashPadded(const GHASHKey *gk, uint8_t *state, const uint8_t *data, size_t length) {
+  size_t fullBlocks = length / 16;
+
+  if (fullBlocks > 0) {
+    ghashBlocks(gk, state, data, fullBlocks);
+  }
+
+  size_t tail = length % 16;
+
+  if (tail > 0) {
+    uint8_t last[16] = {0};
+    std::memcpy(last, data + fullBlocks * 16, tail);
+    ghashBlocks(gk, state, last, 1);
+  }
+}
+
+/**
+ * @brief Bir GCM parçasını işle (CTR + GHASH, tek geçiş)
+ *
+ * Veri 4 KiB'lık dilimler halinde işlenir; her dilim şifrelendikten hemen
+ * sonra (cache'teyken) GHASH'e girer.
+ *
+ * @param ctx AES bağlamı
+ * @param gk GHASH anahtarı
+ * @param counter Parçanın başlangıç sayacı (girdi/çıktı)
+ * @param input Girdi verisi
+ * @param output Çıktı verisi
+ * @param length Parça uzunluğu
+ * @param encrypt true ise şifreleme (GHASH çıktı üzerinde), false ise şifre çözme (GHASH girdi üzerinde)
+ * @param state Parçanın GHASH durumu (sıfırdan başlar, çıktı)
+ */
+static void gcmProcessChunk(const AES256Context *ctx, const GHASHKey *gk, uint8_t *counter,
+                            const uint8_t *input, uint8_t *output, size_t length,
+                            bool encrypt, uint8_t *state) {
+  const size_t sliceSize = 4096;
+  std::memset(state, 0, 16);
+
+  for (size_t offset = 0; offset < length; offset += sliceSize) {
+    size_t len = (length - offset) < sliceSize ? (length - offset) : sliceSize;
+
+    if (!encrypt) {
+      ghashPadded(gk, state, input + offset, len);
+    }
+
+    aesCTRXor(ctx, counter, true, input + offset, output + offset, len);
+
+    if (encrypt) {
+      ghashPadded(gk, state, output + offset, len);
+    }
+  }
+}
+
+/**
+ * @brief GCM şifreleme/şifre çözme ve etiket hesaplama (ortak çekirdek)
+ *
+ * Büyük veriler parçalara bölünür; her parçanın GHASH'i sıfırdan hesaplanır ve
+ * S = S * H^n ^ S_parça formülüyle sırayla birleştirilir.
+ *
+ * @param ctx AES bağlamı
+ * @param iv Nonce (12 byte)
+ * @param aad Ek doğrulanan veri
+ * @param aadLen Ek veri uzunluğu
+ * @param input Girdi verisi
+ * @param output Çıktı verisi
+ * @param length Veri uzunluğu
+ * @param encrypt Şifreleme mi?
+ * @param tag Hesaplanan etiket çıktısı (16 byte)
+ */
+static void aesGCMCrypt(const AES256Context *ctx, const uint8_t *iv,
+                        const uint8_t *aad, size_t aadLen,
+                        const uint8_t *input, uint8_t *output, size_t length,
+                        bool encrypt, uint8_t *tag) {
+  GHASHKey gk;
+  initGHASHKey(&gk, ctx);
+  // J0 = IV || 0^31 || 1
+  uint8_t j0[16];
+  std::memcpy(j0, iv, 12);
+  storeBE32(j0 + 12, 1);
+  uint8_t state[16] = {0};
+
+  if (aadLen > 0) {
+    ghashPadded(&gk, state, aad, aadLen);
+  }
+
+  if (length > 0) {
+    size_t chunkSize = 0;
+    size_t chunks = planParallelChunks(length, chunkSize);
+    std::vector<uint8_t> chunkStates(chunks * 16);
+    std::vector<uint8_t> counters(chunks * 16);
+
+    for (size_t c = 0; c < chunks; ++c) {
+      std::memcpy(&counters[c * 16], j0, 16);
+      addCounter32(&counters[c * 16], 1 + (c * chunkSize) / 16);
+    }
+
+    runParallelChunks(chunks, [&](size_t c) {
+      size_t offset = c * chunkSize;
+      size_t len = (length - offset) < chunkSize ? (length - offset) : chunkSize;
+      gcmProcessChunk(ctx, &gk, &counters[c * 16], input + offset, output + offset, len,
+                      encrypt, &chunkStates[c * 16]);
+    });
+
+    // Parça GHASH'lerini birleştir: S = S * H^n ^ S_c
+    uint64_t sHigh = loadBE64(state);
+    uint64_t sLow = loadBE64(state + 8);
+
+    for (size_t c = 0; c < chunks; ++c) {
+      size_t offset = c * chunkSize;
+      size_t len = (length - offset) < chunkSize ? (length - offset) : chunkSize;
+      uint64_t blocks = (len + 15) / 16;
+      // H^blocks (kare al ve çarp)
+      uint64_t pHigh = 0x8000000000000000ULL, pLow = 0; // GF(2^128)'de 1
+      uint64_t bHigh = gk.hHigh, bLow = gk.hLow;
+
+      while (blocks > 0) {
+        if (blocks & 1) {
+          gfMul128(pHigh, pLow, bHigh, bLow);
+        }
+
+        gfMul128(bHigh, bLow, bHigh, bLow);
+        blocks >>= 1;
+      }
+
+      gfMul128(sHigh, sLow, pHigh, pLow);
+      sHigh ^= loadBE64(&chunkStates[c * 16]);
+      sLow ^= loadBE64(&chunkStates[c * 16 + 8]);
+    }
+
+    storeBE64(state, sHigh);
+    storeBE64(state + 8, sLow);
+  }
+
+  // Uzunluk bloğu: len(A) || len(C) (bit cinsinden, 64-bit big-endian)
+  uint8_t lengths[16];
+  storeBE64(lengths, static_cast<uint64_t>(aadLen) * 8);
+  storeBE64(lengths + 8, static_cast<uint64_t>(length) * 8);
+  ghashBlocks(&gk, state, lengths, 1);
+  // Tag = AES_K(J0) ^ S
+  aes256EncryptBlocks(ctx, j0, tag, 1);
+
+  for (int i = 0; i < 16; ++i) {
+    tag[i] ^= state[i];
+  }
+
+  Security::secureMemset(&gk, 0, sizeof(gk));
+}
+
+bool aes256EncryptGCM(const AES256Context *ctx, const uint8_t *iv,
+                      const void *aad, size_t aadLen,
+                      const void *plaintext, size_t plaintextLen,
+                      void *ciphertext, uint8_t *tag) {
+  if (!ctx || !ctx->isInitialized || !iv || !tag || (aadLen > 0 && !aad) ||
+      (plaintextLen > 0 && (!plaintext || !ciphertext))) {
+    return false;
+  }
+
+  aesGCMCrypt(ctx, iv, static_cast<const uint8_t *>(aad), aadLen,
+              static_cast<const uint8_t *>(plaintext), static_cast<uint8_t *>(ciphertext),
+              plaintextLen, true, tag);
+  return true;
+}
+
+bool aes256DecryptGCM(const AES256Context *ctx, const uint8_t *iv,
+                      const void *aad, size_t aadLen,
+                      const void *ciphertext, size_t ciphertextLen,
+                      const uint8_t *tag, void *plaintext) {
+  if (!ctx || !ctx->isInitialized || !iv || !tag || (aadLen > 0 && !aad) ||
+      (ciphertextLen > 0 && (!ciphertext || !plaintext))) {
+    return false;
+  }
+
+  uint8_t expectedTag[16];
+  aesGCMCrypt(ctx, iv, static_cast<const uint8_t *>(aad), aadLen,
+              static_cast<const uint8_t *>(ciphertext), static_cast<uint8_t *>(plaintext),
+              ciphertextLen, false, expectedTag);
+
+  if (!constantTimeCompare(reinterpret_cast<const char *>(expectedTag),
+                           reinterpret_cast<const char *>(tag), 16)) {
+    // Doğrulanmamış düz metni çağırana bırakma
+    if (ciphertextLen > 0) {
+      Security::secureMemset(plaintext, 0, ciphertextLen);
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
+bool encryptAES256GCM(const void *plaintext, size_t plaintextLen,
+                      const uint8_t *key, const uint8_t *iv,
+                      const void *aad, size_t aadLen,
+                      void *ciphertext, uint8_t *tag) {
+  if (!key) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  return aes256EncryptGCM(ctx, iv, aad, aadLen, plaintext, plaintextLen, ciphertext, tag);
+}
+
+bool decryptAES256GCM(const void *ciphertext, size_t ciphertextLen,
+                      const uint8_t *key, const uint8_t *iv,
+                      const void *aad, size_t aadLen,
+                      const uint8_t *tag, void *plaintext) {
+  if (!key) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  return aes256DecryptGCM(ctx, iv, aad, aadLen, ciphertext, ciphertextLen, tag, plaintext);
+}
+
+// ============================================
+// YERİNDE VE SCATTER/GATHER ŞİFRELEME
+// ============================================
+
+/**
+ * @brief Artımlı (streaming) GCM durumu
+ *
+ * Verinin parça parça ve blok hizasız gelmesine izin verir; anahtar akışı ve
+ * GHASH için kısmi blok durumu birlikte tutulur (ikisi de konum mod 16'ya bağlı).
+ */
+struct GCMStream {
+  const AES256Context *ctx; /**< @brief AES bağlamı */
+  GHASHKey gk;              /**< @brief GHASH anahtarı */
+  uint8_t j0[16];           /**< @brief J0 = IV || 1 */
+  uint8_t counter[16];      /**< @brief Sonraki sayaç bloğu */
+  uint8_t keystream[16];    /**< @brief Kısmi bloğun anahtar akışı */
+  uint8_t state[16];        /**< @brief GHASH durumu */
+  uint8_t pending[16];      /**< @brief GHASH'e girmeyi bekleyen şifreli kısmi blok */
+  size_t partialLen;        /**< @brief Kısmi bloktaki byte sayısı (0-15) */
+  uint64_t aadLen;          /**< @brief Ek veri uzunluğu */
+  uint64_t dataLen;         /**< @brief İşlenen veri uzunluğu */
+  bool encrypt;             /**< @brief Şifreleme mi? */
+};
+
+/**
+ * @brief GCM akışını başlat ve ek veriyi (AAD) işle
+ *
+ * @param s Akış durumu
+ * @param ctx AES bağlamı
+ * @param iv Nonce (12 byte)
+ * @param aad Ek veri
+ * @param aadLen Ek veri uzunluğu
+ * @param encrypt Şifreleme mi?
+ */
+static void gcmStreamInit(GCMStream *s, const AES256Context *ctx, const uint8_t *iv,
+                          const uint8_t *aad, size_t aadLen, bool encrypt) {
+  s->ctx = ctx;
+  initGHASHKey(&s->gk, ctx);
+  std::memcpy(s->j0, iv, 12);
+  storeBE32(s->j0 + 12, 1);
+  std::memcpy(s->counter, s->j0, 16);
+  addCounter32(s->counter, 1);
+  std::memset(s->state, 0, 16);
+  s->partialLen = 0;
+  s->aadLen = aadLen;
+  s->dataLen = 0;
+  s->encrypt = encrypt;
+
+  if (aadLen > 0) {
+    ghashPadded(&s->gk, s->state, aad, aadLen);
+  }
+}
+
+/**
+ * @brief Kısmi blok byte'larını işle (anahtar akışı + GHASH biriktirme)
+ *
+ * @param s Akış durumu
+ * @param in Girdi
+ * @param out Çıktı (in ile aynı olabilir)
+ * @param len Byte sayısı (kısmi bloğu aşmamalı)
+ */
+static void gcmStreamPartial(GCMStream *s, const uint8_t *in, uint8_t *out, size_t len) {
+  if (s->partialLen == 0) {
+    aes256EncryptBlocks(s->ctx, s->counter, s->keystream, 1);
+    addCounter32(s->counter, 1);
+  }
+
+  for (size_t i = 0; i < len; ++i) {
+    uint8_t inByte = in[i];
+    uint8_t outByte = inByte ^ s->keystream[s->partialLen];
+    s->pending[s->partialLen++] = s->encrypt ? outByte : inByte;
+    out[i] = outByte;
+  }
+
+  if (s->partialLen == 16) {
+    ghashBlocks(&s->gk, s->state, s->pending, 1);
+    s->partialLen = 0;
+  }
+}
+
+/**
+ * @brief GCM akışına veri ekle
+ *
+ * Blok hizalı kısım 4 KiB'lık dilimler halinde toplu CTR + GHASH ile işlenir.
+ *
+ * @param s Akış durumu
+ * @param in Girdi
+ * @param out Çıktı (in ile aynı olabilir)
+ * @param len Uzunluk
+ */
+static void gcmStreamUpdate(GCMStream *s, const uint8_t *in, uint8_t *out, size_t len) {
+  s->dataLen += len;
+
+  if (s->partialLen > 0) {
+    size_t take = 16 - s->partialLen;
+
+    if (take > len) {
+      take = len;
+    }
+
+    gcmStreamPartial(s, in, out, take);
+    in += take;
+    out += take;
+    len -= take;
+  }
+
+  const size_t sliceSize = 4096;
+
+  while (len >= 16) {
+    size_t n = len < sliceSize ? (len & ~static_cast<size_t>(15)) : sliceSize;
+
+    if (!s->encrypt) {
+      ghashBlocks(&s->gk, s->state, in, n / 16);
+    }
+
+    aesCTRXor(s->ctx, s->counter, true, in, out, n);
+
+    if (s->encrypt) {
+      ghashBlocks(&s->gk, s->state, out, n / 16);
+    }
+
+    in += n;
+    out += n;
+    len -= n;
+  }
+
+  if (len > 0) {
+    gcmStreamPartial(s, in, out, len);
+  }
+}
+
+/**
+ * @brief GCM akışını bitir ve etiketi hesapla
+ *
+ * @param s Akış durumu (işlem sonunda silinir)
+ * @param tag Etiket çıktısı (16 byte)
+ */
+static void gcmStreamFinish(GCMStream *s, uint8_t *tag) {
+  if (s->partialLen > 0) {
+    std::memset(s->pending + s->partialLen, 0, 16 - s->partialLen);
+    ghashBlocks(&s->gk, s->state, s->pending, 1);
+  }
+
+  uint8_t lengths[16];
+  storeBE64(lengths, s->aadLen * 8);
+  storeBE64(lengths + 8, s->dataLen * 8);
+  ghashBlocks(&s->gk, s->state, lengths, 1);
+  aes256EncryptBlocks(s->ctx, s->j0, tag, 1);
+
+  for (int i = 0; i < 16; ++i) {
+    tag[i] ^= s->state[i];
+  }
+
+  Security::secureMemset(s, 0, sizeof(GCMStream));
+}
+
+/**
+ * @brief IOVec dizisini doğrula ve toplam uzunluğu hesapla
+ *
+ * @param iov Parçalar
+ * @param iovCount Parça sayısı
+ * @param total Toplam uzunluk (çıktı)
+ * @return true Geçerli, false Hata (boş base'li uzunluk, taşma)
+ */
+static bool sumIOVec(const IOVec *iov, size_t iovCount, size_t &total) {
+  total = 0;
+
+  if (iovCount > 0 && !iov) {
+    return false;
+  }
+
+  for (size_t i = 0; i < iovCount; ++i) {
+    if (iov[i].length > 0 && !iov[i].base) {
+      return false;
+    }
+
+    if (total + iov[i].length < total) {
+      return false;
+    }
+
+    total += iov[i].length;
+  }
+
+  return true;
+}
+
+bool encryptAES256InPlace(void *buffer, size_t dataLen, size_t bufferCapacity,
+                          const uint8_t *key, const uint8_t *iv,
+                          size_t &ciphertextLen) {
+  if (!buffer || dataLen == 0 || !key || !iv) {
+    return false;
+  }
+
+  size_t paddedLen = (dataLen / 16 + 1) * 16;
+
+  if (bufferCapacity < paddedLen) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  uint8_t *data = static_cast<uint8_t *>(buffer);
+  std::memset(data + dataLen, static_cast<int>(paddedLen - dataLen), paddedLen - dataLen);
+  uint8_t chain[16];
+  std::memcpy(chain, iv, 16);
+  aes256EncryptCBC(ctx, chain, data, data, paddedLen / 16);
+  ciphertextLen = paddedLen;
+  return true;
+}
+
+bool decryptAES256InPlace(void *buffer, size_t ciphertextLen,
+                          const uint8_t *key, const uint8_t *iv,
+                          size_t &plaintextLen) {
+  // CBC çözme çekirdeği yerinde çalışmayı destekler
+  return decryptAES256(buffer, ciphertextLen, key, iv, buffer, plaintextLen);
+}
+
+bool encryptAES256Gather(const IOVec *iov, size_t iovCount,
+                         const uint8_t *key, const uint8_t *iv,
+                         void *ciphertext, size_t &ciphertextLen) {
+  size_t total = 0;
+
+  if (!sumIOVec(iov, iovCount, total) || total == 0 || !key || !iv || !ciphertext) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  uint8_t *out = static_cast<uint8_t *>(ciphertext);
+  uint8_t chain[16];
+  std::memcpy(chain, iv, 16);
+  // Parça sınırında yarım kalan blok
+  uint8_t carry[16];
+  size_t carryLen = 0;
+
+  for (size_t i = 0; i < iovCount; ++i) {
+    const uint8_t *p = static_cast<const uint8_t *>(iov[i].base);
+    size_t n = iov[i].length;
+
+    if (carryLen > 0) {
+      size_t take = (16 - carryLen) < n ? (16 - carryLen) : n;
+      std::memcpy(carry + carryLen, p, take);
+      carryLen += take;
+      p += take;
+      n -= take;
+
+      if (carryLen < 16) {
+        continue;
+      }
+
+      aes256EncryptCBC(ctx, chain, carry, out, 1);
+      out += 16;
+      carryLen = 0;
+    }
+
+    // Tam bloklar doğrudan parçadan çıktıya şifrelenir (kopya yok)
+    size_t fullBlocks = n / 16;
+
+    if (fullBlocks > 0) {
+      aes256EncryptCBC(ctx, chain, p, out, fullBlocks);
+      out += fullBlocks * 16;
+      p += fullBlocks * 16;
+      n -= fullBlocks * 16;
+    }
+
+    if (n > 0) {
+      std::memcpy(carry, p, n);
+      carryLen = n;
+    }
+  }
+
+  // PKCS7 padding (her zaman en az 1 byte)
+  std::memset(carry + carryLen, static_cast<int>(16 - carryLen), 16 - carryLen);
+  aes256EncryptCBC(ctx, chain, carry, out, 1);
+  out += 16;
+  Security::secureMemset(carry, 0, sizeof(carry));
+  ciphertextLen = static_cast<size_t>(out - static_cast<uint8_t *>(ciphertext));
+  return true;
+}
+
+bool decryptAES256Scatter(const void *ciphertext, size_t ciphertextLen,
+                          const uint8_t *key, const uint8_t *iv,
+                          const IOVec *iov, size_t iovCount,
+                          size_t &plaintextLen) {
+  size_t capacity = 0;
+
+  if (!ciphertext || ciphertextLen == 0 || ciphertextLen % 16 != 0 || !key || !iv ||
+      !sumIOVec(iov, iovCount, capacity)) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  const uint8_t *in = static_cast<const uint8_t *>(ciphertext);
+  size_t blocks = ciphertextLen / 16;
+  // Son bloğu önce çöz: padding doğrulanmadan hedeflere yazılmaz
+  uint8_t lastBlock[16];
+  uint8_t lastChain[16];
+  std::memcpy(lastChain, blocks > 1 ? in + ciphertextLen - 32 : iv, 16);
+  aes256DecryptCBC(ctx, lastChain, in + ciphertextLen - 16, lastBlock, 1);
+  size_t paddingLen = 0;
+
+  if (!pkcs7PaddingLength(lastBlock, 16, paddingLen) || capacity < ciphertextLen - paddingLen) {
+    Security::secureMemset(lastBlock, 0, sizeof(lastBlock));
+    return false;
+  }
+
+  uint8_t chain[16];
+  std::memcpy(chain, iv, 16);
+  size_t remainingBlocks = blocks - 1;
+  size_t seg = 0;
+  size_t segOffset = 0;
+  uint8_t block[16];
+
+  while (remainingBlocks > 0) {
+    while (iov[seg].length == segOffset) {
+      ++seg;
+      segOffset = 0;
+    }
+
+    uint8_t *dst = static_cast<uint8_t *>(iov[seg].base) + segOffset;
+    size_t direct = (iov[seg].length - segOffset) / 16;
+
+    if (direct > remainingBlocks) {
+      direct = remainingBlocks;
+    }
+
+    if (direct > 0) {
+      // Tam bloklar doğrudan hedef parçaya çözülür
+      aes256DecryptCBC(ctx, chain, in, dst, direct);
+      in += direct * 16;
+      segOffset += direct * 16;
+      remainingBlocks -= direct;
+      continue;
+    }
+
+    // Parça sınırına denk gelen blok: yığında çöz, parçalara böl
+    aes256DecryptCBC(ctx, chain, in, block, 1);
+    in += 16;
+    --remainingBlocks;
+
+    for (size_t copied = 0; copied < 16;) {
+      while (iov[seg].length == segOffset) {
+        ++seg;
+        segOffset = 0;
+      }
+
+      size_t take = iov[seg].length - segOffset;
+
+      if (take > 16 - copied) {
+        take = 16 - copied;
+      }
+
+      std::memcpy(static_cast<uint8_t *>(iov[seg].base) + segOffset, block + copied, take);
+      segOffset += take;
+      copied += take;
+    }
+  }
+
+  // Son bloğun padding dışındaki kısmı
+  for (size_t copied = 0; copied < 16 - paddingLen;) {
+    while (iov[seg].length == segOffset) {
+      ++seg;
+      segOffset = 0;
+    }
+
+    size_t take = iov[seg].length - segOffset;
+
+    if (take > 16 - paddingLen - copied) {
+      take = 16 - paddingLen - copied;
+    }
+
+    std::memcpy(static_cast<uint8_t *>(iov[seg].base) + segOffset, lastBlock + copied, take);
+    segOffset += take;
+    copied += take;
+  }
+
+  Security::secureMemset(block, 0, sizeof(block));
+  Security::secureMemset(lastBlock, 0, sizeof(lastBlock));
+  plaintextLen = ciphertextLen - paddingLen;
+  return true;
+}
+
+bool encryptAES256GCMGather(const IOVec *iov, size_t iovCount,
+                            const uint8_t *key, const uint8_t *iv,
+                            const void *aad, size_t aadLen,
+                            void *ciphertext, uint8_t *tag) {
+  size_t total = 0;
+
+  if (!sumIOVec(iov, iovCount, total) || !key || !iv || !tag ||
+      (aadLen > 0 && !aad) || (total > 0 && !ciphertext)) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  GCMStream stream;
+  gcmStreamInit(&stream, ctx, iv, static_cast<const uint8_t *>(aad), aadLen, true);
+  uint8_t *out = static_cast<uint8_t *>(ciphertext);
+
+  for (size_t i = 0; i < iovCount; ++i) {
+    gcmStreamUpdate(&stream, static_cast<const uint8_t *>(iov[i].base), out, iov[i].length);
+    out += iov[i].length;
+  }
+
+  gcmStreamFinish(&stream, tag);
+  return true;
+}
+
+bool decryptAES256GCMScatter(const void *ciphertext, size_t ciphertextLen,
+                             const uint8_t *key, const uint8_t *iv,
+                             const void *aad, size_t aadLen,
+                             const uint8_t *tag,
+                             const IOVec *iov, size_t iovCount) {
+  size_t capacity = 0;
+
+  if (!sumIOVec(iov, iovCount, capacity) || capacity != ciphertextLen || !key || !iv || !tag ||
+      (aadLen > 0 && !aad) || (ciphertextLen > 0 && !ciphertext)) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  GCMStream stream;
+  gcmStreamInit(&stream, ctx, iv, static_cast<const uint8_t *>(aad), aadLen, false);
+  const uint8_t *in = static_cast<const uint8_t *>(ciphertext);
+
+  for (size_t i = 0; i < iovCount; ++i) {
+    gcmStreamUpdate(&stream, in, static_cast<uint8_t *>(iov[i].base), iov[i].length);
+    in += iov[i].length;
+  }
+
+  uint8_t expectedTag[16];
+  gcmStreamFinish(&stream, expectedTag);
+
+  if (!constantTimeCompare(reinterpret_cast<const char *>(expectedTag),
+                           reinterpret_cast<const char *>(tag), 16)) {
+    // Doğrulanmamış düz metni çağırana bırakma
+    for (size_t i = 0; i < iovCount; ++i) {
+      if (iov[i].length > 0) {
+        Security::secureMemset(iov[i].base, 0, iov[i].length);
+      }
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
+void hmacSHA256Prepare(const uint8_t *key, size_t keyLen, HMACSHA256Midstate &midstate) {
+  uint8_t preparedKey[64];
+  std::memset(preparedKey, 0, sizeof(preparedKey));
+
+  if (keyLen > 64) {
+    Digest256 keyDigest;
+    sha256Digest(key, keyLen, keyDigest);
+    std::memcpy(preparedKey, keyDigest.bytes, 32);
+    Security::secureMemset(&keyDigest, 0, sizeof(keyDigest));
+  } else {
+    std::memcpy(preparedKey, key, keyLen);
+  }
+
+  uint8_t pad[64];
+
+  for (int i = 0; i < 64; ++i) {
+    pad[i] = preparedKey[i] ^ 0x36;
+  }
+
+  sha256Init(&midstate.inner);
+  sha256Update(&midstate.inner, pad, 64);
+
+  for (int i = 0; i < 64; ++i) {
+    pad[i] = preparedKey[i] ^ 0x5c;
+  }
+
+  sha256Init(&midstate.outer);
+  sha256Update(&midstate.outer, pad, 64);
+  Security::secureMemset(preparedKey, 0, sizeof(preparedKey));
+  Security::secureMemset(pad, 0, sizeof(pad));
+}
+
+void hmacSHA256WithMidstate(const HMACSHA256Midstate &midstate,
+                            const void *message, size_t messageLen, Digest256 &digest) {
+  SHA256Context ctx = midstate.inner;
+  sha256Update(&ctx, message, messageLen);
+  Digest256 innerDigest;
+  sha256Final(&ctx, innerDigest);
+  ctx = midstate.outer;
+  sha256Update(&ctx, innerDigest.bytes, sizeof(innerDigest.bytes));
+  sha256Final(&ctx, digest);
+  Security::secureMemset(&innerDigest, 0, sizeof(innerDigest));
+}
+
+// ============================================
+// SHA-256 ÇOKLU BUFFER (MULTI-BUFFER)
+// ============================================
+
+/** @brief Çoklu buffer SHA-256 kanal sayısı (AVX2: 8 x 32-bit) */
+static const size_t SHA256_MULTI_LANES = 8;
+
+#ifdef TRAVELEXPENSE_AES_X86
+/** @brief 8 kanallı sağa döndürme */
+#define SHA256X8_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+
+/**
+ * @brief Sekiz bağımsız SHA-256 durumunu birer blok ile sıkıştır (AVX2)
+ *
+ * Her 256-bit register'ın i. elemanı i. kanala aittir; 64 round tüm
+ * kanallar için aynı komutlarla yürütülür.
+ *
+ * @param states Kanal durumları (states[kanal][word])
+ * @param blocks Kanal başına 64 byte blok
+ */
+SHA_TARGET_AVX2
+static void sha256CompressX8(uint32_t states[][8], const uint8_t *const blocks[]) {
+  __m256i w[64];
+
+  for (int t = 0; t < 16; ++t) {
+    w[t] = _mm256_setr_epi32(
+             static_cast<int>(loadBE32(blocks[0] + t * 4)), static_cast<int>(loadBE32(blocks[1] + t * 4)),
+             static_cast<int>(loadBE32(blocks[2] + t * 4)), static_cast<int>(loadBE32(blocks[3] + t * 4)),
+             static_cast<int>(loadBE32(blocks[4] + t * 4)), static_cast<int>(loadBE32(blocks[5] + t * 4)),
+             static_cast<int>(loadBE32(blocks[6] + t * 4)), static_cast<int>(loadBE32(blocks[7] + t * 4)));
+  }
+
+  for (int t = 16; t < 64; ++t) {
+    __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(SHA256X8_ROTR(w[t - 15], 7), SHA256X8_ROTR(w[t - 15], 18)),
+                                  _mm256_srli_epi32(w[t - 15], 3));
+    __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(SHA256X8_ROTR(w[t - 2], 17), SHA256X8_ROTR(w[t - 2], 19)),
+                                  _mm256_srli_epi32(w[t - 2], 10));
+    w[t] = _mm256_add_epi32(_mm256_add_epi32(w[t - 16], s0), _mm256_add_epi32(w[t - 7], s1));
+  }
+
+  __m256i v[8];
+
+  for (int j = 0; j < 8; ++j) {
+    v[j] = _mm256_setr_epi32(
+             static_cast<int>(states[0][j]), static_cast<int>(states[1][j]),
+             static_cast<int>(states[2][j]), static_cast<int>(states[3][j]),
+             static_cast<int>(states[4][j]), static_cast<int>(states[5][j]),
+             static_cast<int>(states[6][j]), static_cast<int>(states[7][j]));
+  }
+
+  __m256i a = v[0], b = v[1], c = v[2], d = v[3];
+  __m256i e = v[4], f = v[5], g = v[6], h = v[7];
+
+  for (int t = 0; t < 64; ++t) {
+    __m256i sig1 = _mm256_xor_si256(_mm256_xor_si256(SHA256X8_ROTR(e, 6), SHA256X8_ROTR(e, 11)),
+                                    SHA256X8_ROTR(e, 25));
+    __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+    __m256i temp1 = _mm256_add_epi32(_mm256_add_epi32(h, sig1),
+                                     _mm256_add_epi32(_mm256_add_epi32(ch, w[t]),
+                                         _mm256_set1_epi32(static_cast<int>(SHA256_K[t]))));
+    __m256i sig0 = _mm256_xor_si256(_mm256_xor_si256(SHA256X8_ROTR(a, 2), SHA256X8_ROTR(a, 13)),
+                                    SHA256X8_ROTR(a, 22));
+    __m256i maj = _mm256_xor_si256(_mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)),
+                                   _mm256_and_si256(b, c));
+    __m256i temp2 = _mm256_add_epi32(sig0, maj);
+    h = g;
+    g = f;
+    f = e;
+    e = _mm256_add_epi32(d, temp1);
+    d = c;
+    c = b;
+    b = a;
+    a = _mm256_add_epi32(temp1, temp2);
+  }
+
+  v[0] = _mm256_add_epi32(v[0], a);
+  v[1] = _mm256_add_epi32(v[1], b);
+  v[2] = _mm256_add_epi32(v[2], c);
+  v[3] = _mm256_add_epi32(v[3], d);
+  v[4] = _mm256_add_epi32(v[4], e);
+  v[5] = _mm256_add_epi32(v[5], f);
+  v[6] = _mm256_add_epi32(v[6], g);
+  v[7] = _mm256_add_epi32(v[7], h);
+  alignas(32) uint32_t lanes[8];
+
+  for (int j = 0; j < 8; ++j) {
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), v[j]);
+
+    for (int k = 0; k < 8; ++k) {
+      states[k][j] = lanes[k];
+    }
+  }
+}
+
+#undef SHA256X8_ROTR
+#endif
+
+size_t getSHA256MultiBufferLanes() {
+  return getAESCPUFeatures().avx2 ? SHA256_MULTI_LANES : 1;
+}
+
+/**
+ * @struct SHA256Lane
+ * @brief Çoklu buffer SHA-256'da bir kanalın işlediği mesaj
+ *
+ * Mesajın tam blokları yerinde okunur; yalnızca son kısmi blok ve
+ * padding kanalın kendi tail buffer'ına kopyalanır.
+ */
+struct SHA256Lane {
+  const uint8_t *data;  /**< @brief Mesaj verisi */
+  size_t message;       /**< @brief Mesaj indeksi */
+  size_t fullBlocks;    /**< @brief Mesajdan doğrudan okunan blok sayısı */
+  size_t totalBlocks;   /**< @brief Padding dahil blok sayısı */
+  size_t nextBlock;     /**< @brief Sıradaki blok */
+  bool active;          /**< @brief Kanal mesaj işliyor mu */
+  uint8_t tail[128];    /**< @brief Son kısmi blok + padding */
+};
+
+/**
+ * @brief Mesajı kanala yükle
+ *
+ * @param lane Kanal
+ * @param message Mesaj
+ * @param index Mesaj indeksi
+ * @param prefixLength Başlangıç durumuna kadar işlenmiş byte (HMAC için 64)
+ */
+static void loadSHA256Lane(SHA256Lane &lane, const IOVec &message, size_t index, uint64_t prefixLength) {
+  const uint8_t *data = static_cast<const uint8_t *>(message.base);
+  size_t remainder = message.length % 64;
+  lane.data = data;
+  lane.message = index;
+  lane.fullBlocks = message.length / 64;
+  lane.nextBlock = 0;
+  lane.active = true;
+  std::memset(lane.tail, 0, sizeof(lane.tail));
+
+  if (remainder > 0) {
+    std::memcpy(lane.tail, data + lane.fullBlocks * 64, remainder);
+  }
+
+  lane.tail[remainder] = 0x80;
+  size_t tailBlocks = (remainder + 9 <= 64) ? 1 : 2;
+  uint64_t bitLength = (prefixLength + message.length) * 8;
+
+  for (int i = 0; i < 8; ++i) {
+    lane.tail[tailBlocks * 64 - 1 - i] = static_cast<uint8_t>(bitLength >> (i * 8));
+  }
+
+  lane.totalBlocks = lane.fullBlocks + tailBlocks;
+}
+
+/**
+ * @brief Ortak başlangıç durumundan birden fazla mesajın SHA-256 özetini hesapla
+ *
+ * Kanal sayısı kadar mesaj aynı anda işlenir; biten kanala sıradaki mesaj
+ * yüklenir, böylece farklı uzunluktaki mesajlar kanalları boş bırakmaz.
+ *
+ * @param initial Başlangıç zincirleme durumu
+ * @param prefixLength Başlangıç durumuna kadar işlenmiş byte (64'ün katı)
+ * @param messages Mesajlar
+ * @param count Mesaj sayısı
+ * @param digests Özet çıktıları (count adet)
+ */
+static void sha256ManyFromState(const uint32_t initial[8], uint64_t prefixLength,
+                                const IOVec *messages, size_t count, Digest256 *digests) {
+#ifdef TRAVELEXPENSE_AES_X86
+
+  if (getSHA256MultiBufferLanes() > 1 && count > 1) {
+    static const uint8_t idleBlock[64] = {0};
+    SHA256Lane lanes[SHA256_MULTI_LANES];
+    uint32_t states[SHA256_MULTI_LANES][8];
+    const uint8_t *blocks[SHA256_MULTI_LANES];
+    size_t nextMessage = 0;
+    size_t activeLanes = 0;
+
+    for (size_t l = 0; l < SHA256_MULTI_LANES; ++l) {
+      lanes[l].active = false;
+      std::memcpy(states[l], initial, sizeof(states[l]));
+
+      if (nextMessage < count) {
+        loadSHA256Lane(lanes[l], messages[nextMessage], nextMessage, prefixLength);
+        ++nextMessage;
+        ++activeLanes;
+      }
+    }
+
+    while (activeLanes > 0) {
+      for (size_t l = 0; l < SHA256_MULTI_LANES; ++l) {
+        const SHA256Lane &lane = lanes[l];
+
+        if (!lane.active) {
+          blocks[l] = idleBlock;
+        } else if (lane.nextBlock < lane.fullBlocks) {
+          blocks[l] = lane.data + lane.nextBlock * 64;
+        } else {
+          blocks[l] = lane.tail + (lane.nextBlock - lane.fullBlocks) * 64;
+        }
+      }
+
+      sha256CompressX8(states, blocks);
+
+      for (size_t l = 0; l < SHA256_MULTI_LANES; ++l) {
+        SHA256Lane &lane = lanes[l];
+
+        if (!lane.active || ++lane.nextBlock < lane.totalBlocks) {
+          continue;
+        }
+
+        for (int j = 0; j < 8; ++j) {
+          storeBE32(digests[lane.message].bytes + j * 4, states[l][j]);
+        }
+
+        std::memcpy(states[l], initial, sizeof(states[l]));
+        lane.active = false;
+        --activeLanes;
+
+        if (nextMessage < count) {
+          loadSHA256Lane(lane, messages[nextMessage], nextMessage, prefixLength);
+          ++nextMessage;
+          ++activeLanes;
+        }
+      }
+    }
+
+    Security::secureMemset(lanes, 0, sizeof(lanes));
+    Security::secureMemset(states, 0, sizeof(states));
+    return;
+  }
+
+#endif
+
+  for (size_t i = 0; i < count; ++i) {
+    SHA256Context ctx;
+    std::memcpy(ctx.state, initial, sizeof(ctx.state));
+    ctx.bufferLength = 0;
+    ctx.totalLength = prefixLength;
+    sha256Update(&ctx, messages[i].base, messages[i].length);
+    sha256Final(&ctx, digests[i]);
+    Security::secureMemset(&ctx, 0, sizeof(ctx));
+  }
+}
+
+bool sha256DigestMany(const IOVec *messages, size_t count, Digest256 *digests) {
+  if (!messages || !digests) {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!messages[i].base && messages[i].length > 0) {
+      return false;
+    }
+  }
+
+  SHA256Context initial;
+  sha256Init(&initial);
+  sha256ManyFromState(initial.state, 0, messages, count, digests);
+  return true;
+}
+
+bool hmacSHA256ManyWithMidstate(const HMACSHA256Midstate &midstate,
+                                const IOVec *messages, size_t count, Digest256 *digests) {
+  if (!messages || !digests || midstate.inner.bufferLength != 0 ||
+      midstate.outer.bufferLength != 0) {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!messages[i].base && messages[i].length > 0) {
+      return false;
+    }
+  }
+
+  // İç hash'ler digests'e yazılır, dış hash'ler onların üzerine. 32 byte'lık
+  // iç özet kanala yüklenirken tail buffer'a kopyalandığından yerinde yazmak
+  // güvenlidir.
+  sha256ManyFromState(midstate.inner.state, midstate.inner.totalLength, messages, count, digests);
+  const size_t chunk = 64;
+  IOVec inner[chunk];
+
+  for (size_t start = 0; start < count; start += chunk) {
+    size_t n = std::min(chunk, count - start);
+
+    for (size_t i = 0; i < n; ++i) {
+      inner[i].base = digests[start + i].bytes;
+      inner[i].length = sizeof(digests[start + i].bytes);
+    }
+
+    sha256ManyFromState(midstate.outer.state, midstate.outer.totalLength, inner, n, digests + start);
+  }
+
+  return true;
+}
+
+bool hmacSHA256Digest(const uint8_t *key, size_t keyLen,
+                      const void *message, size_t messageLen,
+                      Digest256 &digest) {
+  if (!key || keyLen == 0 || !message || messageLen == 0) {
+    return false;
+  }
+
+  HMACSHA256Midstate midstate;
+  hmacSHA256Prepare(key, keyLen, midstate);
+  hmacSHA256WithMidstate(midstate, message, messageLen, digest);
+  Security::secureMemset(&midstate, 0, sizeof(midstate));
+  return true;
+}
+
+/**
+ * @brief HMAC-SHA256 implementasyonu
+ *
+ * RFC 2104 uyumlu HMAC-SHA256 (Hash-based Message Authentication Code) hesaplar.
+ * HMAC = SHA256(o_key_pad || SHA256(i_key_pad || message))
  *
  * @param key HMAC anahtarı
  * @param keyLen Anahtar uzunluğu (byte)
- * @param message Mesaj (doğrulanacak veri)
+ * @param message Mesaj
  * @param messageLen Mesaj uzunluğu (byte)
  * @param output HMAC çıktısı (64 karakter hex string + null terminator)
- * @return true Başarılı, false Hata (null pointer, sıfır uzunluk vb.)
+ * @return true Başarılı, false Hata (null pointer veya sıfır uzunluk)
+ */
+bool hmacSHA256(const uint8_t *key, size_t keyLen,
+                const void *message, size_t messageLen,
+                char *output) {
+  if (!output) {
+    return false;
+  }
+
+  Digest256 digest;
+
+  if (!hmacSHA256Digest(key, keyLen, message, messageLen, digest)) {
+    return false;
+  }
+
+  encodeHex(digest.bytes, sizeof(digest.bytes), output);
+  return true;
+}
+
+/**
+ * @brief PBKDF2 key derivation (Password-Based Key Derivation Function 2)
+ *
+ * RFC 2898 uyumlu PBKDF2 implementasyonu. Şifre ve salt'tan
+ * güçlü bir anahtar türetir. HMAC-SHA256 kullanır.
+ * Parolaya bağlı HMAC ara durumları bir kez hesaplanır; her iterasyon
+ * yalnızca iki SHA-256 sıkıştırması yapar ve heap ayırması yoktur.
+ *
+ * @param password Şifre (plaintext)
+ * @param passwordLen Şifre uzunluğu (byte)
+ * @param salt Salt değeri
+ * @param saltLen Salt uzunluğu (byte)
+ * @param iterations İterasyon sayısı (önerilen: 10000+)
+ * @param keyLen İstenen anahtar uzunluğu (byte)
+ * @param output Türetilen anahtar çıktısı
+ * @return true Başarılı, false Hata (null pointer, sıfır uzunluk, sıfır iterasyon vb.)
+ */
+bool pbkdf2(const char *password, size_t passwordLen,
+            const uint8_t *salt, size_t saltLen,
+            uint32_t iterations, size_t keyLen,
+            uint8_t *output) {
+  if (!password || passwordLen == 0 || !salt || saltLen == 0 ||
+      iterations == 0 || keyLen == 0 || !output) {
+    return false;
+  }
+
+  HMACSHA256Midstate midstate;
+  hmacSHA256Prepare(reinterpret_cast<const uint8_t *>(password), passwordLen, midstate);
+  size_t blocksNeeded = (keyLen + 31) / 32;
+
+  for (size_t block = 1; block <= blocksNeeded; ++block) {
+    // U1 = HMAC(password, salt || INT(block))
+    uint8_t blockIndex[4] = {
+      static_cast<uint8_t>(block >> 24), static_cast<uint8_t>(block >> 16),
+      static_cast<uint8_t>(block >> 8), static_cast<uint8_t>(block)
+    };
+    SHA256Context ctx = midstate.inner;
+    sha256Update(&ctx, salt, saltLen);
+    sha256Update(&ctx, blockIndex, sizeof(blockIndex));
+    Digest256 u;
+    sha256Final(&ctx, u);
+    ctx = midstate.outer;
+    sha256Update(&ctx, u.bytes, sizeof(u.bytes));
+    sha256Final(&ctx, u);
+    Digest256 t = u;
+
+    // U2 .. Uc
+    for (uint32_t i = 2; i <= iterations; ++i) {
+      hmacSHA256WithMidstate(midstate, u.bytes, sizeof(u.bytes), u);
+
+      for (int j = 0; j < 32; ++j) {
+        t.bytes[j] ^= u.bytes[j];
+      }
+    }
+
+    size_t offset = (block - 1) * 32;
+    size_t take = keyLen - offset < 32 ? keyLen - offset : 32;
+    std::memcpy(output + offset, t.bytes, take);
+    Security::secureMemset(&u, 0, sizeof(u));
+    Security::secureMemset(&t, 0, sizeof(t));
+  }
+
+  Security::secureMemset(&midstate, 0, sizeof(midstate));
+  return true;
+}
+
+// ============================================
+// GÜVENLİ RASTGELE SAYI HAVUZU (AES-256 CTR-DRBG)
+// ============================================
+
+/** @brief Thread başına rastgele havuz buffer boyutu (byte) */
+static const size_t RANDOM_POOL_BUFFER_SIZE = 4096;
+
+/** @brief Bu kadar byte üretildikten sonra havuz sistem entropisiyle yeniden tohumlanır */
+static const uint64_t RANDOM_POOL_RESEED_INTERVAL = 1ULL << 20;
+
+/** @brief CTR-DRBG tohum uzunluğu: anahtar (32 byte) + V (16 byte) */
+static const size_t RANDOM_POOL_SEED_SIZE = 48;
+
+/**
+ * @brief Havuz nesli
+ *
+ * fork() sonrası çocukta ve reseedRandomPool() çağrısında artırılır; nesli
+ * eski kalan her thread havuzu bir sonraki kullanımda yeniden tohumlanır.
+ */
+static std::atomic<uint64_t> g_randomPoolGeneration(0);
+
+/**
+ * @brief Thread başına CTR-DRBG durumu
+ *
+ * Küçük istekler (salt, IV, oturum anahtarı) önceden üretilmiş buffer'dan
+ * karşılanır; buffer her dolumdan sonra anahtar/V güncellenir (geri izleme
+ * direnci) ve verilen byte'lar buffer'dan silinir. Thread sonlanırken durum
+ * güvenli şekilde temizlenir.
+ */
+struct RandomPoolState {
+  AES256Context ctx;                        /**< @brief Aktif DRBG anahtarı */
+  uint8_t v[16];                            /**< @brief DRBG sayaç bloğu (V) */
+  uint8_t buffer[RANDOM_POOL_BUFFER_SIZE];  /**< @brief Önceden üretilmiş byte'lar */
+  size_t available;                         /**< @brief Buffer sonundaki kullanılmamış byte sayısı */
+  uint64_t bytesSinceReseed;                /**< @brief Son tohumlamadan beri üretilen byte */
+  uint64_t generation;                      /**< @brief Tohumlamadaki havuz nesli */
+  bool seeded;                              /**< @brief Havuz tohumlandı mı */
+
+  RandomPoolState() : available(0), bytesSinceReseed(0), generation(0), seeded(false) {
+    std::memset(&ctx, 0, sizeof(ctx));
+    std::memset(v, 0, sizeof(v));
+  }
+
+  ~RandomPoolState() {
+    clearAES256Context(&ctx);
+    Security::secureMemset(v, 0, sizeof(v));
+    Security::secureMemset(buffer, 0, sizeof(buffer));
+  }
+};
+
+/**
+ * @brief İşletim sisteminden entropi oku
+ *
+ * - Windows: CryptGenRandom (Windows CryptoAPI)
+ * - Linux: getrandom() (destekleniyorsa), aksi halde /dev/urandom
+ *
+ * Kısa okumalar ve EINTR durumunda okuma tamamlanana kadar tekrarlanır.
+ *
+ * @param output Çıktı buffer'ı
+ * @param length İstenen uzunluk (byte)
+ * @return true Başarılı, false Hata
+ */
+static bool readSystemEntropy(uint8_t *output, size_t length) {
+#ifdef _WIN32
+  HCRYPTPROV hProv;
+
+  if (!CryptAcquireContext(&hProv, nullptr, nullptr, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT)) {
+    return false;
+  }
+
+  if (!CryptGenRandom(hProv, static_cast<DWORD>(length), output)) {
+    CryptReleaseContext(hProv, 0);
+    return false;
+  }
+
+  CryptReleaseContext(hProv, 0);
+  return true;
+#else
+#ifdef SYS_getrandom
+
+  while (length > 0) {
+    long bytesRead = syscall(SYS_getrandom, output, length, 0);
+
+    if (bytesRead < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      break; // ENOSYS vb.: /dev/urandom'a düş
+    }
+
+    output += bytesRead;
+    length -= static_cast<size_t>(bytesRead);
+  }
+
+  if (length == 0) {
+    return true;
+  }
+
+#endif
+  int fd = open("/dev/urandom", O_RDONLY);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  while (length > 0) {
+    ssize_t bytesRead = read(fd, output, length);
+
+    if (bytesRead < 0 && errno == EINTR) {
+      continue;
+    }
+
+    if (bytesRead <= 0) {
+      close(fd);
+      return false;
+    }
+
+    output += bytesRead;
+    length -= static_cast<size_t>(bytesRead);
+  }
+
+  close(fd);
+  return true;
+#endif
+}
+
+#ifndef _WIN32
+/**
+ * @brief fork() sonrası çocuk süreçte çağrılır
+ *
+ * Çocuk, ebeveynin thread havuzlarının kopyasını devralır; nesil artırılarak
+ * aynı byte'ların iki süreçte de üretilmesi engellenir.
+ */
+static void randomPoolAfterFork() {
+  g_randomPoolGeneration.fetch_add(1);
+}
+
+/** @brief fork işleyicisinin tek seferlik kaydı için bayrak */
+static std::once_flag g_randomPoolForkHandlerOnce;
+
+/**
+ * @brief fork işleyicisini kaydet (std::call_once ile çağrılır)
+ */
+static void registerRandomPoolForkHandler() {
+  pthread_atfork(nullptr, nullptr, randomPoolAfterFork);
+}
+#endif
+
+/**
+ * @brief CTR-DRBG güncelleme (SP 800-90A, türetme fonksiyonsuz)
+ *
+ * Mevcut anahtarla 48 byte anahtar akışı üretir, isteğe bağlı tohumla XOR'lar
+ * ve sonucu yeni anahtar + V olarak yükler.
+ *
+ * @param state DRBG durumu
+ * @param providedData Tohum (RANDOM_POOL_SEED_SIZE byte) veya nullptr
+ */
+static void randomPoolUpdate(RandomPoolState &state, const uint8_t *providedData) {
+  uint8_t temp[RANDOM_POOL_SEED_SIZE];
+  std::memset(temp, 0, sizeof(temp));
+  addCounter128(state.v, 1);
+  aesCTRXor(&state.ctx, state.v, false, temp, temp, sizeof(temp));
+
+  if (providedData) {
+    for (size_t i = 0; i < RANDOM_POOL_SEED_SIZE; ++i) {
+      temp[i] ^= providedData[i];
+    }
+  }
+
+  initAES256Context(&state.ctx, temp);
+  std::memcpy(state.v, temp + 32, 16);
+  Security::secureMemset(temp, 0, sizeof(temp));
+}
+
+/**
+ * @brief Havuzu sistem entropisiyle (yeniden) tohumla
+ *
+ * Buffer'daki kullanılmamış byte'lar atılır (fork sonrası ebeveynle
+ * paylaşılıyor olabilirler).
+ *
+ * @param state DRBG durumu
+ * @param generation Tohumlama anındaki havuz nesli
+ * @return true Başarılı, false Entropi okunamadı
+ */
+static bool randomPoolReseed(RandomPoolState &state, uint64_t generation) {
+  uint8_t seed[RANDOM_POOL_SEED_SIZE];
+
+  if (!readSystemEntropy(seed, sizeof(seed))) {
+    return false;
+  }
+
+  if (!state.seeded) {
+    uint8_t zeroKey[32] = {0};
+    initAES256Context(&state.ctx, zeroKey);
+    std::memset(state.v, 0, sizeof(state.v));
+  }
+
+  randomPoolUpdate(state, seed);
+  Security::secureMemset(seed, 0, sizeof(seed));
+  Security::secureMemset(state.buffer, 0, sizeof(state.buffer));
+  state.available = 0;
+  state.bytesSinceReseed = 0;
+  state.generation = generation;
+  state.seeded = true;
+  return true;
+}
+
+/**
+ * @brief DRBG anahtar akışını doğrudan hedefe yaz ve durumu ilerlet
+ *
+ * @param state DRBG durumu
+ * @param output Çıktı
+ * @param length Uzunluk (byte)
+ */
+static void randomPoolGenerate(RandomPoolState &state, uint8_t *output, size_t length) {
+  std::memset(output, 0, length);
+  addCounter128(state.v, 1);
+  aesCTRXor(&state.ctx, state.v, false, output, output, length);
+  randomPoolUpdate(state, nullptr);
+  state.bytesSinceReseed += length;
+}
+
+void reseedRandomPool() {
+  g_randomPoolGeneration.fetch_add(1);
+}
+
+/**
+ * @brief Güvenli rastgele byte üretimi
+ *
+ * Thread başına, işletim sistemi entropisiyle (getrandom / /dev/urandom /
+ * CryptGenRandom) tohumlanan AES-256 CTR-DRBG kullanır. Küçük istekler
+ * buffer'dan sistem çağrısı yapılmadan karşılanır. Havuz
+ * RANDOM_POOL_RESEED_INTERVAL byte'ta bir, fork() sonrasında ve
+ * reseedRandomPool() çağrısından sonra yeniden tohumlanır.
+ *
+ * @param output Rastgele byte çıktısı
+ * @param length İstenen uzunluk (byte)
+ * @return true Başarılı, false Hata (null pointer, sıfır uzunluk, entropi okunamadı)
+ */
+bool generateRandomBytes(uint8_t *output, size_t length) {
+  if (!output || length == 0) {
+    return false;
+  }
+
+#ifndef _WIN32
+  std::call_once(g_randomPoolForkHandlerOnce, registerRandomPoolForkHandler);
+#endif
+  static thread_local RandomPoolState state;
+
+  while (length > 0) {
+    uint64_t generation = g_randomPoolGeneration.load();
+
+    if (!state.seeded || state.generation != generation ||
+        state.bytesSinceReseed >= RANDOM_POOL_RESEED_INTERVAL) {
+      if (!randomPoolReseed(state, generation)) {
+        return false;
+      }
+    }
+
+    if (state.available == 0) {
+      // Büyük istekler buffer'a kopyalanmadan doğrudan üretilir
+      if (length >= RANDOM_POOL_BUFFER_SIZE) {
+        randomPoolGenerate(state, output, RANDOM_POOL_BUFFER_SIZE);
+        output += RANDOM_POOL_BUFFER_SIZE;
+        length -= RANDOM_POOL_BUFFER_SIZE;
+        continue;
+      }
+
+      randomPoolGenerate(state, state.buffer, RANDOM_POOL_BUFFER_SIZE);
+      state.available = RANDOM_POOL_BUFFER_SIZE;
+    }
+
+    size_t n = length < state.available ? length : state.available;
+    uint8_t *source = state.buffer + (RANDOM_POOL_BUFFER_SIZE - state.available);
+    std::memcpy(output, source, n);
+    Security::secureMemset(source, 0, n);
+    state.available -= n;
+    output += n;
+    length -= n;
+  }
+
+  return true;
+}
+
+/**
+ * @brief IV (Initialization Vector) oluştur
+ *
+ * AES şifreleme için 16 byte (AES block size) güvenli rastgele IV oluşturur.
+ *
+ * @param iv IV çıktısı (16 byte)
+ * @return true Başarılı, false Hata (null pointer veya rastgele sayı üretilemedi)
  */
-bool hmacSHA256(const uint8_t *key, size_t keyLen,
-                const void *message, size_t messageLen,
-                char *output) {
-  if (!key || keyLen == 0 || !message || messageLen == 0 || !output) {
+bool generateIV(uint8_t *iv) {
+  if (!iv) {
     return false;
   }
 
-  // HMAC key'i hazırla (64 byte block size)
-  uint8_t preparedKey[64];
-  std::memset(preparedKey, 0, 64);
+  return generateRandomBytes(iv, 16);
+}
 
-  if (keyLen > 64) {
-    // Key'i hash'le
-    char keyHash[65];
+/**
+ * @brief Constant-time karşılaştırma
+ *
+ * Timing attack'lara karşı koruma sağlayan sabit zamanlı string karşılaştırma.
+ * Karşılaştırma Security::constantTimeEquals() ile SIMD kelimeler üzerinde
+ * XOR/OR birleştirilerek yapılır; süre string içeriğinden bağımsızdır.
+ *
+ * @param a İlk string
+ * @param b İkinci string
+ * @param length Karşılaştırılacak uzunluk (byte)
+ * @return true Eşit, false Farklı veya hata (null pointer, sıfır uzunluk)
+ */
+bool constantTimeCompare(const char *a, const char *b, size_t length) {
+  return Security::constantTimeEquals(a, b, length);
+}
 
-    if (!sha256Hash(key, keyLen, keyHash)) {
-      return false;
-    }
+// ============================================
+// DOSYA ŞİFRELEME (PARÇALI AKIŞ)
+// ============================================
 
-    // Hex string'den byte'a çevir
-    for (int i = 0; i < 32; ++i) {
-      char hexByte[3] = {keyHash[i * 2], keyHash[i * 2 + 1], '\0'};
-      preparedKey[i] = static_cast<uint8_t>(std::stoul(hexByte, nullptr, 16));
-    }
-  } else {
-    std::memcpy(preparedKey, key, keyLen);
+/** @brief Dosya şifrelemede bir seferde işlenen veri miktarı (16'nın katı) */
+static const size_t FILE_STREAM_CHUNK_SIZE = 1u << 20;
+
+/**
+ * @brief Dosya akışı için sabit boyutlu çalışma buffer'ı
+ *
+ * Tek bir parça + bir blok padding alanı tutar; dosya boyutundan bağımsız
+ * olarak bellek kullanımı sabittir. Yıkıcıda içerik güvenli şekilde silinir.
+ */
+struct FileStreamBuffer {
+  uint8_t *data;  /**< @brief Buffer */
+  size_t size;    /**< @brief Buffer boyutu */
+
+  FileStreamBuffer() : data(new uint8_t[FILE_STREAM_CHUNK_SIZE + 16]), size(FILE_STREAM_CHUNK_SIZE + 16) {}
+
+  ~FileStreamBuffer() {
+    Security::secureMemset(data, 0, size);
+    delete[] data;
   }
 
-  // o_key_pad = key XOR 0x5c
-  // i_key_pad = key XOR 0x36
-  uint8_t o_key_pad[64], i_key_pad[64];
+ private:
+  FileStreamBuffer(const FileStreamBuffer &);
+  FileStreamBuffer &operator=(const FileStreamBuffer &);
+};
+
+/**
+ * @brief Akıştan en fazla length byte oku
+ *
+ * @param in Girdi akışı
+ * @param buffer Hedef buffer
+ * @param length Okunacak maksimum byte sayısı
+ * @return size_t Okunan byte sayısı (dosya sonunda length'ten az olabilir)
+ */
+static size_t readChunk(std::ifstream &in, uint8_t *buffer, size_t length) {
+  in.read(reinterpret_cast<char *>(buffer), static_cast<std::streamsize>(length));
+  return static_cast<size_t>(in.gcount());
+}
 
-  for (int i = 0; i < 64; ++i) {
-    o_key_pad[i] = preparedKey[i] ^ 0x5c;
-    i_key_pad[i] = preparedKey[i] ^ 0x36;
+/**
+ * @brief Girdi dosyasının kalan boyutunu hesapla (okuma konumu korunur)
+ *
+ * @param in Girdi akışı
+ * @return uint64_t Okuma konumundan dosya sonuna kadar byte sayısı
+ */
+static uint64_t remainingStreamSize(std::ifstream &in) {
+  std::streampos current = in.tellg();
+  in.seekg(0, std::ios::end);
+  std::streampos end = in.tellg();
+  in.seekg(current, std::ios::beg);
+  return static_cast<uint64_t>(end - current);
+}
+
+/**
+ * @brief Yarım kalmış çıktı dosyasını kapat ve sil
+ *
+ * Hata durumunda kısmen yazılmış (veya doğrulanmamış) veri diskte bırakılmaz.
+ *
+ * @param out Çıktı akışı
+ * @param outputFile Çıktı dosyası yolu
+ * @return false Her zaman (çağıran doğrudan döndürebilsin diye)
+ */
+static bool abortOutputFile(std::ofstream &out, const char *outputFile) {
+  out.close();
+  std::remove(outputFile);
+  return false;
+}
+
+/**
+ * @brief Dosya şifreleme (AES-256-CBC)
+ *
+ * Dosyayı AES-256-CBC ile şifreler ve çıktı dosyasına yazar.
+ * Çıktı formatı: [IV (16 byte)][Ciphertext (padded)]
+ *
+ * Dosya FILE_STREAM_CHUNK_SIZE'lık parçalar halinde tek bir buffer üzerinden
+ * yerinde şifrelenir; CBC zinciri (IV) parçalar arasında taşınır. Bellek
+ * kullanımı dosya boyutundan bağımsızdır.
+ *
+ * @param inputFile Girdi dosyası yolu
+ * @param outputFile Çıktı dosyası yolu
+ * @param key Şifreleme anahtarı (32 byte - AES-256)
+ * @param iv IV (nullptr ise otomatik oluşturulur)
+ * @return true Başarılı, false Hata (dosya açılamadı, şifreleme başarısız vb.)
+ */
+bool encryptFile(const char *inputFile, const char *outputFile,
+                 const uint8_t *key, const uint8_t *iv) {
+  if (!inputFile || !outputFile || !key) {
+    return false;
   }
 
-  // Inner hash: SHA256(i_key_pad || message)
-  uint8_t innerInput[64 + 1024]; // 64 + message (max 1024 for simplicity)
-  std::memcpy(innerInput, i_key_pad, 64);
-  std::memcpy(innerInput + 64, message, messageLen);
-  char innerHash[65];
+  std::ifstream inFile(inputFile, std::ios::binary);
 
-  if (!sha256Hash(innerInput, 64 + messageLen, innerHash)) {
+  if (!inFile) {
     return false;
   }
 
-  // Outer hash: SHA256(o_key_pad || inner_hash)
-  uint8_t outerInput[64 + 32];
-  std::memcpy(outerInput, o_key_pad, 64);
+  // IV oluştur veya kullan
+  uint8_t chain[16];
 
-  // Hex string'den byte'a çevir
-  for (int i = 0; i < 32; ++i) {
-    char hexByte[3] = {innerHash[i * 2], innerHash[i * 2 + 1], '\0'};
-    outerInput[64 + i] = static_cast<uint8_t>(std::stoul(hexByte, nullptr, 16));
+  if (iv) {
+    std::memcpy(chain, iv, 16);
+  } else if (!generateIV(chain)) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  std::ofstream outFile(outputFile, std::ios::binary);
+
+  if (!outFile) {
+    return false;
+  }
+
+  outFile.write(reinterpret_cast<const char *>(chain), 16);
+  FileStreamBuffer buffer;
+
+  for (;;) {
+    size_t readLen = readChunk(inFile, buffer.data, FILE_STREAM_CHUNK_SIZE);
+
+    if (readLen == FILE_STREAM_CHUNK_SIZE) {
+      aes256EncryptCBC(ctx, chain, buffer.data, buffer.data, readLen / 16);
+      outFile.write(reinterpret_cast<const char *>(buffer.data), readLen);
+
+      if (!outFile) {
+        return abortOutputFile(outFile, outputFile);
+      }
+
+      continue;
+    }
+
+    // Son parça: PKCS7 padding (her zaman en az 1 byte)
+    if (inFile.bad()) {
+      return abortOutputFile(outFile, outputFile);
+    }
+
+    size_t paddedLen = (readLen / 16 + 1) * 16;
+    std::memset(buffer.data + readLen, static_cast<int>(paddedLen - readLen), paddedLen - readLen);
+    aes256EncryptCBC(ctx, chain, buffer.data, buffer.data, paddedLen / 16);
+    outFile.write(reinterpret_cast<const char *>(buffer.data), paddedLen);
+    break;
   }
 
-  if (!sha256Hash(outerInput, 64 + 32, output)) {
+  outFile.close();
+
+  if (!outFile) {
+    std::remove(outputFile);
     return false;
   }
 
@@ -877,187 +3969,270 @@ bool hmacSHA256(const uint8_t *key, size_t keyLen,
 }
 
 /**
- * @brief PBKDF2 key derivation (Password-Based Key Derivation Function 2)
+ * @brief Dosya şifre çözme (AES-256-CBC)
  *
- * RFC 2898 uyumlu PBKDF2 implementasyonu. Şifre ve salt'tan
- * güçlü bir anahtar türetir. HMAC-SHA256 kullanır.
+ * AES-256-CBC ile şifrelenmiş dosyayı çözer ve çıktı dosyasına yazar.
+ * Girdi formatı: [IV (16 byte)][Ciphertext (padded)]
  *
- * @param password Şifre (plaintext)
- * @param passwordLen Şifre uzunluğu (byte)
- * @param salt Salt değeri
- * @param saltLen Salt uzunluğu (byte)
- * @param iterations İterasyon sayısı (önerilen: 10000+)
- * @param keyLen İstenen anahtar uzunluğu (byte)
- * @param output Türetilen anahtar çıktısı
- * @return true Başarılı, false Hata (null pointer, sıfır uzunluk, sıfır iterasyon vb.)
+ * Dosya parçalar halinde çözülür; padding yalnızca son parçada doğrulanır.
+ * Padding geçersizse kısmen yazılmış çıktı dosyası silinir.
+ *
+ * @param inputFile Girdi dosyası yolu (şifrelenmiş)
+ * @param outputFile Çıktı dosyası yolu (şifre çözülmüş)
+ * @param key Şifreleme anahtarı (32 byte - AES-256)
+ * @param iv IV (nullptr ise dosyadan okunur, aksi halde dosyadaki IV atlanır)
+ * @return true Başarılı, false Hata (dosya açılamadı, şifre çözme başarısız vb.)
  */
-bool pbkdf2(const char *password, size_t passwordLen,
-            const uint8_t *salt, size_t saltLen,
-            uint32_t iterations, size_t keyLen,
-            uint8_t *output) {
-  if (!password || passwordLen == 0 || !salt || saltLen == 0 ||
-      iterations == 0 || keyLen == 0 || !output) {
+bool decryptFile(const char *inputFile, const char *outputFile,
+                 const uint8_t *key, const uint8_t *iv) {
+  if (!inputFile || !outputFile || !key) {
     return false;
   }
 
-  size_t blocksNeeded = (keyLen + 31) / 32;
-  uint8_t *result = new uint8_t[blocksNeeded * 32];
+  std::ifstream inFile(inputFile, std::ios::binary);
 
-  for (size_t block = 1; block <= blocksNeeded; ++block) {
-    // U1 = HMAC(password, salt || i)
-    uint8_t uInput[1024];
-    size_t uInputLen = saltLen + 4;
-    std::memcpy(uInput, salt, saltLen);
-    uInput[saltLen] = (block >> 24) & 0xff;
-    uInput[saltLen + 1] = (block >> 16) & 0xff;
-    uInput[saltLen + 2] = (block >> 8) & 0xff;
-    uInput[saltLen + 3] = block & 0xff;
-    char uHash[65];
-
-    if (!hmacSHA256(reinterpret_cast<const uint8_t *>(password), passwordLen,
-                    uInput, uInputLen, uHash)) {
-      delete[] result;
-      return false;
-    }
+  if (!inFile) {
+    return false;
+  }
+
+  // IV'yi oku veya kullan
+  uint8_t chain[16];
+
+  if (readChunk(inFile, chain, 16) != 16) {
+    return false;
+  }
+
+  if (iv) {
+    std::memcpy(chain, iv, 16);
+  }
+
+  uint64_t remaining = remainingStreamSize(inFile);
+
+  if (remaining == 0 || remaining % 16 != 0) {
+    return false;
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
+    return false;
+  }
+
+  std::ofstream outFile(outputFile, std::ios::binary);
+
+  if (!outFile) {
+    return false;
+  }
+
+  FileStreamBuffer buffer;
 
-    // Convert hex string to bytes
-    uint8_t u[32];
+  while (remaining > 0) {
+    size_t chunkLen = remaining < FILE_STREAM_CHUNK_SIZE ? static_cast<size_t>(remaining) : FILE_STREAM_CHUNK_SIZE;
 
-    for (int i = 0; i < 32; ++i) {
-      char hexByte[3] = {uHash[i * 2], uHash[i * 2 + 1], '\0'};
-      u[i] = static_cast<uint8_t>(std::stoul(hexByte, nullptr, 16));
+    if (readChunk(inFile, buffer.data, chunkLen) != chunkLen) {
+      return abortOutputFile(outFile, outputFile);
     }
 
-    std::memcpy(result + (block - 1) * 32, u, 32);
-    // U2 to U_c
-    uint8_t prevU[32];
-    std::memcpy(prevU, u, 32);
+    aes256DecryptCBC(ctx, chain, buffer.data, buffer.data, chunkLen / 16);
+    remaining -= chunkLen;
+    size_t writeLen = chunkLen;
 
-    for (uint32_t i = 2; i <= iterations; ++i) {
-      // HMAC(password, U_{i-1})
-      char tempHash[65];
+    if (remaining == 0) {
+      size_t paddingLen = 0;
 
-      if (!hmacSHA256(reinterpret_cast<const uint8_t *>(password), passwordLen,
-                      prevU, 32, tempHash)) {
-        delete[] result;
-        return false;
+      if (!pkcs7PaddingLength(buffer.data + chunkLen - 16, 16, paddingLen)) {
+        return abortOutputFile(outFile, outputFile);
       }
 
-      for (int j = 0; j < 32; ++j) {
-        char hexByte[3] = {tempHash[j * 2], tempHash[j * 2 + 1], '\0'};
-        prevU[j] = static_cast<uint8_t>(std::stoul(hexByte, nullptr, 16));
-        u[j] ^= prevU[j];
-      }
+      writeLen -= paddingLen;
     }
 
-    std::memcpy(result + (block - 1) * 32, u, 32);
+    outFile.write(reinterpret_cast<const char *>(buffer.data), writeLen);
+
+    if (!outFile) {
+      return abortOutputFile(outFile, outputFile);
+    }
+  }
+
+  outFile.close();
+
+  if (!outFile) {
+    std::remove(outputFile);
+    return false;
   }
 
-  std::memcpy(output, result, keyLen);
-  delete[] result;
   return true;
 }
 
 /**
- * @brief Güvenli rastgele byte üretimi
+ * @brief Dosya şifreleme (AES-256-CTR)
  *
- * Platform-specific güvenli rastgele sayı üreticisi kullanır:
- * - Windows: CryptGenRandom (Windows CryptoAPI)
- * - Linux/Unix: /dev/urandom
+ * Dosyayı AES-256-CTR ile parçalar halinde şifreler; sayaç parçalar arasında
+ * taşınır. Padding yoktur, şifreli veri düz metinle aynı uzunluktadır.
+ * Çıktı formatı: [Başlangıç sayacı (16 byte)][Ciphertext]
  *
- * @param output Rastgele byte çıktısı
- * @param length İstenen uzunluk (byte)
- * @return true Başarılı, false Hata (null pointer, sıfır uzunluk, platform hatası)
+ * @param inputFile Girdi dosyası yolu
+ * @param outputFile Çıktı dosyası yolu
+ * @param key Şifreleme anahtarı (32 byte - AES-256)
+ * @param iv Başlangıç sayacı (nullptr ise otomatik oluşturulur)
+ * @return true Başarılı, false Hata
  */
-bool generateRandomBytes(uint8_t *output, size_t length) {
-  if (!output || length == 0) {
+bool encryptFileCTR(const char *inputFile, const char *outputFile,
+                    const uint8_t *key, const uint8_t *iv) {
+  if (!inputFile || !outputFile || !key) {
     return false;
   }
 
-#ifdef _WIN32
-  HCRYPTPROV hProv;
+  std::ifstream inFile(inputFile, std::ios::binary);
 
-  if (!CryptAcquireContext(&hProv, nullptr, nullptr, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT)) {
+  if (!inFile) {
     return false;
   }
 
-  if (!CryptGenRandom(hProv, static_cast<DWORD>(length), output)) {
-    CryptReleaseContext(hProv, 0);
+  uint8_t counter[16];
+
+  if (iv) {
+    std::memcpy(counter, iv, 16);
+  } else if (!generateIV(counter)) {
     return false;
   }
 
-  CryptReleaseContext(hProv, 0);
-  return true;
-#else
-  int fd = open("/dev/urandom", O_RDONLY);
+  const AES256Context *ctx = getCachedAES256Context(key);
 
-  if (fd < 0) {
+  if (!ctx) {
     return false;
   }
 
-  ssize_t bytesRead = read(fd, output, length);
-  close(fd);
-  return (bytesRead == static_cast<ssize_t>(length));
-#endif
+  std::ofstream outFile(outputFile, std::ios::binary);
+
+  if (!outFile) {
+    return false;
+  }
+
+  outFile.write(reinterpret_cast<const char *>(counter), 16);
+  FileStreamBuffer buffer;
+  size_t readLen = 0;
+
+  // Tam parçalar 16'nın katı olduğundan sayaç blok sınırında devam eder
+  while ((readLen = readChunk(inFile, buffer.data, FILE_STREAM_CHUNK_SIZE)) > 0) {
+    aes256CryptCTR(ctx, counter, buffer.data, buffer.data, readLen);
+    outFile.write(reinterpret_cast<const char *>(buffer.data), readLen);
+
+    if (!outFile) {
+      return abortOutputFile(outFile, outputFile);
+    }
+  }
+
+  if (inFile.bad()) {
+    return abortOutputFile(outFile, outputFile);
+  }
+
+  outFile.close();
+
+  if (!outFile) {
+    std::remove(outputFile);
+    return false;
+  }
+
+  return true;
 }
 
 /**
- * @brief IV (Initialization Vector) oluştur
+ * @brief Dosya şifre çözme (AES-256-CTR)
  *
- * AES şifreleme için 16 byte (AES block size) güvenli rastgele IV oluşturur.
+ * Girdi formatı: [Başlangıç sayacı (16 byte)][Ciphertext]
  *
- * @param iv IV çıktısı (16 byte)
- * @return true Başarılı, false Hata (null pointer veya rastgele sayı üretilemedi)
+ * @param inputFile Girdi dosyası yolu (şifrelenmiş)
+ * @param outputFile Çıktı dosyası yolu (şifre çözülmüş)
+ * @param key Şifreleme anahtarı (32 byte - AES-256)
+ * @param iv Başlangıç sayacı (nullptr ise dosyadan okunur)
+ * @return true Başarılı, false Hata
  */
-bool generateIV(uint8_t *iv) {
-  if (!iv) {
+bool decryptFileCTR(const char *inputFile, const char *outputFile,
+                    const uint8_t *key, const uint8_t *iv) {
+  if (!inputFile || !outputFile || !key) {
+    return false;
+  }
+
+  std::ifstream inFile(inputFile, std::ios::binary);
+
+  if (!inFile) {
+    return false;
+  }
+
+  uint8_t counter[16];
+
+  if (readChunk(inFile, counter, 16) != 16) {
+    return false;
+  }
+
+  if (iv) {
+    std::memcpy(counter, iv, 16);
+  }
+
+  const AES256Context *ctx = getCachedAES256Context(key);
+
+  if (!ctx) {
     return false;
   }
 
-  return generateRandomBytes(iv, 16);
-}
+  std::ofstream outFile(outputFile, std::ios::binary);
 
-/**
- * @brief Constant-time karşılaştırma
- *
- * Timing attack'lara karşı koruma sağlayan sabit zamanlı string karşılaştırma.
- * Her karakteri karşılaştırır ve sonucu XOR ile birleştirir.
- * Bu sayede karşılaştırma süresi string içeriğinden bağımsızdır.
- *
- * @param a İlk string
- * @param b İkinci string
- * @param length Karşılaştırılacak uzunluk (byte)
- * @return true Eşit, false Farklı veya hata (null pointer, sıfır uzunluk)
- */
-bool constantTimeCompare(const char *a, const char *b, size_t length) {
-  if (!a || !b || length == 0) {
+  if (!outFile) {
     return false;
   }
 
-  uint8_t result = 0;
+  FileStreamBuffer buffer;
+  size_t readLen = 0;
 
-  for (size_t i = 0; i < length; ++i) {
-    result |= (a[i] ^ b[i]);
+  while ((readLen = readChunk(inFile, buffer.data, FILE_STREAM_CHUNK_SIZE)) > 0) {
+    aes256CryptCTR(ctx, counter, buffer.data, buffer.data, readLen);
+    outFile.write(reinterpret_cast<const char *>(buffer.data), readLen);
+
+    if (!outFile) {
+      return abortOutputFile(outFile, outputFile);
+    }
+  }
+
+  if (inFile.bad()) {
+    return abortOutputFile(outFile, outputFile);
+  }
+
+  outFile.close();
+
+  if (!outFile) {
+    std::remove(outputFile);
+    return false;
   }
 
-  return (result == 0);
+  return true;
 }
 
 /**
- * @brief Dosya şifreleme (AES-256-CBC)
+ * @brief Whitebox blok şifreleme fonksiyonu imzası
  *
- * Dosyayı AES-256-CBC ile şifreler ve çıktı dosyasına yazar.
- * Çıktı formatı: [IV (16 byte)][Ciphertext (padded)]
+ * encryptWhiteboxDES/decryptWhiteboxDES/encryptWhiteboxAES/decryptWhiteboxAES
+ * ile aynı imza (blok boyutunun katı uzunlukta veri, padding yok).
+ */
+typedef bool (*WhiteboxCryptFunction)(const void *input, size_t inputLen,
+                                      void *output, size_t &outputLen);
+
+/**
+ * @brief Whitebox dosya şifreleme (parçalı akış, ortak çekirdek)
+ *
+ * Çıktı formatı: [Original Size (8 byte)][Ciphertext (blok boyutuna padded)]
+ * Son parça PKCS7 ile blok boyutuna tamamlanır (dosya boyutu blok boyutunun
+ * katıysa padding eklenmez; gerçek boyut başlıktan alınır).
  *
  * @param inputFile Girdi dosyası yolu
  * @param outputFile Çıktı dosyası yolu
- * @param key Şifreleme anahtarı (32 byte - AES-256)
- * @param iv IV (nullptr ise otomatik oluşturulur)
- * @return true Başarılı, false Hata (dosya açılamadı, şifreleme başarısız vb.)
+ * @param blockSize Blok boyutu (DES: 8, AES: 16)
+ * @param crypt Whitebox şifreleme fonksiyonu
+ * @return true Başarılı, false Hata
  */
-bool encryptFile(const char *inputFile, const char *outputFile,
-                 const uint8_t *key, const uint8_t *iv) {
-  if (!inputFile || !outputFile || !key) {
+static bool encryptFileWhitebox(const char *inputFile, const char *outputFile,
+                                size_t blockSize, WhiteboxCryptFunction crypt) {
+  if (!inputFile || !outputFile) {
     return false;
   }
 
@@ -1067,68 +4242,73 @@ bool encryptFile(const char *inputFile, const char *outputFile,
     return false;
   }
 
-  // Dosya boyutunu al
-  inFile.seekg(0, std::ios::end);
-  size_t fileSize = static_cast<size_t>(inFile.tellg());
-  inFile.seekg(0, std::ios::beg);
-  // Dosyayı oku
-  uint8_t *plaintext = new uint8_t[fileSize];
-  inFile.read(reinterpret_cast<char *>(plaintext), fileSize);
-  inFile.close();
-  // IV oluştur veya kullan
-  uint8_t fileIV[16];
+  uint64_t origSize = remainingStreamSize(inFile);
 
-  if (iv) {
-    std::memcpy(fileIV, iv, 16);
-  } else {
-    if (!generateIV(fileIV)) {
-      delete[] plaintext;
-      return false;
-    }
+  if (origSize == 0) {
+    return false;
   }
 
-  // Şifrele
-  size_t ciphertextLen = ((fileSize + 15) / 16) * 16;
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
+  std::ofstream outFile(outputFile, std::ios::binary);
 
-  if (!encryptAES256(plaintext, fileSize, key, fileIV, ciphertext, ciphertextLen)) {
-    delete[] plaintext;
-    delete[] ciphertext;
+  if (!outFile) {
     return false;
   }
 
-  // Çıktı dosyasına yaz (IV + ciphertext)
-  std::ofstream outFile(outputFile, std::ios::binary);
+  // Write original file size (8 bytes)
+  outFile.write(reinterpret_cast<const char *>(&origSize), 8);
+  FileStreamBuffer buffer;
+  uint64_t remaining = origSize;
+
+  while (remaining > 0) {
+    size_t chunkLen = remaining < FILE_STREAM_CHUNK_SIZE ? static_cast<size_t>(remaining) : FILE_STREAM_CHUNK_SIZE;
+
+    if (readChunk(inFile, buffer.data, chunkLen) != chunkLen) {
+      return abortOutputFile(outFile, outputFile);
+    }
+
+    remaining -= chunkLen;
+    // Apply PKCS7 padding (yalnızca son parça blok boyutunun katı olmayabilir)
+    size_t paddedLen = ((chunkLen + blockSize - 1) / blockSize) * blockSize;
+    std::memset(buffer.data + chunkLen, static_cast<int>(paddedLen - chunkLen), paddedLen - chunkLen);
+    size_t outLen = paddedLen;
+
+    if (!crypt(buffer.data, paddedLen, buffer.data, outLen)) {
+      return abortOutputFile(outFile, outputFile);
+    }
+
+    outFile.write(reinterpret_cast<const char *>(buffer.data), outLen);
+
+    if (!outFile) {
+      return abortOutputFile(outFile, outputFile);
+    }
+  }
+
+  outFile.close();
 
   if (!outFile) {
-    delete[] plaintext;
-    delete[] ciphertext;
+    std::remove(outputFile);
     return false;
   }
 
-  outFile.write(reinterpret_cast<const char *>(fileIV), 16);
-  outFile.write(reinterpret_cast<const char *>(ciphertext), ciphertextLen);
-  outFile.close();
-  delete[] plaintext;
-  delete[] ciphertext;
   return true;
 }
 
 /**
- * @brief Dosya şifre çözme (AES-256-CBC)
+ * @brief Whitebox dosya şifre çözme (parçalı akış, ortak çekirdek)
  *
- * AES-256-CBC ile şifrelenmiş dosyayı çözer ve çıktı dosyasına yazar.
- * Girdi formatı: [IV (16 byte)][Ciphertext (padded)]
+ * Girdi formatı: [Original Size (8 byte)][Ciphertext (blok boyutuna padded)]
+ * Şifreli veri uzunluğu başlıktaki boyutla tutarlı olmalı; padding varsa son
+ * parçada doğrulanır.
  *
  * @param inputFile Girdi dosyası yolu (şifrelenmiş)
  * @param outputFile Çıktı dosyası yolu (şifre çözülmüş)
- * @param key Şifreleme anahtarı (32 byte - AES-256)
- * @param iv IV (nullptr ise dosyadan okunur)
- * @return true Başarılı, false Hata (dosya açılamadı, şifre çözme başarısız vb.)
+ * @param blockSize Blok boyutu (DES: 8, AES: 16)
+ * @param crypt Whitebox şifre çözme fonksiyonu
+ * @return true Başarılı, false Hata
  */
-bool decryptFile(const char *inputFile, const char *outputFile,
-                 const uint8_t *key, const uint8_t *iv) {
-  if (!inputFile || !outputFile || !key) {
+static bool decryptFileWhitebox(const char *inputFile, const char *outputFile,
+                                size_t blockSize, WhiteboxCryptFunction crypt) {
+  if (!inputFile || !outputFile) {
     return false;
   }
 
@@ -1138,53 +4318,76 @@ bool decryptFile(const char *inputFile, const char *outputFile,
     return false;
   }
 
-  // Dosya boyutunu al
-  inFile.seekg(0, std::ios::end);
-  size_t fileSize = static_cast<size_t>(inFile.tellg());
-  inFile.seekg(0, std::ios::beg);
+  // Read original file size
+  uint64_t origSize = 0;
 
-  if (fileSize < 16) {
-    inFile.close();
+  if (readChunk(inFile, reinterpret_cast<uint8_t *>(&origSize), 8) != 8) {
     return false;
   }
 
-  // IV'yi oku veya kullan
-  uint8_t fileIV[16];
+  uint64_t remaining = remainingStreamSize(inFile);
 
-  if (iv) {
-    std::memcpy(fileIV, iv, 16);
-  } else {
-    inFile.read(reinterpret_cast<char *>(fileIV), 16);
+  if (remaining == 0 || remaining % blockSize != 0 ||
+      remaining != ((origSize + blockSize - 1) / blockSize) * blockSize) {
+    return false;
   }
 
-  // Ciphertext'i oku
-  size_t ciphertextLen = fileSize - 16;
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
-  inFile.read(reinterpret_cast<char *>(ciphertext), ciphertextLen);
-  inFile.close();
-  // Şifre çöz
-  size_t plaintextLen = ciphertextLen;
-  uint8_t *plaintext = new uint8_t[plaintextLen];
+  std::ofstream outFile(outputFile, std::ios::binary);
 
-  if (!decryptAES256(ciphertext, ciphertextLen, key, fileIV, plaintext, plaintextLen)) {
-    delete[] ciphertext;
-    delete[] plaintext;
+  if (!outFile) {
     return false;
   }
 
-  // Çıktı dosyasına yaz
-  std::ofstream outFile(outputFile, std::ios::binary);
+  FileStreamBuffer buffer;
+  uint64_t written = 0;
+
+  while (remaining > 0) {
+    size_t chunkLen = remaining < FILE_STREAM_CHUNK_SIZE ? static_cast<size_t>(remaining) : FILE_STREAM_CHUNK_SIZE;
+
+    if (readChunk(inFile, buffer.data, chunkLen) != chunkLen) {
+      return abortOutputFile(outFile, outputFile);
+    }
+
+    size_t outLen = chunkLen;
+
+    if (!crypt(buffer.data, chunkLen, buffer.data, outLen)) {
+      return abortOutputFile(outFile, outputFile);
+    }
+
+    remaining -= chunkLen;
+    size_t writeLen = outLen;
+
+    if (remaining == 0) {
+      // Remove PKCS7 padding (başlıktaki boyut kadar veri yazılır)
+      size_t paddingLen = static_cast<size_t>(written + outLen - origSize);
+      uint8_t invalid = 0;
+
+      for (size_t i = 0; i < paddingLen; ++i) {
+        invalid |= buffer.data[outLen - 1 - i] ^ static_cast<uint8_t>(paddingLen);
+      }
+
+      if (invalid) {
+        return abortOutputFile(outFile, outputFile);
+      }
+
+      writeLen -= paddingLen;
+    }
+
+    outFile.write(reinterpret_cast<const char *>(buffer.data), writeLen);
+    written += writeLen;
+
+    if (!outFile) {
+      return abortOutputFile(outFile, outputFile);
+    }
+  }
+
+  outFile.close();
 
   if (!outFile) {
-    delete[] ciphertext;
-    delete[] plaintext;
+    std::remove(outputFile);
     return false;
   }
 
-  outFile.write(reinterpret_cast<const char *>(plaintext), plaintextLen);
-  outFile.close();
-  delete[] ciphertext;
-  delete[] plaintext;
   return true;
 }
 
@@ -1365,29 +4568,6 @@ static uint64_t permuteBits(uint64_t input, const uint8_t *table, int size) {
   return output;
 }
 
-/**
- * @brief DES S-box uygulama helper fonksiyonu
- *
- * 48-bit girdiyi 8 adet 6-bit parçaya böler, her parçayı ilgili S-box'tan geçirir
- * ve 32-bit çıktı üretir.
- *
- * @param input Girdi değeri (48 bit, ancak 32 bit olarak temsil edilir)
- * @return S-box çıktısı (32 bit)
- */
-static uint32_t applySBox(uint32_t input) {
-  uint32_t output = 0;
-
-  for (int i = 0; i < 8; ++i) {
-    uint32_t sboxInput = (input >> (42 - i * 6)) & 0x3F;
-    uint32_t row = ((sboxInput & 0x20) >> 4) | (sboxInput & 0x01);
-    uint32_t col = (sboxInput >> 1) & 0x0F;
-    uint32_t sboxOutput = DES_SBOX[i][row][col];
-    output |= (sboxOutput << (28 - i * 4));
-  }
-
-  return output;
-}
-
 /**
  * @brief Whitebox DES için subkey'leri oluştur
  *
@@ -1418,123 +4598,472 @@ static void generateSubkeys(uint64_t keys[16]) {
       right = ((right << 1) | (right >> 27)) & 0xFFFFFFF;
     }
 
-    uint64_t combined = ((uint64_t)left << 28) | right;
-    keys[round] = permuteBits(combined, DES_PC2, 48);
+    uint64_t combined = ((uint64_t)left << 28) | right;
+    keys[round] = permuteBits(combined, DES_PC2, 48);
+  }
+}
+
+// ============================================
+// WHITEBOX DES - TABLO TABANLI VE BITSLICE MOTOR
+// ============================================
+
+/**
+ * @brief Eski S-box kablolamasının 6-bit pencere kaydırmaları
+ *
+ * İlk sürüm S-box girdisini `(uint32_t)(expanded >> 16) >> (42 - 6i)` ile
+ * okuyordu; 32 bit üzerinde 32'den büyük kaydırmalar x86'da mod 32 uygulanır.
+ * Şifreli verinin uyumlu kalması için bu etkin kaydırmalar burada açıkça
+ * (tanımsız davranış olmadan) sabitlenmiştir. S-box 2'nin penceresi 30'dan
+ * başlar, yani yalnızca 2 geçerli biti vardır.
+ */
+static const uint8_t DES_LEGACY_SBOX_SHIFT[8] = {10, 4, 30, 24, 18, 12, 6, 0};
+
+/** @brief Bitslice motorun bir seferde işlediği blok sayısı (64-bit kelime başına) */
+static const size_t DES_BITSLICE_BLOCKS = 64;
+
+/**
+ * @brief Whitebox DES için önceden hesaplanan tablolar
+ *
+ * IP/FP ve genişletme (E) byte bazlı tablolara, S-box + P permütasyonu ise
+ * birleşik SP tablolarına indirgenir; gömülü anahtarın round key'leri bir kez
+ * çıkarılır. Bitslice motor için her S-box çıktı biti, (b5, b6) üzerindeki
+ * 4 girişli doğruluk tablolarına (yaprak) ayrıştırılır.
+ */
+struct WhiteboxDESTables {
+  uint64_t ip[8][256];        /**< @brief Byte konumu başına IP katkısı */
+  uint64_t fp[8][256];        /**< @brief Byte konumu başına FP katkısı */
+  uint32_t expand[4][256];    /**< @brief E(R)'nin S-box'ların okuduğu üst 32 biti */
+  uint32_t sp[8][64];         /**< @brief S-box çıktısı + P permütasyonu */
+  uint32_t roundKeys[16];     /**< @brief Round key'lerin kullanılan üst 32 biti */
+  uint8_t sboxLeaf[8][4][16]; /**< @brief (b1..b4) başına (b5,b6) doğruluk tablosu */
+  uint8_t sboxInput[8][6];    /**< @brief S-box girdi biti başına R dilimi (32 = sabit 0) */
+  uint8_t keyBit[16][8][6];   /**< @brief S-box girdi biti başına round key biti */
+};
+
+/** @brief Whitebox DES tabloları (ilk kullanımda bir kez doldurulur) */
+static WhiteboxDESTables g_whiteboxDESTables;
+
+/** @brief Whitebox DES tablolarının tek seferlik oluşturulması için bayrak */
+static std::once_flag g_whiteboxDESTablesOnce;
+
+/**
+ * @brief Bir S-box'ın 6-bit girdisi için çıktısı
+ *
+ * @param sbox S-box indeksi (0-7)
+ * @param value 6-bit girdi (b1..b6, b1 en anlamlı)
+ * @return uint32_t 4-bit çıktı
+ */
+static uint32_t desSBoxLookup(int sbox, uint32_t value) {
+  uint32_t row = ((value & 0x20) >> 4) | (value & 0x01);
+  uint32_t col = (value >> 1) & 0x0F;
+  return DES_SBOX[sbox][row][col];
+}
+
+/**
+ * @brief Whitebox DES tablolarını oluştur (std::call_once ile çağrılır)
+ */
+static void buildWhiteboxDESTables() {
+  WhiteboxDESTables &t = g_whiteboxDESTables;
+
+  for (int b = 0; b < 8; ++b) {
+    for (int v = 0; v < 256; ++v) {
+      uint64_t in = static_cast<uint64_t>(v) << (56 - 8 * b);
+      t.ip[b][v] = permuteBits(in, DES_IP, 64);
+      t.fp[b][v] = permuteBits(in, DES_FP, 64);
+    }
+  }
+
+  for (int b = 0; b < 4; ++b) {
+    for (int v = 0; v < 256; ++v) {
+      uint64_t in = static_cast<uint64_t>(v) << (56 - 8 * b);
+      t.expand[b][v] = static_cast<uint32_t>(permuteBits(in, DES_E, 48) >> 16);
+    }
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    for (uint32_t v = 0; v < 64; ++v) {
+      uint32_t s = desSBoxLookup(i, v) << (28 - i * 4);
+      uint32_t p = 0;
+
+      for (int j = 0; j < 32; ++j) {
+        if (s & (1U << (31 - (DES_P[j] - 1)))) {
+          p |= 1U << (31 - j);
+        }
+      }
+
+      t.sp[i][v] = p;
+    }
+
+    for (int out = 0; out < 4; ++out) {
+      for (uint32_t high = 0; high < 16; ++high) {
+        uint8_t leaf = 0;
+
+        for (uint32_t low = 0; low < 4; ++low) {
+          if ((desSBoxLookup(i, high * 4 + low) >> (3 - out)) & 1) {
+            leaf |= static_cast<uint8_t>(1U << low);
+          }
+        }
+
+        t.sboxLeaf[i][out][high] = leaf;
+      }
+    }
+  }
+
+  uint64_t subkeys[16];
+  generateSubkeys(subkeys);
+
+  for (int round = 0; round < 16; ++round) {
+    t.roundKeys[round] = static_cast<uint32_t>(subkeys[round] >> 16);
+  }
+
+  for (int i = 0; i < 8; ++i) {
+    for (int m = 0; m < 6; ++m) {
+      int pos = DES_LEGACY_SBOX_SHIFT[i] + 5 - m;
+      t.sboxInput[i][m] = static_cast<uint8_t>(pos > 31 ? 32 : DES_E[31 - pos] - 1);
+
+      for (int round = 0; round < 16; ++round) {
+        t.keyBit[round][i][m] = static_cast<uint8_t>(pos > 31 ? 0 : (t.roundKeys[round] >> pos) & 1);
+      }
+    }
+  }
+
+  Security::secureMemset(subkeys, 0, sizeof(subkeys));
+}
+
+/**
+ * @brief Tablo tabanlı DES Feistel fonksiyonu
+ *
+ * @param t Whitebox DES tabloları
+ * @param right Sağ yarı (32 bit)
+ * @param roundKey Round key (üst 32 bit)
+ * @return uint32_t f(R, K)
+ */
+static inline uint32_t whiteboxDESFeistel(const WhiteboxDESTables &t, uint32_t right, uint32_t roundKey) {
+  uint32_t y = t.expand[0][right >> 24] ^ t.expand[1][(right >> 16) & 0xFF] ^
+               t.expand[2][(right >> 8) & 0xFF] ^ t.expand[3][right & 0xFF] ^ roundKey;
+  return t.sp[0][(y >> DES_LEGACY_SBOX_SHIFT[0]) & 0x3F] ^ t.sp[1][(y >> DES_LEGACY_SBOX_SHIFT[1]) & 0x3F] ^
+         t.sp[2][y >> DES_LEGACY_SBOX_SHIFT[2]] ^ t.sp[3][(y >> DES_LEGACY_SBOX_SHIFT[3]) & 0x3F] ^
+         t.sp[4][(y >> DES_LEGACY_SBOX_SHIFT[4]) & 0x3F] ^ t.sp[5][(y >> DES_LEGACY_SBOX_SHIFT[5]) & 0x3F] ^
+         t.sp[6][(y >> DES_LEGACY_SBOX_SHIFT[6]) & 0x3F] ^ t.sp[7][y & 0x3F];
+}
+
+/**
+ * @brief Tek bloğu tablo tabanlı yolla işle (bitslice grubuna sığmayan kuyruk)
+ *
+ * @param t Whitebox DES tabloları
+ * @param in Girdi bloğu (8 byte)
+ * @param out Çıktı bloğu (8 byte)
+ * @param decrypt true ise round key'ler ters sırada kullanılır
+ */
+static void whiteboxDESBlock(const WhiteboxDESTables &t, const uint8_t *in, uint8_t *out, bool decrypt) {
+  uint64_t block = 0;
+
+  for (int i = 0; i < 8; ++i) {
+    block ^= t.ip[i][in[i]];
+  }
+
+  uint32_t left = static_cast<uint32_t>(block >> 32);
+  uint32_t right = static_cast<uint32_t>(block);
+
+  for (int round = 0; round < 16; ++round) {
+    uint32_t temp = right;
+    right = left ^ whiteboxDESFeistel(t, right, t.roundKeys[decrypt ? 15 - round : round]);
+    left = temp;
+  }
+
+  // Son swap: R16 || L16
+  uint64_t preOutput = (static_cast<uint64_t>(right) << 32) | left;
+  block = 0;
+
+  for (int i = 0; i < 8; ++i) {
+    block ^= t.fp[i][(preOutput >> (56 - 8 * i)) & 0xFF];
+  }
+
+  storeBE64(out, block);
+}
+
+/**
+ * @brief 64x64 bit matris transpozu (yerinde, kendi tersidir)
+ *
+ * a[i]'nin j. biti (MSB = 0) a[j]'nin i. bitine taşınır. 64 bloğu dilimlere
+ * (slice c = her bloğun c. biti) ve geri dönüştürmek için kullanılır.
+ *
+ * @param a 64 kelimelik matris
+ */
+static void transpose64(uint64_t a[64]) {
+  uint64_t mask = 0x00000000FFFFFFFFULL;
+
+  for (int j = 32; j != 0; j >>= 1, mask ^= (mask << j)) {
+    for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+      uint64_t x = (a[k] ^ (a[k | j] >> j)) & mask;
+      a[k] ^= x;
+      a[k | j] ^= (x << j);
+    }
+  }
+}
+
+#ifdef _MSC_VER
+  /** @brief Bitslice şablonlarını çağıran fonksiyona zorla göm */
+  #define DES_BITSLICE_INLINE __forceinline
+#else
+  /**
+   * @brief Bitslice şablonlarını çağıran fonksiyona zorla göm
+   *
+   * AVX2 hedefli çağırıcıya gömülmeleri, vektör kelimelerin -O0'da bile
+   * AVX2 komutlarıyla işlenmesini (ve ABI uyumsuzluğu olmamasını) sağlar.
+   */
+  #define DES_BITSLICE_INLINE inline __attribute__((always_inline))
+#endif
+
+/**
+ * @brief Bitslice seçici: sel biti 0 ise a, 1 ise b
+ *
+ * @param out Sonuç dilimi
+ * @param sel Seçici dilim
+ * @param a sel = 0 iken seçilen dilim
+ * @param b sel = 1 iken seçilen dilim
+ */
+template <typename Word>
+static DES_BITSLICE_INLINE void bitsliceMux(Word &out, const Word &sel, const Word &a, const Word &b) {
+  out = a ^ ((a ^ b) & sel);
+}
+
+/**
+ * @brief Bir S-box'ı bitslice olarak değerlendir
+ *
+ * (b5, b6)'nın 16 olası fonksiyonu minterm'lerden bir kez kurulur; her çıktı
+ * biti, yaprak tablosundan seçilen fonksiyonlar üzerinde b4, b3, b2, b1 ile
+ * bir mux ağacıdır. Girdiye bağlı bellek erişimi yoktur.
+ *
+ * @param leaf S-box'ın yaprak tabloları
+ * @param in 6 girdi dilimi (b1..b6)
+ * @param out 4 çıktı dilimi
+ */
+template <typename Word>
+static DES_BITSLICE_INLINE void bitslicedDESSBox(const uint8_t leaf[4][16], const Word in[6], Word out[4]) {
+  Word n5 = ~in[4];
+  Word n6 = ~in[5];
+  Word minterm[4] = {n5 & n6, n5 & in[5], in[4] & n6, in[4] & in[5]};
+  Word f[16];
+  f[0] = minterm[0] ^ minterm[0];
+  f[1] = minterm[0];
+  f[2] = minterm[1];
+  f[3] = minterm[0] | minterm[1];
+
+  for (int k = 4; k < 8; ++k) {
+    f[k] = f[k - 4] | minterm[2];
+  }
+
+  for (int k = 8; k < 16; ++k) {
+    f[k] = f[k - 8] | minterm[3];
+  }
+
+  for (int o = 0; o < 4; ++o) {
+    const uint8_t *lf = leaf[o];
+    Word level1[8];
+    Word level2[4];
+
+    Word level3[2];
+
+    for (int j = 0; j < 8; ++j) {
+      bitsliceMux(level1[j], in[3], f[lf[2 * j]], f[lf[2 * j + 1]]);
+    }
+
+    for (int j = 0; j < 4; ++j) {
+      bitsliceMux(level2[j], in[2], level1[2 * j], level1[2 * j + 1]);
+    }
+
+    for (int j = 0; j < 2; ++j) {
+      bitsliceMux(level3[j], in[1], level2[2 * j], level2[2 * j + 1]);
+    }
+
+    bitsliceMux(out[o], in[0], level3[0], level3[1]);
+  }
+}
+
+/**
+ * @brief Dilimlenmiş 64-bit DES durumunu 16 round boyunca işle
+ *
+ * IP, E, P ve FP yalnızca dilim indeksinin yeniden adlandırılmasıdır; round
+ * key bitleri sabit maske (tümü 0 / tümü 1) olarak girdilere katlanır.
+ *
+ * @param t Whitebox DES tabloları
+ * @param slices 64 dilim (slice c = blokların c. biti); yerinde güncellenir
+ * @param decrypt true ise round key'ler ters sırada kullanılır
+ */
+template <typename Word>
+static DES_BITSLICE_INLINE void bitslicedDESRounds(const WhiteboxDESTables &t, Word slices[64], bool decrypt) {
+  Word left[32];
+  Word right[33];
+
+  for (int i = 0; i < 32; ++i) {
+    left[i] = slices[DES_IP[i] - 1];
+    right[i] = slices[DES_IP[32 + i] - 1];
+  }
+
+  // Eski kablolamada okunan ama E(R)'de olmayan bitler için sabit 0 dilimi
+  right[32] = left[0] ^ left[0];
+  Word ones = ~right[32];
+
+  for (int round = 0; round < 16; ++round) {
+    const uint8_t (*keyBit)[6] = t.keyBit[decrypt ? 15 - round : round];
+    Word sboxOut[32];
+
+    for (int i = 0; i < 8; ++i) {
+      Word in[6];
+
+      for (int m = 0; m < 6; ++m) {
+        Word bit = right[t.sboxInput[i][m]];
+        in[m] = keyBit[i][m] ? (bit ^ ones) : bit;
+      }
+
+      bitslicedDESSBox(t.sboxLeaf[i], in, sboxOut + 4 * i);
+    }
+
+    for (int j = 0; j < 32; ++j) {
+      Word newRight = left[j] ^ sboxOut[DES_P[j] - 1];
+      left[j] = right[j];
+      right[j] = newRight;
+    }
+  }
+
+  Word preOutput[64];
+
+  for (int i = 0; i < 32; ++i) {
+    preOutput[i] = right[i];
+    preOutput[32 + i] = left[i];
+  }
+
+  for (int i = 0; i < 64; ++i) {
+    slices[i] = preOutput[DES_FP[i] - 1];
   }
 }
 
 /**
- * @brief DES Feistel function
+ * @brief 64 bloğu tek 64-bit kelime genişliğinde bitslice olarak işle
  *
- * DES algoritmasının temel fonksiyonu. Expansion, S-box substitution,
- * permutation ve XOR işlemlerini yapar.
- *
- * @param right Feistel function'a giren sağ yarı (32 bit)
- * @param subkey Round key (48 bit)
- * @return Feistel function çıktısı (32 bit)
+ * @param t Whitebox DES tabloları
+ * @param in Girdi blokları (64 * 8 byte)
+ * @param out Çıktı blokları (64 * 8 byte, in ile aynı olabilir)
+ * @param decrypt Şifre çözme mi
  */
-static uint32_t feistelFunction(uint32_t right, uint64_t subkey) {
-  // Expansion
-  uint64_t expanded = permuteBits((uint64_t)right << 32, DES_E, 48);
-  expanded ^= subkey;
-  // S-box substitution
-  uint32_t sboxOutput = applySBox((uint32_t)(expanded >> 16));
-  // Permutation P
-  uint32_t output = 0;
-
-  for (int i = 0; i < 32; ++i) {
-    int bitPos = DES_P[i] - 1;
+static void whiteboxDESBitslice64(const WhiteboxDESTables &t, const uint8_t *in, uint8_t *out, bool decrypt) {
+  uint64_t slices[64];
 
-    if (sboxOutput & (1U << (31 - bitPos))) {
-      output |= (1U << (31 - i));
-    }
+  for (int i = 0; i < 64; ++i) {
+    slices[i] = loadBE64(in + i * 8);
   }
 
-  return output;
+  transpose64(slices);
+  bitslicedDESRounds(t, slices, decrypt);
+  transpose64(slices);
+
+  for (int i = 0; i < 64; ++i) {
+    storeBE64(out + i * 8, slices[i]);
+  }
 }
 
+#if defined(TRAVELEXPENSE_AES_X86) && !defined(_MSC_VER)
+/** @brief 4 x 64-bit bitslice kelimesi (GCC/Clang vektör uzantısı, AVX2 register'ı) */
+typedef uint64_t DESBitsliceWord256 __attribute__((vector_size(32)));
+
+/** @brief AVX2 bitslice motoru derlenir (CPUID ile seçilir) */
+#define WHITEBOX_DES_AVX2
+
 /**
- * @brief DES block şifreleme (whitebox - embedded key)
- *
- * DES algoritması ile 8 byte'lık bir blok şifreler.
- * Anahtar koda gömülü olduğu için whitebox implementasyonu.
+ * @brief 256 bloğu AVX2 ile bitslice olarak işle (her şeride 64 blok)
  *
- * @param input Şifrelenecek blok (8 byte)
- * @param output Şifrelenmiş blok çıktısı (8 byte)
- * @param subkeys Round key'leri (16 adet 48-bit subkey)
+ * @param t Whitebox DES tabloları
+ * @param in Girdi blokları (256 * 8 byte)
+ * @param out Çıktı blokları (256 * 8 byte, in ile aynı olabilir)
+ * @param decrypt Şifre çözme mi
  */
-static void desEncryptBlock(const uint8_t *input, uint8_t *output, uint64_t subkeys[16]) {
-  // Initial Permutation
-  uint64_t block = 0;
+__attribute__((target("avx2"))) static void whiteboxDESBitslice256(const WhiteboxDESTables &t, const uint8_t *in,
+    uint8_t *out, bool decrypt) {
+  uint64_t lanes[4][64];
 
-  for (int i = 0; i < 8; ++i) {
-    block = (block << 8) | input[i];
+  for (int lane = 0; lane < 4; ++lane) {
+    for (int i = 0; i < 64; ++i) {
+      lanes[lane][i] = loadBE64(in + (lane * 64 + i) * 8);
+    }
+
+    transpose64(lanes[lane]);
   }
 
-  block = permuteBits(block, DES_IP, 64);
-  uint32_t left = (block >> 32) & 0xFFFFFFFF;
-  uint32_t right = block & 0xFFFFFFFF;
+  DESBitsliceWord256 slices[64];
 
-  // 16 Feistel rounds
-  for (int round = 0; round < 16; ++round) {
-    uint32_t temp = right;
-    right = left ^ feistelFunction(right, subkeys[round]);
-    left = temp;
+  for (int i = 0; i < 64; ++i) {
+    DESBitsliceWord256 word = {lanes[0][i], lanes[1][i], lanes[2][i], lanes[3][i]};
+    slices[i] = word;
   }
 
-  // Swap left and right (final swap)
-  uint32_t temp = left;
-  left = right;
-  right = temp;
-  // Final Permutation
-  block = ((uint64_t)left << 32) | right;
-  block = permuteBits(block, DES_FP, 64);
+  bitslicedDESRounds(t, slices, decrypt);
 
-  for (int i = 0; i < 8; ++i) {
-    output[i] = (block >> (56 - i * 8)) & 0xFF;
+  for (int i = 0; i < 64; ++i) {
+    for (int lane = 0; lane < 4; ++lane) {
+      lanes[lane][i] = slices[i][lane];
+    }
+  }
+
+  for (int lane = 0; lane < 4; ++lane) {
+    transpose64(lanes[lane]);
+
+    for (int i = 0; i < 64; ++i) {
+      storeBE64(out + (lane * 64 + i) * 8, lanes[lane][i]);
+    }
   }
 }
+#endif
 
 /**
- * @brief DES block şifre çözme (reverse subkeys)
+ * @brief Çok bloklu whitebox DES (ortak gövde)
  *
- * DES algoritması ile 8 byte'lık bir blok şifre çözer.
- * Subkey'ler ters sırada kullanılır.
+ * Bloklar mümkün olduğunca geniş bitslice gruplarıyla (AVX2: 256, genel: 64)
+ * işlenir; kalan kuyruk tablo tabanlı yoldan geçer.
  *
- * @param input Şifre çözülecek blok (8 byte)
- * @param output Şifre çözülmüş blok çıktısı (8 byte)
- * @param subkeys Round key'leri (16 adet 48-bit subkey, ters sırada kullanılır)
+ * @param input Girdi blokları
+ * @param output Çıktı blokları
+ * @param blockCount Blok sayısı
+ * @param decrypt Şifre çözme mi
+ * @return true Başarılı, false Hata
  */
-static void desDecryptBlock(const uint8_t *input, uint8_t *output, uint64_t subkeys[16]) {
-  // Initial Permutation
-  uint64_t block = 0;
-
-  for (int i = 0; i < 8; ++i) {
-    block = (block << 8) | input[i];
+static bool whiteboxDESBlocks(const void *input, void *output, size_t blockCount, bool decrypt) {
+  if (!input || !output || blockCount == 0) {
+    return false;
   }
 
-  block = permuteBits(block, DES_IP, 64);
-  uint32_t left = (block >> 32) & 0xFFFFFFFF;
-  uint32_t right = block & 0xFFFFFFFF;
+  std::call_once(g_whiteboxDESTablesOnce, buildWhiteboxDESTables);
+  const WhiteboxDESTables &t = g_whiteboxDESTables;
+  const uint8_t *in = static_cast<const uint8_t *>(input);
+  uint8_t *out = static_cast<uint8_t *>(output);
+  size_t i = 0;
+#ifdef WHITEBOX_DES_AVX2
 
-  // 16 Feistel rounds (reverse order)
-  for (int round = 15; round >= 0; --round) {
-    uint32_t temp = right;
-    right = left ^ feistelFunction(right, subkeys[round]);
-    left = temp;
+  if (getAESCPUFeatures().avx2) {
+    for (; i + 4 * DES_BITSLICE_BLOCKS <= blockCount; i += 4 * DES_BITSLICE_BLOCKS) {
+      whiteboxDESBitslice256(t, in + i * 8, out + i * 8, decrypt);
+    }
   }
 
-  // Swap left and right (final swap)
-  uint32_t temp = left;
-  left = right;
-  right = temp;
-  // Final Permutation
-  block = ((uint64_t)left << 32) | right;
-  block = permuteBits(block, DES_FP, 64);
+#endif
 
-  for (int i = 0; i < 8; ++i) {
-    output[i] = (block >> (56 - i * 8)) & 0xFF;
+  for (; i + DES_BITSLICE_BLOCKS <= blockCount; i += DES_BITSLICE_BLOCKS) {
+    whiteboxDESBitslice64(t, in + i * 8, out + i * 8, decrypt);
+  }
+
+  for (; i < blockCount; ++i) {
+    whiteboxDESBlock(t, in + i * 8, out + i * 8, decrypt);
   }
+
+  return true;
+}
+
+bool encryptWhiteboxDESBlocks(const void *input, void *output, size_t blockCount) {
+  return whiteboxDESBlocks(input, output, blockCount, false);
+}
+
+bool decryptWhiteboxDESBlocks(const void *input, void *output, size_t blockCount) {
+  return whiteboxDESBlocks(input, output, blockCount, true);
 }
 
 /**
@@ -1556,15 +5085,8 @@ bool encryptWhiteboxDES(const void *plaintext, size_t plaintextLen,
     return false;
   }
 
-  // Generate subkeys (whitebox - embedded in code)
-  uint64_t subkeys[16];
-  generateSubkeys(subkeys);
-  const uint8_t *plain = static_cast<const uint8_t *>(plaintext);
-  uint8_t *cipher = static_cast<uint8_t *>(ciphertext);
-
-  // Process 8-byte blocks
-  for (size_t i = 0; i < plaintextLen; i += 8) {
-    desEncryptBlock(plain + i, cipher + i, subkeys);
+  if (!encryptWhiteboxDESBlocks(plaintext, ciphertext, plaintextLen / 8)) {
+    return false;
   }
 
   ciphertextLen = plaintextLen;
@@ -1589,15 +5111,8 @@ bool decryptWhiteboxDES(const void *ciphertext, size_t ciphertextLen,
     return false;
   }
 
-  // Generate subkeys (whitebox - embedded in code)
-  uint64_t subkeys[16];
-  generateSubkeys(subkeys);
-  const uint8_t *cipher = static_cast<const uint8_t *>(ciphertext);
-  uint8_t *plain = static_cast<uint8_t *>(plaintext);
-
-  // Process 8-byte blocks
-  for (size_t i = 0; i < ciphertextLen; i += 8) {
-    desDecryptBlock(cipher + i, plain + i, subkeys);
+  if (!decryptWhiteboxDESBlocks(ciphertext, plaintext, ciphertextLen / 8)) {
+    return false;
   }
 
   plaintextLen = ciphertextLen;
@@ -1609,65 +5124,14 @@ bool decryptWhiteboxDES(const void *ciphertext, size_t ciphertextLen,
  *
  * Dosyayı whitebox DES ile şifreler ve çıktı dosyasına yazar.
  * Çıktı formatı: [Original Size (8 byte)][Ciphertext (padded)]
+ * Dosya sabit boyutlu parçalar halinde işlenir (bkz. encryptFileWhitebox).
  *
  * @param inputFile Girdi dosyası yolu
  * @param outputFile Çıktı dosyası yolu
  * @return true Başarılı, false Hata (dosya açılamadı, şifreleme başarısız vb.)
  */
 bool encryptFileWhiteboxDES(const char *inputFile, const char *outputFile) {
-  if (!inputFile || !outputFile) {
-    return false;
-  }
-
-  std::ifstream inFile(inputFile, std::ios::binary);
-
-  if (!inFile) {
-    return false;
-  }
-
-  inFile.seekg(0, std::ios::end);
-  size_t fileSize = static_cast<size_t>(inFile.tellg());
-  inFile.seekg(0, std::ios::beg);
-  // PKCS7 padding (8-byte blocks for DES)
-  size_t paddedLen = ((fileSize + 7) / 8) * 8;
-  uint8_t *plaintext = new uint8_t[paddedLen];
-  std::memset(plaintext, 0, paddedLen);
-  inFile.read(reinterpret_cast<char *>(plaintext), fileSize);
-  inFile.close();
-  // Apply PKCS7 padding
-  uint8_t paddingValue = static_cast<uint8_t>(paddedLen - fileSize);
-
-  for (size_t i = fileSize; i < paddedLen; ++i) {
-    plaintext[i] = paddingValue;
-  }
-
-  // Encrypt
-  size_t ciphertextLen = paddedLen;
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
-
-  if (!encryptWhiteboxDES(plaintext, paddedLen, ciphertext, ciphertextLen)) {
-    delete[] plaintext;
-    delete[] ciphertext;
-    return false;
-  }
-
-  // Write output (prepend original size)
-  std::ofstream outFile(outputFile, std::ios::binary);
-
-  if (!outFile) {
-    delete[] plaintext;
-    delete[] ciphertext;
-    return false;
-  }
-
-  // Write original file size (8 bytes)
-  uint64_t origSize = fileSize;
-  outFile.write(reinterpret_cast<const char *>(&origSize), 8);
-  outFile.write(reinterpret_cast<const char *>(ciphertext), ciphertextLen);
-  outFile.close();
-  delete[] plaintext;
-  delete[] ciphertext;
-  return true;
+  return encryptFileWhitebox(inputFile, outputFile, 8, encryptWhiteboxDES);
 }
 
 /**
@@ -1675,83 +5139,14 @@ bool encryptFileWhiteboxDES(const char *inputFile, const char *outputFile) {
  *
  * Whitebox DES ile şifrelenmiş dosyayı çözer ve çıktı dosyasına yazar.
  * Girdi formatı: [Original Size (8 byte)][Ciphertext (padded)]
+ * Dosya sabit boyutlu parçalar halinde işlenir (bkz. decryptFileWhitebox).
  *
  * @param inputFile Girdi dosyası yolu (şifrelenmiş)
  * @param outputFile Çıktı dosyası yolu (şifre çözülmüş)
  * @return true Başarılı, false Hata (dosya açılamadı, şifre çözme başarısız vb.)
  */
 bool decryptFileWhiteboxDES(const char *inputFile, const char *outputFile) {
-  if (!inputFile || !outputFile) {
-    return false;
-  }
-
-  std::ifstream inFile(inputFile, std::ios::binary);
-
-  if (!inFile) {
-    return false;
-  }
-
-  // Read original file size
-  uint64_t origSize = 0;
-  inFile.read(reinterpret_cast<char *>(&origSize), 8);
-  inFile.seekg(0, std::ios::end);
-  size_t fileSize = static_cast<size_t>(inFile.tellg());
-  inFile.seekg(8, std::ios::beg); // Skip size header
-  size_t ciphertextLen = fileSize - 8;
-
-  if (ciphertextLen == 0 || ciphertextLen % 8 != 0) {
-    inFile.close();
-    return false;
-  }
-
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
-  inFile.read(reinterpret_cast<char *>(ciphertext), ciphertextLen);
-  inFile.close();
-  // Decrypt
-  size_t plaintextLen = ciphertextLen;
-  uint8_t *plaintext = new uint8_t[plaintextLen];
-
-  if (!decryptWhiteboxDES(ciphertext, ciphertextLen, plaintext, plaintextLen)) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  // Remove PKCS7 padding
-  if (plaintextLen == 0) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  uint8_t paddingValue = plaintext[plaintextLen - 1];
-
-  if (paddingValue > 8 || paddingValue == 0) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  size_t actualSize = plaintextLen - paddingValue;
-
-  if (actualSize > origSize) {
-    actualSize = origSize;
-  }
-
-  // Write output
-  std::ofstream outFile(outputFile, std::ios::binary);
-
-  if (!outFile) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  outFile.write(reinterpret_cast<const char *>(plaintext), actualSize);
-  outFile.close();
-  delete[] ciphertext;
-  delete[] plaintext;
-  return true;
+  return decryptFileWhitebox(inputFile, outputFile, 8, decryptWhiteboxDES);
 }
 
 // ============================================
@@ -1787,89 +5182,57 @@ static const uint8_t WHITEBOX_KEY_WHITENING_MASK[32] = {
 };
 
 /**
- * @brief Whitebox AES - Precomputed T-box lookup tables for each round
- *
- * T-boxes (T = SubBytes + ShiftRows + MixColumns + AddRoundKey combined)
- * Her round için 256 entry'li lookup table'lar precomputed olarak saklanır.
- * Bu tablolar key schedule'ı içerir ve reverse engineering'i zorlaştırır.
+ * @brief Whitebox AES - Anahtar gömülü T-box tabloları (şifreleme)
  *
- * @note Bu implementasyonda, her round için 4 T-box (her sütun için bir tane)
- * kullanılır. Her T-box 256 entry içerir ve her entry 4 byte (bir sütun) içerir.
+ * T-box = AddRoundKey + SubBytes + ShiftRows + MixColumns birleşik.
+ * Round key byte'ı tablo indeksine katlanmıştır; çalışma zamanında round key
+ * bellekte bulunmaz, her round yalnızca tablo okuması ve XOR'dan oluşur.
  *
- * Format: WHITEBOX_T_BOX[round][byte_value][column_index]
- * - round: 0-13 (14 rounds for AES-256)
- * - byte_value: 0-255 (input byte value)
- * - column_index: 0-3 (4 columns in AES state)
+ * Format: WHITEBOX_AES_ENC_TBOX[round][byte_position][byte_value]
+ * - round: 0-12 (MixColumns içeren 13 round)
+ * - byte_position: 0-15 (state içindeki byte, sütun * 4 + satır)
+ * - byte_value: 0-255 (girdi byte değeri)
  */
-static uint8_t WHITEBOX_T_BOX[14][256][4] = {0};
-static bool WHITEBOX_T_BOX_INITIALIZED = false;
+static uint32_t WHITEBOX_AES_ENC_TBOX[13][16][256];
 
 /**
- * @brief Whitebox T-box'ları precompute et
+ * @brief Whitebox AES - Son round tablosu (şifreleme)
  *
- * Her round için T-box lookup table'larını oluşturur.
- * T-box = SubBytes + ShiftRows + MixColumns + AddRoundKey
- *
- * @param roundKeys Round key'leri (15 rounds * 16 bytes)
+ * Son round (SubBytes + ShiftRows) ile hem round 13 hem de round 14 anahtarı
+ * tek tabloya katlanmıştır.
  */
-static void precomputeWhiteboxTBoxes(const uint8_t roundKeys[15][16]) {
-  if (WHITEBOX_T_BOX_INITIALIZED) {
-    return; // Already initialized
-  }
+static uint8_t WHITEBOX_AES_ENC_LAST[16][256];
 
-  // Her round için T-box'ları hesapla
-  for (int round = 0; round < 14; ++round) {
-    for (int byteVal = 0; byteVal < 256; ++byteVal) {
-      // Her sütun için T-box değerini hesapla
-      for (int col = 0; col < 4; ++col) {
-        uint8_t state[4] = {0};
-        // Input: byteVal değerini sütunun col. pozisyonuna koy
-        state[col] = byteVal;
-        // SubBytes
-        state[0] = AES_SBOX[state[0]];
-        state[1] = AES_SBOX[state[1]];
-        state[2] = AES_SBOX[state[2]];
-        state[3] = AES_SBOX[state[3]];
+/** @brief Whitebox AES - Anahtar gömülü T-box tabloları (şifre çözme, eşdeğer ters şifre) */
+static uint32_t WHITEBOX_AES_DEC_TBOX[13][16][256];
 
-        // ShiftRows (sütun bazlı, burada basitleştirilmiş)
-        // Not: Gerçek ShiftRows state matrix üzerinde çalışır
-        // Burada sadece sütun bazlı hesaplama yapıyoruz
-
-        // MixColumns (sadece round < 13 için)
-        if (round < 13) {
-          uint8_t s0 = state[0], s1 = state[1], s2 = state[2], s3 = state[3];
-          state[0] = gmul(0x02, s0) ^ gmul(0x03, s1) ^ s2 ^ s3;
-          state[1] = s0 ^ gmul(0x02, s1) ^ gmul(0x03, s2) ^ s3;
-          state[2] = s0 ^ s1 ^ gmul(0x02, s2) ^ gmul(0x03, s3);
-          state[3] = gmul(0x03, s0) ^ s1 ^ s2 ^ gmul(0x02, s3);
-        }
+/** @brief Whitebox AES - Son round tablosu (şifre çözme) */
+static uint8_t WHITEBOX_AES_DEC_LAST[16][256];
 
-        // AddRoundKey (round+1 key kullanılır çünkü round 0 initial key)
-        state[0] ^= roundKeys[round + 1][col * 4];
-        state[1] ^= roundKeys[round + 1][col * 4 + 1];
-        state[2] ^= roundKeys[round + 1][col * 4 + 2];
-        state[3] ^= roundKeys[round + 1][col * 4 + 3];
-        // T-box değerini sakla
-        WHITEBOX_T_BOX[round][byteVal][0] = state[0];
-        WHITEBOX_T_BOX[round][byteVal][1] = state[1];
-        WHITEBOX_T_BOX[round][byteVal][2] = state[2];
-        WHITEBOX_T_BOX[round][byteVal][3] = state[3];
-      }
-    }
-  }
+/** @brief Whitebox tablolarının tek seferlik (thread-safe) oluşturulması için bayrak */
+static std::once_flag g_whiteboxAESTablesOnce;
 
-  WHITEBOX_T_BOX_INITIALIZED = true;
+/**
+ * @brief Round key word'ünden byte al
+ *
+ * @param words Round key word'leri
+ * @param round Round numarası
+ * @param position State içindeki byte pozisyonu (sütun * 4 + satır)
+ * @return uint8_t Round key byte'ı
+ */
+static inline uint8_t whiteboxKeyByte(const uint32_t *words, int round, int position) {
+  return static_cast<uint8_t>(words[round * 4 + position / 4] >> (24 - 8 * (position % 4)));
 }
 
 /**
- * @brief Whitebox round key'leri oluştur (lookup table'lara gömülü)
+ * @brief Whitebox AES tablolarını oluştur
  *
- * Gömülü anahtardan AES-256 için 15 round key oluşturur.
- * Key whitening uygulanarak anahtar bilgisi maskelenir.
- *
- * @param roundKeys Çıktı round key'leri (15 rounds * 16 bytes)
+ * Gömülü anahtar maskesi kaldırılarak genişletilir, tüm round key'ler
+ * tablolara katlanır ve ardından anahtar takvimi bellekten silinir.
+ * std::call_once ile süreç ömrü boyunca yalnızca bir kez çalışır.
  */
-static void generateWhiteboxRoundKeys(uint8_t roundKeys[15][16]) {
+static void buildWhiteboxAESTables() {
+  std::call_once(g_aesTablesOnce, buildAESTables);
   // Key whitening: Anahtarı mask ile XOR'la
   uint8_t whitenedKey[32];
 
@@ -1877,217 +5240,159 @@ static void generateWhiteboxRoundKeys(uint8_t roundKeys[15][16]) {
     whitenedKey[i] = WHITEBOX_AES_KEY[i] ^ WHITEBOX_KEY_WHITENING_MASK[i];
   }
 
-  // Use normal key expansion but store in whitebox format
-  uint8_t tempRoundKeys[240];
-  aesKeyExpansion(whitenedKey, tempRoundKeys);
+  AES256Context ctx;
+  initAES256Context(&ctx, whitenedKey);
+  Security::secureMemset(whitenedKey, 0, sizeof(whitenedKey));
 
-  // Convert to round key format (15 rounds * 16 bytes)
-  for (int round = 0; round < 15; ++round) {
-    for (int i = 0; i < 16; ++i) {
-      roundKeys[round][i] = tempRoundKeys[round * 16 + i];
+  for (int round = 0; round < 13; ++round) {
+    for (int position = 0; position < 16; ++position) {
+      int row = position % 4;
+      uint8_t encKey = whiteboxKeyByte(ctx.encKeyWords, round, position);
+      uint8_t decKey = whiteboxKeyByte(ctx.decKeyWords, round, position);
+
+      for (int x = 0; x < 256; ++x) {
+        WHITEBOX_AES_ENC_TBOX[round][position][x] = rightRotate(AES_TE0[x ^ encKey], 8 * row);
+        WHITEBOX_AES_DEC_TBOX[round][position][x] = rightRotate(AES_TD0[x ^ decKey], 8 * row);
+      }
     }
   }
 
-  // T-box'ları precompute et (ilk çağrıda)
-  if (!WHITEBOX_T_BOX_INITIALIZED) {
-    precomputeWhiteboxTBoxes(roundKeys);
+  for (int position = 0; position < 16; ++position) {
+    int col = position / 4;
+    int row = position % 4;
+    // ShiftRows: (sütun, satır) byte'ı şifrelemede (sütun - satır), çözmede (sütun + satır) sütununa gider
+    int encDest = ((col + 4 - row) % 4) * 4 + row;
+    int decDest = ((col + row) % 4) * 4 + row;
+    uint8_t encKey = whiteboxKeyByte(ctx.encKeyWords, 13, position);
+    uint8_t encFinal = whiteboxKeyByte(ctx.encKeyWords, 14, encDest);
+    uint8_t decKey = whiteboxKeyByte(ctx.decKeyWords, 13, position);
+    uint8_t decFinal = whiteboxKeyByte(ctx.decKeyWords, 14, decDest);
+
+    for (int x = 0; x < 256; ++x) {
+      WHITEBOX_AES_ENC_LAST[position][x] = AES_SBOX[x ^ encKey] ^ encFinal;
+      WHITEBOX_AES_DEC_LAST[position][x] = AES_INV_SBOX[x ^ decKey] ^ decFinal;
+    }
   }
+
+  clearAES256Context(&ctx);
 }
 
 /**
- * @brief Whitebox AES block şifreleme (gömülü anahtar ile)
+ * @brief Whitebox AES blok şifreleme (yalnızca tablo okuması)
  *
- * Gömülü anahtar ile AES-256 block şifreleme yapar.
- * Gerçek whitebox implementasyonda lookup table'lar kullanılır.
- *
- * @param input Şifrelenecek blok (16 byte)
- * @param output Şifrelenmiş blok çıktısı (16 byte)
+ * @param in Girdi blok (16 byte)
+ * @param out Çıktı blok (16 byte, in ile aynı olabilir)
  */
-static void whiteboxAESEncryptBlock(const uint8_t *input, uint8_t *output) {
-  uint8_t state[16];
-  std::memcpy(state, input, 16);
-  // Generate round keys (in real whitebox, these would be in lookup tables)
-  uint8_t roundKeys[15][16];
-  generateWhiteboxRoundKeys(roundKeys);
-
-  // Initial AddRoundKey
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[0][i];
-  }
-
-  // 14 rounds for AES-256
-  for (int round = 1; round < 14; ++round) {
-    // SubBytes
-    for (int i = 0; i < 16; ++i) {
-      state[i] = AES_SBOX[state[i]];
-    }
-
-    // ShiftRows
-    uint8_t temp = state[1];
-    state[1] = state[5];
-    state[5] = state[9];
-    state[9] = state[13];
-    state[13] = temp;
-    temp = state[2];
-    state[2] = state[10];
-    state[10] = temp;
-    temp = state[6];
-    state[6] = state[14];
-    state[14] = temp;
-    temp = state[3];
-    state[3] = state[15];
-    state[15] = state[11];
-    state[11] = state[7];
-    state[7] = temp;
-
-    // MixColumns (except last round)
-    if (round < 13) {
-      for (int c = 0; c < 4; ++c) {
-        uint8_t s0 = state[c * 4], s1 = state[c * 4 + 1];
-        uint8_t s2 = state[c * 4 + 2], s3 = state[c * 4 + 3];
-        state[c * 4] = gmul(0x02, s0) ^ gmul(0x03, s1) ^ s2 ^ s3;
-        state[c * 4 + 1] = s0 ^ gmul(0x02, s1) ^ gmul(0x03, s2) ^ s3;
-        state[c * 4 + 2] = s0 ^ s1 ^ gmul(0x02, s2) ^ gmul(0x03, s3);
-        state[c * 4 + 3] = gmul(0x03, s0) ^ s1 ^ s2 ^ gmul(0x02, s3);
-      }
+static void whiteboxAESEncryptBlock(const uint8_t *in, uint8_t *out) {
+  uint8_t s[16];
+  std::memcpy(s, in, 16);
+
+  for (int round = 0; round < 13; ++round) {
+    const uint32_t (*t)[256] = WHITEBOX_AES_ENC_TBOX[round];
+    uint32_t c[4];
+
+    for (int col = 0; col < 4; ++col) {
+      // Çıktı sütunu col: satır r byte'ı (col + r) sütunundan gelir (ShiftRows)
+      int p0 = col * 4;
+      int p1 = ((col + 1) % 4) * 4 + 1;
+      int p2 = ((col + 2) % 4) * 4 + 2;
+      int p3 = ((col + 3) % 4) * 4 + 3;
+      c[col] = t[p0][s[p0]] ^ t[p1][s[p1]] ^ t[p2][s[p2]] ^ t[p3][s[p3]];
     }
 
-    // AddRoundKey
-    for (int i = 0; i < 16; ++i) {
-      state[i] ^= roundKeys[round][i];
+    for (int col = 0; col < 4; ++col) {
+      storeBE32(s + col * 4, c[col]);
     }
   }
 
-  // Final round
-  for (int i = 0; i < 16; ++i) {
-    state[i] = AES_SBOX[state[i]];
-  }
-
-  uint8_t temp = state[1];
-  state[1] = state[5];
-  state[5] = state[9];
-  state[9] = state[13];
-  state[13] = temp;
-  temp = state[2];
-  state[2] = state[10];
-  state[10] = temp;
-  temp = state[6];
-  state[6] = state[14];
-  state[14] = temp;
-  temp = state[3];
-  state[3] = state[15];
-  state[15] = state[11];
-  state[11] = state[7];
-  state[7] = temp;
-
-  // Final AddRoundKey
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[14][i];
+  uint8_t result[16];
+
+  for (int position = 0; position < 16; ++position) {
+    int col = position / 4;
+    int row = position % 4;
+    result[((col + 4 - row) % 4) * 4 + row] = WHITEBOX_AES_ENC_LAST[position][s[position]];
   }
 
-  std::memcpy(output, state, 16);
+  std::memcpy(out, result, 16);
 }
 
 /**
- * @brief Whitebox AES block şifre çözme (gömülü anahtar ile)
+ * @brief Whitebox AES blok şifre çözme (yalnızca tablo okuması)
  *
- * Gömülü anahtar ile AES-256 block şifre çözme yapar.
- * Gerçek whitebox implementasyonda inverse lookup table'lar kullanılır.
- *
- * @param input Şifre çözülecek blok (16 byte)
- * @param output Şifre çözülmüş blok çıktısı (16 byte)
+ * @param in Şifreli blok (16 byte)
+ * @param out Çözülmüş blok (16 byte, in ile aynı olabilir)
  */
-static void whiteboxAESDecryptBlock(const uint8_t *input, uint8_t *output) {
-  uint8_t state[16];
-  std::memcpy(state, input, 16);
-  // Generate round keys (in reverse order for decryption)
-  uint8_t roundKeys[15][16];
-  generateWhiteboxRoundKeys(roundKeys);
+static void whiteboxAESDecryptBlock(const uint8_t *in, uint8_t *out) {
+  uint8_t s[16];
+  std::memcpy(s, in, 16);
+
+  for (int round = 0; round < 13; ++round) {
+    const uint32_t (*t)[256] = WHITEBOX_AES_DEC_TBOX[round];
+    uint32_t c[4];
+
+    for (int col = 0; col < 4; ++col) {
+      // Çıktı sütunu col: satır r byte'ı (col - r) sütunundan gelir (InvShiftRows)
+      int p0 = col * 4;
+      int p1 = ((col + 3) % 4) * 4 + 1;
+      int p2 = ((col + 2) % 4) * 4 + 2;
+      int p3 = ((col + 1) % 4) * 4 + 3;
+      c[col] = t[p0][s[p0]] ^ t[p1][s[p1]] ^ t[p2][s[p2]] ^ t[p3][s[p3]];
+    }
 
-  // Inverse final round
-  // AddRoundKey (reverse)
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[14][i];
-  }
-
-  // InvShiftRows
-  uint8_t temp = state[13];
-  state[13] = state[9];
-  state[9] = state[5];
-  state[5] = state[1];
-  state[1] = temp;
-  temp = state[2];
-  state[2] = state[10];
-  state[10] = temp;
-  temp = state[6];
-  state[6] = state[14];
-  state[14] = temp;
-  temp = state[3];
-  state[3] = state[7];
-  state[7] = state[11];
-  state[11] = state[15];
-  state[15] = temp;
-
-  // InvSubBytes
-  for (int i = 0; i < 16; ++i) {
-    state[i] = AES_INV_SBOX[state[i]];
+    for (int col = 0; col < 4; ++col) {
+      storeBE32(s + col * 4, c[col]);
+    }
   }
 
-  // 14 rounds in reverse
-  for (int round = 13; round >= 1; --round) {
-    // AddRoundKey
-    for (int i = 0; i < 16; ++i) {
-      state[i] ^= roundKeys[round][i];
-    }
+  uint8_t result[16];
 
-    // InvMixColumns (before AddRoundKey for decryption)
-    if (round > 0) {
-      for (int c = 0; c < 4; ++c) {
-        uint8_t s0 = state[c * 4], s1 = state[c * 4 + 1];
-        uint8_t s2 = state[c * 4 + 2], s3 = state[c * 4 + 3];
-        state[c * 4] = gmul(0x0e, s0) ^ gmul(0x0b, s1) ^ gmul(0x0d, s2) ^ gmul(0x09, s3);
-        state[c * 4 + 1] = gmul(0x09, s0) ^ gmul(0x0e, s1) ^ gmul(0x0b, s2) ^ gmul(0x0d, s3);
-        state[c * 4 + 2] = gmul(0x0d, s0) ^ gmul(0x09, s1) ^ gmul(0x0e, s2) ^ gmul(0x0b, s3);
-        state[c * 4 + 3] = gmul(0x0b, s0) ^ gmul(0x0d, s1) ^ gmul(0x09, s2) ^ gmul(0x0e, s3);
-      }
-    }
+  for (int position = 0; position < 16; ++position) {
+    int col = position / 4;
+    int row = position % 4;
+    result[((col + row) % 4) * 4 + row] = WHITEBOX_AES_DEC_LAST[position][s[position]];
+  }
+
+  std::memcpy(out, result, 16);
+}
 
-    // InvShiftRows
-    temp = state[13];
-    state[13] = state[9];
-    state[9] = state[5];
-    state[5] = state[1];
-    state[1] = temp;
-    temp = state[2];
-    state[2] = state[10];
-    state[10] = temp;
-    temp = state[6];
-    state[6] = state[14];
-    state[14] = temp;
-    temp = state[3];
-    state[3] = state[7];
-    state[7] = state[11];
-    state[11] = state[15];
-    state[15] = temp;
+bool encryptWhiteboxAESBlocks(const void *input, void *output, size_t blockCount) {
+  if (!input || !output || blockCount == 0) {
+    return false;
+  }
 
-    // InvSubBytes
-    for (int i = 0; i < 16; ++i) {
-      state[i] = AES_INV_SBOX[state[i]];
-    }
+  std::call_once(g_whiteboxAESTablesOnce, buildWhiteboxAESTables);
+  const uint8_t *in = static_cast<const uint8_t *>(input);
+  uint8_t *out = static_cast<uint8_t *>(output);
+
+  for (size_t i = 0; i < blockCount; ++i) {
+    whiteboxAESEncryptBlock(in + i * 16, out + i * 16);
   }
 
-  // Initial AddRoundKey
-  for (int i = 0; i < 16; ++i) {
-    state[i] ^= roundKeys[0][i];
+  return true;
+}
+
+bool decryptWhiteboxAESBlocks(const void *input, void *output, size_t blockCount) {
+  if (!input || !output || blockCount == 0) {
+    return false;
+  }
+
+  std::call_once(g_whiteboxAESTablesOnce, buildWhiteboxAESTables);
+  const uint8_t *in = static_cast<const uint8_t *>(input);
+  uint8_t *out = static_cast<uint8_t *>(output);
+
+  for (size_t i = 0; i < blockCount; ++i) {
+    whiteboxAESDecryptBlock(in + i * 16, out + i * 16);
   }
 
-  std::memcpy(output, state, 16);
+  return true;
 }
 
 /**
  * @brief Whitebox AES Şifreleme
  *
  * Gömülü anahtar ile AES-256 şifreleme yapar. PKCS7 padding kullanır (16-byte blocks).
+ * Bloklar önceden hesaplanmış whitebox tablolarıyla işlenir; anahtar takvimi
+ * çağrı başına tekrar genişletilmez.
  *
  * @param plaintext Şifrelenecek veri
  * @param plaintextLen Veri uzunluğu (byte, 16'nın katı olmalı)
@@ -2102,14 +5407,7 @@ bool encryptWhiteboxAES(const void *plaintext, size_t plaintextLen,
     return false;
   }
 
-  const uint8_t *plain = static_cast<const uint8_t *>(plaintext);
-  uint8_t *cipher = static_cast<uint8_t *>(ciphertext);
-
-  // Process 16-byte blocks
-  for (size_t i = 0; i < plaintextLen; i += 16) {
-    whiteboxAESEncryptBlock(plain + i, cipher + i);
-  }
-
+  encryptWhiteboxAESBlocks(plaintext, ciphertext, plaintextLen / 16);
   ciphertextLen = plaintextLen;
   return true;
 }
@@ -2132,14 +5430,7 @@ bool decryptWhiteboxAES(const void *ciphertext, size_t ciphertextLen,
     return false;
   }
 
-  const uint8_t *cipher = static_cast<const uint8_t *>(ciphertext);
-  uint8_t *plain = static_cast<uint8_t *>(plaintext);
-
-  // Process 16-byte blocks
-  for (size_t i = 0; i < ciphertextLen; i += 16) {
-    whiteboxAESDecryptBlock(cipher + i, plain + i);
-  }
-
+  decryptWhiteboxAESBlocks(ciphertext, plaintext, ciphertextLen / 16);
   plaintextLen = ciphertextLen;
   return true;
 }
@@ -2149,65 +5440,14 @@ bool decryptWhiteboxAES(const void *ciphertext, size_t ciphertextLen,
  *
  * Dosyayı whitebox AES ile şifreler ve çıktı dosyasına yazar.
  * Çıktı formatı: [Original Size (8 byte)][Ciphertext (padded)]
+ * Dosya sabit boyutlu parçalar halinde işlenir (bkz. encryptFileWhitebox).
  *
  * @param inputFile Girdi dosyası yolu
  * @param outputFile Çıktı dosyası yolu
  * @return true Başarılı, false Hata (dosya açılamadı, şifreleme başarısız vb.)
  */
 bool encryptFileWhiteboxAES(const char *inputFile, const char *outputFile) {
-  if (!inputFile || !outputFile) {
-    return false;
-  }
-
-  std::ifstream inFile(inputFile, std::ios::binary);
-
-  if (!inFile) {
-    return false;
-  }
-
-  inFile.seekg(0, std::ios::end);
-  size_t fileSize = static_cast<size_t>(inFile.tellg());
-  inFile.seekg(0, std::ios::beg);
-  // PKCS7 padding (16-byte blocks for AES)
-  size_t paddedLen = ((fileSize + 15) / 16) * 16;
-  uint8_t *plaintext = new uint8_t[paddedLen];
-  std::memset(plaintext, 0, paddedLen);
-  inFile.read(reinterpret_cast<char *>(plaintext), fileSize);
-  inFile.close();
-  // Apply PKCS7 padding
-  uint8_t paddingValue = static_cast<uint8_t>(paddedLen - fileSize);
-
-  for (size_t i = fileSize; i < paddedLen; ++i) {
-    plaintext[i] = paddingValue;
-  }
-
-  // Encrypt
-  size_t ciphertextLen = paddedLen;
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
-
-  if (!encryptWhiteboxAES(plaintext, paddedLen, ciphertext, ciphertextLen)) {
-    delete[] plaintext;
-    delete[] ciphertext;
-    return false;
-  }
-
-  // Write output (prepend original size)
-  std::ofstream outFile(outputFile, std::ios::binary);
-
-  if (!outFile) {
-    delete[] plaintext;
-    delete[] ciphertext;
-    return false;
-  }
-
-  // Write original file size (8 bytes)
-  uint64_t origSize = fileSize;
-  outFile.write(reinterpret_cast<const char *>(&origSize), 8);
-  outFile.write(reinterpret_cast<const char *>(ciphertext), ciphertextLen);
-  outFile.close();
-  delete[] plaintext;
-  delete[] ciphertext;
-  return true;
+  return encryptFileWhitebox(inputFile, outputFile, 16, encryptWhiteboxAES);
 }
 
 /**
@@ -2215,83 +5455,14 @@ bool encryptFileWhiteboxAES(const char *inputFile, const char *outputFile) {
  *
  * Whitebox AES ile şifrelenmiş dosyayı çözer ve çıktı dosyasına yazar.
  * Girdi formatı: [Original Size (8 byte)][Ciphertext (padded)]
+ * Dosya sabit boyutlu parçalar halinde işlenir (bkz. decryptFileWhitebox).
  *
  * @param inputFile Girdi dosyası yolu (şifrelenmiş)
  * @param outputFile Çıktı dosyası yolu (şifre çözülmüş)
  * @return true Başarılı, false Hata (dosya açılamadı, şifre çözme başarısız vb.)
  */
 bool decryptFileWhiteboxAES(const char *inputFile, const char *outputFile) {
-  if (!inputFile || !outputFile) {
-    return false;
-  }
-
-  std::ifstream inFile(inputFile, std::ios::binary);
-
-  if (!inFile) {
-    return false;
-  }
-
-  // Read original file size
-  uint64_t origSize = 0;
-  inFile.read(reinterpret_cast<char *>(&origSize), 8);
-  inFile.seekg(0, std::ios::end);
-  size_t fileSize = static_cast<size_t>(inFile.tellg());
-  inFile.seekg(8, std::ios::beg); // Skip size header
-  size_t ciphertextLen = fileSize - 8;
-
-  if (ciphertextLen == 0 || ciphertextLen % 16 != 0) {
-    inFile.close();
-    return false;
-  }
-
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
-  inFile.read(reinterpret_cast<char *>(ciphertext), ciphertextLen);
-  inFile.close();
-  // Decrypt
-  size_t plaintextLen = ciphertextLen;
-  uint8_t *plaintext = new uint8_t[plaintextLen];
-
-  if (!decryptWhiteboxAES(ciphertext, ciphertextLen, plaintext, plaintextLen)) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  // Remove PKCS7 padding
-  if (plaintextLen == 0) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  uint8_t paddingValue = plaintext[plaintextLen - 1];
-
-  if (paddingValue > 16 || paddingValue == 0) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  size_t actualSize = plaintextLen - paddingValue;
-
-  if (actualSize > origSize) {
-    actualSize = origSize;
-  }
-
-  // Write output
-  std::ofstream outFile(outputFile, std::ios::binary);
-
-  if (!outFile) {
-    delete[] ciphertext;
-    delete[] plaintext;
-    return false;
-  }
-
-  outFile.write(reinterpret_cast<const char *>(plaintext), actualSize);
-  outFile.close();
-  delete[] ciphertext;
-  delete[] plaintext;
-  return true;
+  return decryptFileWhitebox(inputFile, outputFile, 16, decryptWhiteboxAES);
 }
 
 } // namespace Encryption
@@ -11,13 +11,16 @@
 #include "../header/fingerprinting.h"
 #include "../header/encryption.h"
 #include "../header/rasp.h"
+#include "../header/security.h"
 #include "../header/sessionManager.h"
-#include "../header/safe_string.h"
 #include <cstring>
 #include <ctime>
 #include <sstream>
-#include <iomanip>
 #include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <system_error>
+#include <thread>
 
 #ifdef _WIN32
   #define WIN32_LEAN_AND_MEAN
@@ -31,22 +34,34 @@
   #include <sys/ioctl.h>
   #include <net/if.h>
   #include <ifaddrs.h>
+  #include <netpacket/packet.h>
   #include <sys/utsname.h>
 #endif
 
+#ifdef __linux__
+  #include <cerrno>
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <linux/netlink.h>
+  #include <linux/rtnetlink.h>
+#endif
+
 namespace TravelExpense {
 
 namespace Fingerprinting {
 
 // ============================================
-// CİHAZ FİNGERPRİNTİNG
+// FİNGERPRİNT HESAPLAMA
 // ============================================
 
-ErrorCode generateDeviceFingerprint(char *fingerprint) {
-  if (!fingerprint) {
-    return ErrorCode::InvalidInput;
-  }
-
+/**
+ * @brief Cihaz fingerprint'ini hesapla (önbelleksiz)
+ *
+ * @param fingerprint Çıktı (64 karakter hex + null)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode computeDeviceFingerprint(char *fingerprint) {
   std::ostringstream oss;
 #ifdef _WIN32
   // Windows: MAC adresi kullan
@@ -59,10 +74,9 @@ ErrorCode generateDeviceFingerprint(char *fingerprint) {
 
     if (pAdapterInfo) {
       // İlk MAC adresini kullan
-      for (int i = 0; i < pAdapterInfo->AddressLength; ++i) {
-        oss << std::hex << std::setw(2) << std::setfill('0')
-            << static_cast<int>(pAdapterInfo->Address[i]);
-      }
+      char macHex[2 * MAX_ADAPTER_ADDRESS_LENGTH + 1];
+      Encryption::encodeHex(pAdapterInfo->Address, pAdapterInfo->AddressLength, macHex);
+      oss << macHex;
     }
   }
 
@@ -88,10 +102,9 @@ ErrorCode generateDeviceFingerprint(char *fingerprint) {
       if (ifa->ifa_addr && ifa->ifa_addr->sa_family == AF_PACKET) {
         struct sockaddr_ll *s = reinterpret_cast<struct sockaddr_ll *>(ifa->ifa_addr);
 
-        for (int i = 0; i < 6; ++i) {
-          oss << std::hex << std::setw(2) << std::setfill('0')
-              << static_cast<int>(s->sll_addr[i]);
-        }
+        char macHex[13];
+        Encryption::encodeHex(s->sll_addr, 6, macHex);
+        oss << macHex;
 
         break; // İlk MAC adresini kullan
       }
@@ -129,51 +142,23 @@ ErrorCode generateDeviceFingerprint(char *fingerprint) {
   }
 
   // SHA-256 hash ile fingerprint oluştur
-  char hash[65];
+  Encryption::Digest256 digest;
 
-  if (!Encryption::sha256Hash(fp.c_str(), fp.length(), hash)) {
+  if (!Encryption::sha256Digest(fp.c_str(), fp.length(), digest)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  SafeString::safeCopy(fingerprint, 65, hash);
+  Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), fingerprint);
   return ErrorCode::Success;
 }
 
-ErrorCode verifyDeviceFingerprint(const char *expectedFingerprint) {
-  if (!expectedFingerprint) {
-    return ErrorCode::InvalidInput;
-  }
-
-  // Mevcut cihaz fingerprint'ini al
-  char currentFingerprint[65];
-
-  if (generateDeviceFingerprint(currentFingerprint) != ErrorCode::Success) {
-    return ErrorCode::Unknown;
-  }
-
-  // Fingerprint'leri karşılaştır (case-insensitive)
-#ifdef _WIN32
-
-  if (_strnicmp(currentFingerprint, expectedFingerprint, 64) != 0) {
-#else
-
-  if (strncasecmp(currentFingerprint, expectedFingerprint, 64) != 0) {
-#endif
-    return ErrorCode::InvalidInput; // Geçersiz cihaz
-  }
-
-  return ErrorCode::Success;
-}
-
-// ============================================
-// UYGULAMA FİNGERPRİNTİNG
-// ============================================
-
-ErrorCode generateApplicationFingerprint(char *fingerprint) {
-  if (!fingerprint) {
-    return ErrorCode::InvalidInput;
-  }
-
+/**
+ * @brief Uygulama fingerprint'ini hesapla (önbelleksiz)
+ *
+ * @param fingerprint Çıktı (64 karakter hex + null)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode computeApplicationFingerprint(char *fingerprint) {
   std::ostringstream oss;
   // Executable dosyasının checksum'unu al
   char selfChecksum[65] = {0};
@@ -202,25 +187,214 @@ ErrorCode generateApplicationFingerprint(char *fingerprint) {
   }
 
   // SHA-256 hash ile fingerprint oluştur
-  char hash[65];
+  Encryption::Digest256 digest;
 
-  if (!Encryption::sha256Hash(fp.c_str(), fp.length(), hash)) {
+  if (!Encryption::sha256Digest(fp.c_str(), fp.length(), digest)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  SafeString::safeCopy(fingerprint, 65, hash);
+  Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), fingerprint);
   return ErrorCode::Success;
 }
 
-ErrorCode verifyApplicationFingerprint(const char *expectedFingerprint) {
+/**
+ * @brief Birleşik fingerprint'i hesapla: SHA-256(deviceFp || appFp)
+ *
+ * @param deviceFp Cihaz fingerprint'i
+ * @param appFp Uygulama fingerprint'i
+ * @param fingerprint Çıktı (64 karakter hex + null)
+ */
+static void computeCombinedFingerprint(const char *deviceFp, const char *appFp, char *fingerprint) {
+  // Ara string olmadan
+  Encryption::SHA256Context ctx;
+  Encryption::sha256Init(&ctx);
+  Encryption::sha256Update(&ctx, deviceFp, std::strlen(deviceFp));
+  Encryption::sha256Update(&ctx, appFp, std::strlen(appFp));
+  Encryption::Digest256 digest;
+  Encryption::sha256Final(&ctx, digest);
+  Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), fingerprint);
+}
+
+// ============================================
+// FİNGERPRİNT ÖNBELLEĞİ
+// ============================================
+
+/**
+ * @brief Önbellekteki fingerprint türleri
+ */
+enum class FingerprintSlot {
+  Device = 0,       /**< @brief Cihaz fingerprint'i */
+  Application = 1,  /**< @brief Uygulama fingerprint'i */
+  Combined = 2      /**< @brief Birleşik fingerprint */
+};
+
+/** @brief Önbellekteki fingerprint türü sayısı */
+static const size_t FINGERPRINT_SLOT_COUNT = 3;
+
+/**
+ * @struct FingerprintEntry
+ * @brief Bir fingerprint'in ve ondan türetilen anahtarın önbellek kaydı
+ *
+ * Kayıt, generation değeri önbelleğinkine eşitse geçerlidir.
+ */
+struct FingerprintEntry {
+  bool valid;             /**< @brief Fingerprint hesaplandı mı */
+  bool keyValid;          /**< @brief Türetilmiş anahtar hesaplandı mı */
+  uint64_t generation;    /**< @brief Hesaplandığı andaki generation */
+  char fingerprint[65];   /**< @brief Fingerprint (64 karakter hex) */
+  uint8_t key[32];        /**< @brief generateDynamicKey() çıktısı */
+};
+
+/**
+ * @brief Süreç genelindeki fingerprint ve türetilmiş anahtar önbelleği
+ *
+ * Kayıtlar ilk kullanımda hesaplanır ve invalidateFingerprints() (veya ağ
+ * arayüzü değişikliği) generation değerini artırana kadar aynen döndürülür.
+ * generation atomiktir; SessionManager gibi kendi önbelleğini tutan
+ * modüller ucuz bir okumayla geçerliliği kontrol eder.
+ */
+struct FingerprintStore {
+  std::mutex mutex;                                  /**< @brief Kayıt kilidi */
+  std::atomic<uint64_t> generation;                  /**< @brief Geçersiz kılma sayacı */
+  FingerprintEntry entries[FINGERPRINT_SLOT_COUNT];  /**< @brief Kayıtlar (FingerprintSlot sırasıyla) */
+  uint64_t computations;                             /**< @brief Fingerprint hesaplama sayısı */
+  uint64_t keyDerivations;                           /**< @brief Anahtar türetme sayısı */
+  uint64_t hits;                                     /**< @brief Önbellekten dönen istek sayısı */
+
+  FingerprintStore() : generation(1), computations(0), keyDerivations(0), hits(0) {
+    memset(entries, 0, sizeof(entries));
+  }
+};
+
+static FingerprintStore g_fingerprintStore;
+
+/**
+ * @brief Fingerprint kaydının güncel olduğundan emin ol (kilit tutulmalı)
+ *
+ * Birleşik fingerprint, cihaz ve uygulama kayıtlarından türetilir;
+ * bunlar da gerekirse hesaplanır.
+ *
+ * @param slot Fingerprint türü
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode ensureFingerprintLocked(FingerprintSlot slot) {
+  FingerprintEntry &entry = g_fingerprintStore.entries[static_cast<size_t>(slot)];
+  uint64_t generation = g_fingerprintStore.generation.load();
+
+  if (entry.valid && entry.generation == generation) {
+    return ErrorCode::Success;
+  }
+
+  char fingerprint[65] = {0};
+  ErrorCode result = ErrorCode::Success;
+
+  if (slot == FingerprintSlot::Device) {
+    result = computeDeviceFingerprint(fingerprint);
+  } else if (slot == FingerprintSlot::Application) {
+    result = computeApplicationFingerprint(fingerprint);
+  } else {
+    if (ensureFingerprintLocked(FingerprintSlot::Device) != ErrorCode::Success ||
+        ensureFingerprintLocked(FingerprintSlot::Application) != ErrorCode::Success) {
+      return ErrorCode::Unknown;
+    }
+
+    computeCombinedFingerprint(g_fingerprintStore.entries[static_cast<size_t>(FingerprintSlot::Device)].fingerprint,
+                               g_fingerprintStore.entries[static_cast<size_t>(FingerprintSlot::Application)].fingerprint,
+                               fingerprint);
+  }
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  // Eski anahtar yeni fingerprint'e ait değildir
+  Security::secureMemset(entry.key, 0, sizeof(entry.key));
+  entry.keyValid = false;
+  memcpy(entry.fingerprint, fingerprint, sizeof(entry.fingerprint));
+  entry.generation = generation;
+  entry.valid = true;
+  ++g_fingerprintStore.computations;
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Fingerprint'i önbellekten oku (gerekirse hesapla)
+ *
+ * @param slot Fingerprint türü
+ * @param fingerprint Çıktı (64 karakter hex + null)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode readFingerprint(FingerprintSlot slot, char *fingerprint) {
+  std::lock_guard<std::mutex> lock(g_fingerprintStore.mutex);
+  FingerprintEntry &entry = g_fingerprintStore.entries[static_cast<size_t>(slot)];
+
+  if (entry.valid && entry.generation == g_fingerprintStore.generation.load()) {
+    ++g_fingerprintStore.hits;
+  } else {
+    ErrorCode result = ensureFingerprintLocked(slot);
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+  }
+
+  memcpy(fingerprint, entry.fingerprint, sizeof(entry.fingerprint));
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Fingerprint'ten türetilen anahtarı önbellekten oku (gerekirse türet)
+ *
+ * @param slot Fingerprint türü
+ * @param key Anahtar çıktısı (32 byte)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode readDerivedKey(FingerprintSlot slot, uint8_t *key) {
+  std::lock_guard<std::mutex> lock(g_fingerprintStore.mutex);
+  FingerprintEntry &entry = g_fingerprintStore.entries[static_cast<size_t>(slot)];
+
+  if (ensureFingerprintLocked(slot) != ErrorCode::Success) {
+    return ErrorCode::Unknown;
+  }
+
+  if (entry.keyValid) {
+    ++g_fingerprintStore.hits;
+  } else {
+    ErrorCode result = generateDynamicKey(entry.fingerprint, entry.key, sizeof(entry.key));
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+
+    entry.keyValid = true;
+    ++g_fingerprintStore.keyDerivations;
+  }
+
+  memcpy(key, entry.key, sizeof(entry.key));
+  return ErrorCode::Success;
+}
+
+// ============================================
+// CİHAZ FİNGERPRİNTİNG
+// ============================================
+
+ErrorCode generateDeviceFingerprint(char *fingerprint) {
+  if (!fingerprint) {
+    return ErrorCode::InvalidInput;
+  }
+
+  return readFingerprint(FingerprintSlot::Device, fingerprint);
+}
+
+ErrorCode verifyDeviceFingerprint(const char *expectedFingerprint) {
   if (!expectedFingerprint) {
     return ErrorCode::InvalidInput;
   }
 
-  // Mevcut uygulama fingerprint'ini al
+  // Mevcut cihaz fingerprint'ini al
   char currentFingerprint[65];
 
-  if (generateApplicationFingerprint(currentFingerprint) != ErrorCode::Success) {
+  if (generateDeviceFingerprint(currentFingerprint) != ErrorCode::Success) {
     return ErrorCode::Unknown;
   }
 
@@ -232,47 +406,58 @@ ErrorCode verifyApplicationFingerprint(const char *expectedFingerprint) {
 
   if (strncasecmp(currentFingerprint, expectedFingerprint, 64) != 0) {
 #endif
-    return ErrorCode::InvalidInput; // Geçersiz uygulama
+    return ErrorCode::InvalidInput; // Geçersiz cihaz
   }
 
   return ErrorCode::Success;
 }
 
-ErrorCode generateCombinedFingerprint(char *fingerprint) {
+// ============================================
+// UYGULAMA FİNGERPRİNTİNG
+// ============================================
+
+ErrorCode generateApplicationFingerprint(char *fingerprint) {
   if (!fingerprint) {
     return ErrorCode::InvalidInput;
   }
 
-  // Cihaz fingerprint'ini al
-  char deviceFp[65] = {0};
+  return readFingerprint(FingerprintSlot::Application, fingerprint);
+}
 
-  if (generateDeviceFingerprint(deviceFp) != ErrorCode::Success) {
-    return ErrorCode::Unknown;
+ErrorCode verifyApplicationFingerprint(const char *expectedFingerprint) {
+  if (!expectedFingerprint) {
+    return ErrorCode::InvalidInput;
   }
 
-  // Uygulama fingerprint'ini al
-  char appFp[65] = {0};
+  // Mevcut uygulama fingerprint'ini al
+  char currentFingerprint[65];
 
-  if (generateApplicationFingerprint(appFp) != ErrorCode::Success) {
+  if (generateApplicationFingerprint(currentFingerprint) != ErrorCode::Success) {
     return ErrorCode::Unknown;
   }
 
-  // Birleştir
-  std::ostringstream oss;
-  oss << deviceFp;
-  oss << appFp;
-  std::string combined = oss.str();
-  // SHA-256 hash ile birleşik fingerprint oluştur
-  char hash[65];
+  // Fingerprint'leri karşılaştır (case-insensitive)
+#ifdef _WIN32
 
-  if (!Encryption::sha256Hash(combined.c_str(), combined.length(), hash)) {
-    return ErrorCode::EncryptionFailed;
+  if (_strnicmp(currentFingerprint, expectedFingerprint, 64) != 0) {
+#else
+
+  if (strncasecmp(currentFingerprint, expectedFingerprint, 64) != 0) {
+#endif
+    return ErrorCode::InvalidInput; // Geçersiz uygulama
   }
 
-  SafeString::safeCopy(fingerprint, 65, hash);
   return ErrorCode::Success;
 }
 
+ErrorCode generateCombinedFingerprint(char *fingerprint) {
+  if (!fingerprint) {
+    return ErrorCode::InvalidInput;
+  }
+
+  return readFingerprint(FingerprintSlot::Combined, fingerprint);
+}
+
 // ============================================
 // DİNAMİK ANAHTAR YÖNETİMİ
 // ============================================
@@ -286,10 +471,8 @@ ErrorCode generateDynamicKey(const char *fingerprint, uint8_t *key, size_t keyLe
   // Salt olarak fingerprint'in ilk 16 byte'ını kullan
   uint8_t salt[16];
 
-  for (int i = 0; i < 16; ++i) {
-    // Hex karakterlerini byte'a çevir
-    char hexByte[3] = {fingerprint[i * 2], fingerprint[i * 2 + 1], '\0'};
-    salt[i] = static_cast<uint8_t>(strtol(hexByte, nullptr, 16));
+  if (!Encryption::decodeHex(fingerprint, salt, sizeof(salt))) {
+    return ErrorCode::InvalidInput;
   }
 
   // PBKDF2 ile anahtar türet (10000 iterasyon)
@@ -308,47 +491,232 @@ ErrorCode generateDeviceBasedKey(uint8_t *key, size_t keyLen) {
     return ErrorCode::InvalidInput;
   }
 
-  // Cihaz fingerprint'ini al
-  char deviceFp[65];
+  return readDerivedKey(FingerprintSlot::Device, key);
+}
 
-  if (generateDeviceFingerprint(deviceFp) != ErrorCode::Success) {
-    return ErrorCode::Unknown;
+ErrorCode generateApplicationBasedKey(uint8_t *key, size_t keyLen) {
+  if (!key || keyLen != 32) {
+    return ErrorCode::InvalidInput;
   }
 
-  // Dinamik anahtar oluştur
-  return generateDynamicKey(deviceFp, key, keyLen);
+  return readDerivedKey(FingerprintSlot::Application, key);
 }
 
-ErrorCode generateApplicationBasedKey(uint8_t *key, size_t keyLen) {
+ErrorCode generateCombinedKey(uint8_t *key, size_t keyLen) {
   if (!key || keyLen != 32) {
     return ErrorCode::InvalidInput;
   }
 
-  // Uygulama fingerprint'ini al
-  char appFp[65];
+  return readDerivedKey(FingerprintSlot::Combined, key);
+}
+
+// ============================================
+// FİNGERPRİNT ÖNBELLEĞİ YÖNETİMİ
+// ============================================
+
+/**
+ * @brief Ağ arayüzü değişikliklerini dinleyen arka plan thread'i
+ *
+ * Linux'ta NETLINK_ROUTE soketi (RTMGRP_LINK) dinlenir; arayüz eklenip
+ * çıkarıldığında veya durumu değiştiğinde önbellek geçersiz kılınır.
+ * Thread, wakePipe'a yazılarak durdurulur.
+ */
+struct NetworkChangeMonitor {
+  std::mutex mutex;     /**< @brief Başlat/durdur kilidi */
+  std::thread thread;   /**< @brief Dinleyici thread */
+  int netlinkFd;        /**< @brief Netlink soketi */
+  int wakePipe[2];      /**< @brief Durdurma sinyali için pipe */
+  bool running;         /**< @brief Dinleyici çalışıyor mu */
 
-  if (generateApplicationFingerprint(appFp) != ErrorCode::Success) {
+  NetworkChangeMonitor() : netlinkFd(-1), running(false) {
+    wakePipe[0] = -1;
+    wakePipe[1] = -1;
+  }
+
+  ~NetworkChangeMonitor() {
+    stopNetworkChangeMonitor();
+  }
+};
+
+static NetworkChangeMonitor g_networkMonitor;
+
+#ifdef __linux__
+/**
+ * @brief Netlink mesajlarını oku ve arayüz değişikliğinde önbelleği geçersiz kıl
+ *
+ * @param netlinkFd Netlink soketi
+ * @param wakeFd Durdurma pipe'ının okuma ucu
+ */
+static void networkMonitorLoop(int netlinkFd, int wakeFd) {
+  char buffer[8192];
+  struct pollfd fds[2];
+  fds[0].fd = netlinkFd;
+  fds[0].events = POLLIN;
+  fds[1].fd = wakeFd;
+  fds[1].events = POLLIN;
+
+  for (;;) {
+    fds[0].revents = 0;
+    fds[1].revents = 0;
+
+    if (poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+
+      break;
+    }
+
+    if (fds[1].revents != 0) {
+      break;
+    }
+
+    if ((fds[0].revents & POLLIN) == 0) {
+      break; // POLLERR / POLLHUP
+    }
+
+    ssize_t received = recv(netlinkFd, buffer, sizeof(buffer), 0);
+
+    if (received < 0) {
+      if (errno == ENOBUFS) {
+        // Mesaj kaçırıldı; değişiklik olmuş sayılır
+        invalidateFingerprints();
+      } else if (errno != EINTR && errno != EAGAIN) {
+        break;
+      }
+
+      continue;
+    }
+
+    bool changed = false;
+    int remaining = static_cast<int>(received);
+
+    for (struct nlmsghdr *header = reinterpret_cast<struct nlmsghdr *>(buffer);
+         NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining)) {
+      if (header->nlmsg_type == RTM_NEWLINK || header->nlmsg_type == RTM_DELLINK) {
+        changed = true;
+      }
+    }
+
+    if (changed) {
+      invalidateFingerprints();
+    }
+  }
+}
+#endif
+
+ErrorCode refreshFingerprints() {
+  std::lock_guard<std::mutex> lock(g_fingerprintStore.mutex);
+  ++g_fingerprintStore.generation;
+
+  // Birleşik kayıt cihaz ve uygulama kayıtlarını da hesaplar
+  if (ensureFingerprintLocked(FingerprintSlot::Combined) != ErrorCode::Success) {
     return ErrorCode::Unknown;
   }
 
-  // Dinamik anahtar oluştur
-  return generateDynamicKey(appFp, key, keyLen);
+  return ErrorCode::Success;
 }
 
-ErrorCode generateCombinedKey(uint8_t *key, size_t keyLen) {
-  if (!key || keyLen != 32) {
-    return ErrorCode::InvalidInput;
+void invalidateFingerprints() {
+  std::lock_guard<std::mutex> lock(g_fingerprintStore.mutex);
+  ++g_fingerprintStore.generation;
+
+  for (size_t i = 0; i < FINGERPRINT_SLOT_COUNT; ++i) {
+    Security::secureMemset(g_fingerprintStore.entries[i].key, 0, sizeof(g_fingerprintStore.entries[i].key));
+    g_fingerprintStore.entries[i].keyValid = false;
+    g_fingerprintStore.entries[i].valid = false;
   }
+}
 
-  // Birleşik fingerprint'i al
-  char combinedFp[65];
+uint64_t getFingerprintGeneration() {
+  return g_fingerprintStore.generation.load();
+}
 
-  if (generateCombinedFingerprint(combinedFp) != ErrorCode::Success) {
-    return ErrorCode::Unknown;
+ErrorCode startNetworkChangeMonitor() {
+#ifdef __linux__
+  std::lock_guard<std::mutex> lock(g_networkMonitor.mutex);
+
+  if (g_networkMonitor.running) {
+    return ErrorCode::Success;
+  }
+
+  int fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+
+  if (fd < 0) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+  struct sockaddr_nl address;
+  memset(&address, 0, sizeof(address));
+  address.nl_family = AF_NETLINK;
+  address.nl_groups = RTMGRP_LINK;
+
+  if (bind(fd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address)) != 0) {
+    close(fd);
+    return ErrorCode::ConnectionFailed;
+  }
+
+  int wakePipe[2];
+
+  if (pipe2(wakePipe, O_CLOEXEC) != 0) {
+    close(fd);
+    return ErrorCode::ConnectionFailed;
   }
 
-  // Dinamik anahtar oluştur
-  return generateDynamicKey(combinedFp, key, keyLen);
+  try {
+    g_networkMonitor.thread = std::thread(networkMonitorLoop, fd, wakePipe[0]);
+  } catch (const std::system_error &) {
+    close(fd);
+    close(wakePipe[0]);
+    close(wakePipe[1]);
+    return ErrorCode::MemoryAllocation;
+  }
+
+  g_networkMonitor.netlinkFd = fd;
+  g_networkMonitor.wakePipe[0] = wakePipe[0];
+  g_networkMonitor.wakePipe[1] = wakePipe[1];
+  g_networkMonitor.running = true;
+  // Dinleme başlamadan önceki değişiklikler kaçırılmış olabilir
+  invalidateFingerprints();
+  return ErrorCode::Success;
+#else
+  // Bildirim yalnızca Linux'ta (netlink) desteklenir; refreshFingerprints() kullanılmalı
+  return ErrorCode::Unknown;
+#endif
+}
+
+void stopNetworkChangeMonitor() {
+#ifdef __linux__
+  std::lock_guard<std::mutex> lock(g_networkMonitor.mutex);
+
+  if (!g_networkMonitor.running) {
+    return;
+  }
+
+  char signal = 1;
+  ssize_t written = write(g_networkMonitor.wakePipe[1], &signal, 1);
+  (void)written;
+  g_networkMonitor.thread.join();
+  close(g_networkMonitor.netlinkFd);
+  close(g_networkMonitor.wakePipe[0]);
+  close(g_networkMonitor.wakePipe[1]);
+  g_networkMonitor.netlinkFd = -1;
+  g_networkMonitor.wakePipe[0] = -1;
+  g_networkMonitor.wakePipe[1] = -1;
+  g_networkMonitor.running = false;
+#endif
+}
+
+void getFingerprintCacheStats(FingerprintCacheStats &stats) {
+  {
+    std::lock_guard<std::mutex> lock(g_fingerprintStore.mutex);
+    stats.generation = g_fingerprintStore.generation.load();
+    stats.computations = g_fingerprintStore.computations;
+    stats.keyDerivations = g_fingerprintStore.keyDerivations;
+    stats.hits = g_fingerprintStore.hits;
+  }
+  std::lock_guard<std::mutex> lock(g_networkMonitor.mutex);
+  stats.monitorRunning = g_networkMonitor.running;
 }
 
 } // namespace Fingerprinting
@@ -12,6 +12,7 @@
 #include "../header/migration.h"
 #include "../header/database.h"
 #include "../header/fileIO.h"
+#include "../header/userAuth.h"
 #include <fstream>
 #include <vector>
 #include <string>
@@ -269,6 +270,8 @@ ErrorCode migrateUsersToDatabase(const std::vector<User> &users, int32_t &migrat
 
   // Transaction commit et
   sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+  // Yeni eklenen kullanıcılar negatif önbellekte olabilir
+  UserAuth::clearUserCache();
   return ErrorCode::Success;
 }
 
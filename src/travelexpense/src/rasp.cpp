@@ -224,42 +224,73 @@ bool verifyCodeChecksum(const void *data, size_t size, const char *expectedCheck
     return false;
   }
 
-  // Mevcut checksum'u hesapla
-  char currentChecksum[65];
+  // Mevcut checksum'u ikili olarak hesapla
+  TravelExpense::Encryption::Digest256 current;
 
-  if (!calculateCodeChecksum(data, size, currentChecksum)) {
+  if (!TravelExpense::Encryption::sha256Digest(data, size, current)) {
     return false;
   }
 
-  // Checksum'ları karşılaştır (case-insensitive)
-  return (strncasecmp(currentChecksum, expectedChecksum, 64) == 0);
-}
+  // Beklenen değer hex'ten çözülür (büyük/küçük harf duyarsız)
+  TravelExpense::Encryption::Digest256 expected;
 
-bool calculateFileChecksum(const char *filePath, char *checksum) {
-  if (!filePath || !checksum) {
+  if (!TravelExpense::Encryption::decodeHex(expectedChecksum, expected.bytes, sizeof(expected.bytes))) {
     return false;
   }
 
-  // Dosyayı oku
-  std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+  return std::memcmp(current.bytes, expected.bytes, sizeof(current.bytes)) == 0;
+}
+
+/**
+ * @brief Dosyanın SHA-256 özetini sabit boyutlu parçalarla hesapla
+ *
+ * Dosya belleğe tamamen okunmaz; 64 KiB'lık buffer ile akış halinde işlenir.
+ *
+ * @param filePath Dosya yolu
+ * @param digest Özet çıktısı
+ * @return true Başarılı, false Dosya açılamadı/okunamadı veya boş
+ */
+static bool calculateFileDigest(const char *filePath, TravelExpense::Encryption::Digest256 &digest) {
+  std::ifstream file(filePath, std::ios::binary);
 
   if (!file.is_open()) {
     return false;
   }
 
-  // Dosya boyutunu al
-  size_t fileSize = static_cast<size_t>(file.tellg());
-  file.seekg(0, std::ios::beg);
-  // Dosya içeriğini oku
-  std::vector<uint8_t> buffer(fileSize);
+  std::vector<char> buffer(64 * 1024);
+  TravelExpense::Encryption::SHA256Context ctx;
+  TravelExpense::Encryption::sha256Init(&ctx);
+  uint64_t total = 0;
+
+  while (file) {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    std::streamsize got = file.gcount();
+
+    if (got <= 0) {
+      break;
+    }
+
+    TravelExpense::Encryption::sha256Update(&ctx, buffer.data(), static_cast<size_t>(got));
+    total += static_cast<uint64_t>(got);
+  }
 
-  if (!file.read(reinterpret_cast<char *>(buffer.data()), fileSize)) {
+  TravelExpense::Encryption::sha256Final(&ctx, digest);
+  return !file.bad() && total > 0;
+}
+
+bool calculateFileChecksum(const char *filePath, char *checksum) {
+  if (!filePath || !checksum) {
     return false;
   }
 
-  file.close();
-  // SHA-256 hash hesapla
-  return TravelExpense::Encryption::sha256Hash(buffer.data(), fileSize, checksum);
+  TravelExpense::Encryption::Digest256 digest;
+
+  if (!calculateFileDigest(filePath, digest)) {
+    return false;
+  }
+
+  TravelExpense::Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), checksum);
+  return true;
 }
 
 bool verifyFileChecksum(const char *filePath, const char *expectedChecksum) {
@@ -267,15 +298,21 @@ bool verifyFileChecksum(const char *filePath, const char *expectedChecksum) {
     return false;
   }
 
-  // Mevcut dosya checksum'unu hesapla
-  char currentChecksum[65];
+  // Mevcut dosya özetini hesapla
+  TravelExpense::Encryption::Digest256 current;
 
-  if (!calculateFileChecksum(filePath, currentChecksum)) {
+  if (!calculateFileDigest(filePath, current)) {
     return false;
   }
 
-  // Checksum'ları karşılaştır (case-insensitive)
-  return (strncasecmp(currentChecksum, expectedChecksum, 64) == 0);
+  // Beklenen değer hex'ten çözülür (büyük/küçük harf duyarsız)
+  TravelExpense::Encryption::Digest256 expected;
+
+  if (!TravelExpense::Encryption::decodeHex(expectedChecksum, expected.bytes, sizeof(expected.bytes))) {
+    return false;
+  }
+
+  return std::memcmp(current.bytes, expected.bytes, sizeof(current.bytes)) == 0;
 }
 
 bool calculateSelfChecksum(char *checksum) {
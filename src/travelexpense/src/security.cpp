@@ -8,8 +8,7 @@
 
 #include "../header/security.h"
 #include <cstring>
-#include <cstdlib>
-#include <ctime>
+#include <cstdint>
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
@@ -17,32 +16,31 @@
 #include <windows.h>
 #include <winbase.h>
 // SecureZeroMemory zaten Windows'ta tanımlı
-#else
-#include <string.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/** @brief Sabit zamanlı karşılaştırma için SSE2 yolu derlenir (x86-64'te her zaman mevcut) */
+#define TRAVELEXPENSE_SECURITY_SSE2
+#include <emmintrin.h>
+#endif
+
 /**
- * @brief Linux için güvenli bellek setleme fonksiyonu
+ * @brief Derleyici bariyeri
  *
- * Bu fonksiyon, bellek alanını güvenli şekilde doldurur.
- * Volatile pointer kullanarak compiler optimizer'ın bu işlemi
- * atlamasını engeller. Hassas verilerin güvenli şekilde
- * temizlenmesi için kullanılır.
+ * Verilen adresin gösterdiği belleğin "okunabileceğini" derleyiciye bildirir.
+ * Böylece memset() ile yapılan ve sonrasında okunmayan yazmalar ölü kod
+ * olarak silinemez (explicit_bzero / memset_s semantiği). Çalışma zamanı
+ * maliyeti yoktur; hiçbir komut üretmez.
  *
- * @param s Bellek alanının başlangıç adresi
- * @param c Doldurulacak değer (unsigned char olarak yorumlanır)
- * @param n Doldurulacak byte sayısı
- * @return Bellek alanının başlangıç adresi (ptr)
+ * @param ptr Korunacak bellek adresi
  */
-static void *secure_memset(void *s, int c, size_t n) {
-  volatile unsigned char *p = static_cast<volatile unsigned char *>(s);
-
-  while (n--) {
-    *p++ = static_cast<unsigned char>(c);
-  }
-
-  return s;
-}
-#define SecureZeroMemory(ptr, size) secure_memset(ptr, 0, size)
+static inline void compilerBarrier(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+  __asm__ __volatile__("" : : "r"(ptr) : "memory");
+#else
+  (void)ptr;
 #endif
+}
 
 namespace TravelExpense {
 
@@ -51,14 +49,16 @@ namespace Security {
 /**
  * @brief Bellek bölgesini güvenli şekilde doldur (memset güvenli versiyonu)
  *
- * Bu fonksiyon, bellek alanını belirtilen değerle doldurur. Volatile pointer
- * kullanarak compiler optimizer'ın bu işlemi atlamasını engeller. Bu sayede
- * hassas verilerin güvenli şekilde temizlenmesi sağlanır.
+ * Bu fonksiyon, bellek alanını belirtilen değerle doldurur. GCC/Clang'da
+ * platformun vektörize memset() fonksiyonu kullanılır ve ardından bir
+ * derleyici bariyeri konur; böylece optimizer silme işlemini atlayamaz ve
+ * büyük buffer'lar bellek bant genişliği hızında temizlenir. Diğer
+ * derleyicilerde volatile pointer ile byte byte yazmaya (Windows'ta sıfır
+ * için SecureZeroMemory) geri dönülür.
  *
  * @note Standart memset() fonksiyonundan farklı olarak, bu fonksiyon
- * optimizer'ın silme işlemini atlamasını engellemek için volatile pointer
- * kullanır. Bu, hassas verilerin (şifreler, anahtarlar vb.) güvenli
- * şekilde temizlenmesi için kritiktir.
+ * optimizer'ın silme işlemini atlamasını engeller. Bu, hassas verilerin
+ * (şifreler, anahtarlar vb.) güvenli şekilde temizlenmesi için kritiktir.
  *
  * @param ptr Bellek alanının başlangıç adresi (nullptr ise işlem yapılmaz)
  * @param value Doldurulacak değer (unsigned char olarak yorumlanır)
@@ -69,32 +69,49 @@ void secureMemset(void *ptr, int value, size_t size) {
     return;
   }
 
-  volatile unsigned char *p = static_cast<volatile unsigned char *>(ptr);
-  volatile unsigned char v = static_cast<volatile unsigned char>(value);
+#if defined(__GNUC__) || defined(__clang__)
+  std::memset(ptr, value, size);
+  compilerBarrier(ptr);
+#else
+#ifdef _WIN32
+
+  if (value == 0) {
+    SecureZeroMemory(ptr, size);
+    return;
+  }
+
+#endif
   // Volatile pointer kullanarak optimizer'ın atlamasını engelle
-  size_t i = 0;
+  volatile unsigned char *p = static_cast<volatile unsigned char *>(ptr);
+  const unsigned char v = static_cast<unsigned char>(value);
 
-  while (i < size) {
+  for (size_t i = 0; i < size; ++i) {
     p[i] = v;
-    ++i;
   }
+
+#endif
 }
 
 /**
- * @brief Bellekteki hassas verileri güvenli şekilde sil (çoklu geçişli temizleme)
+ * @brief Bellek bölgesini güvenli şekilde sıfırla
  *
- * Bu fonksiyon, bellek içeriğini üç geçişli bir algoritma ile güvenli şekilde siler:
- * 1. Geçiş: Bellek alanını sıfırlama (SecureZeroMemory veya secure_memset)
- * 2. Geçiş: Rastgele verilerle doldurma (veri kurtarmayı zorlaştırmak için)
- * 3. Geçiş: Tekrar sıfırlama ve volatile pointer ile kontrol
+ * @param ptr Bellek alanının başlangıç adresi (nullptr ise işlem yapılmaz)
+ * @param size Sıfırlanacak byte sayısı (0 ise işlem yapılmaz)
+ */
+void secureZero(void *ptr, size_t size) {
+  secureMemset(ptr, 0, size);
+}
+
+/**
+ * @brief Bellekteki hassas verileri güvenli şekilde sil
  *
- * Bu yöntem, hassas verilerin (şifreler, anahtarlar, token'lar vb.) güvenli
- * şekilde temizlenmesini sağlar. Çoklu geçişli silme, manyetik kalıntı (magnetic
- * remanence) tabanlı veri kurtarma saldırılarına karşı ek koruma sağlar.
+ * Bu fonksiyon, bellek içeriğini tek geçişte, optimizer tarafından
+ * atlanamayacak şekilde sıfırlar (bkz. secureMemset()).
  *
- * @note Bu fonksiyon, platform-specific güvenli bellek silme fonksiyonlarını
- * kullanır (Windows: SecureZeroMemory, Linux: secure_memset). Volatile pointer
- * kullanarak compiler optimizer'ın silme işlemini atlamasını engeller.
+ * @note Önceki sürümdeki üç geçişli silme (sıfır / rand() / sıfır) manyetik
+ * ortamlar için tasarlanmış bir yöntemdir; RAM için ek güvenlik sağlamaz,
+ * ancak byte başına rand() çağrısı nedeniyle megabaytlık buffer'larda
+ * saniyeler sürüyordu. Tek geçişli sıfırlama memset maliyetindedir.
  *
  * @param ptr Silinecek bellek alanının başlangıç adresi (nullptr ise false döner)
  * @param size Silinecek bellek alanının boyutu (byte, 0 ise false döner)
@@ -105,43 +122,80 @@ bool secureMemoryCleanup(void *ptr, size_t size) {
     return false;
   }
 
-  // Çoklu geçişli silme (3 geçiş)
-  // Geçiş 1: Sıfırlama
-#ifdef _WIN32
-  SecureZeroMemory(ptr, size);
-#else
-  secure_memset(ptr, 0, size);
-#endif
-  // Geçiş 2: Rastgele veri ile doldurma
-  srand(static_cast<unsigned int>(time(nullptr)));
-  unsigned char *p = static_cast<unsigned char *>(ptr);
+  secureMemset(ptr, 0, size);
+  return true;
+}
 
-  for (size_t i = 0; i < size; ++i) {
-    p[i] = static_cast<unsigned char>(rand() % 256);
+/**
+ * @brief Sabit zamanlı bellek karşılaştırma
+ *
+ * Farkları erken çıkış yapmadan bir akümülatörde OR'lar; çalışma süresi
+ * yalnızca uzunluğa bağlıdır. x86'da döngü başına 64 byte SSE2 ile işlenir,
+ * kalan kısım 8 byte'lık kelimeler ve son olarak tek byte'larla tamamlanır.
+ * Akümülatör, derleyicinin veri bağımlı dallanma üretmemesi için bariyerden
+ * geçirilir.
+ *
+ * @param a İlk bellek alanı
+ * @param b İkinci bellek alanı
+ * @param size Karşılaştırılacak byte sayısı
+ * @return true Eşit, false Farklı veya hata (null pointer, sıfır uzunluk)
+ */
+bool constantTimeEquals(const void *a, const void *b, size_t size) {
+  if (!a || !b || size == 0) {
+    return false;
   }
 
-  // Geçiş 3: Tekrar sıfırlama
-#ifdef _WIN32
-  SecureZeroMemory(ptr, size);
-#else
-  secure_memset(ptr, 0, size);
+  const unsigned char *pa = static_cast<const unsigned char *>(a);
+  const unsigned char *pb = static_cast<const unsigned char *>(b);
+  size_t offset = 0;
+  uint64_t diff = 0;
+#ifdef TRAVELEXPENSE_SECURITY_SSE2
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+
+  for (; offset + 64 <= size; offset += 64) {
+    const __m128i *va = reinterpret_cast<const __m128i *>(pa + offset);
+    const __m128i *vb = reinterpret_cast<const __m128i *>(pb + offset);
+    acc0 = _mm_or_si128(acc0, _mm_xor_si128(_mm_loadu_si128(va), _mm_loadu_si128(vb)));
+    acc1 = _mm_or_si128(acc1, _mm_xor_si128(_mm_loadu_si128(va + 1), _mm_loadu_si128(vb + 1)));
+    acc0 = _mm_or_si128(acc0, _mm_xor_si128(_mm_loadu_si128(va + 2), _mm_loadu_si128(vb + 2)));
+    acc1 = _mm_or_si128(acc1, _mm_xor_si128(_mm_loadu_si128(va + 3), _mm_loadu_si128(vb + 3)));
+  }
+
+  for (; offset + 16 <= size; offset += 16) {
+    acc0 = _mm_or_si128(acc0, _mm_xor_si128(
+                          _mm_loadu_si128(reinterpret_cast<const __m128i *>(pa + offset)),
+                          _mm_loadu_si128(reinterpret_cast<const __m128i *>(pb + offset))));
+  }
+
+  uint64_t lanes[2];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), _mm_or_si128(acc0, acc1));
+  diff = lanes[0] | lanes[1];
 #endif
-  // Bellek alanını volatile pointer ile tekrar kontrol et
-  volatile unsigned char *vp = static_cast<volatile unsigned char *>(ptr);
 
-  for (size_t i = 0; i < size; ++i) {
-    vp[i] = 0;
+  for (; offset + 8 <= size; offset += 8) {
+    uint64_t wa, wb;
+    std::memcpy(&wa, pa + offset, 8);
+    std::memcpy(&wb, pb + offset, 8);
+    diff |= wa ^ wb;
   }
 
-  return true;
+  for (; offset < size; ++offset) {
+    diff |= static_cast<uint64_t>(pa[offset] ^ pb[offset]);
+  }
+
+#if defined(__GNUC__) || defined(__clang__)
+  __asm__ __volatile__("" : "+r"(diff));
+#endif
+  return diff == 0;
 }
 
 /**
  * @brief Buffer içeriğini güvenli şekilde temizle (char array için overload)
  *
  * Bu fonksiyon, char buffer içeriğini güvenli şekilde temizler.
- * `secureMemoryCleanup()` fonksiyonunu çağırarak çoklu geçişli
- * temizleme algoritmasını kullanır.
+ * `secureMemoryCleanup()` fonksiyonunu çağırarak buffer'ı optimizer
+ * tarafından atlanamayacak şekilde sıfırlar.
  *
  * @note Bu fonksiyon, özellikle string buffer'ları (şifreler, token'lar vb.)
  * temizlemek için kullanılır. Null pointer veya sıfır uzunluk kontrolü yapılır.
@@ -10,12 +10,18 @@
 
 #include "../header/sessionManager.h"
 #include "../header/encryption.h"
+#include "../header/fingerprinting.h"
 #include "../header/security.h"
 #include "../header/safe_string.h"
+#include <algorithm>
 #include <cstring>
 #include <ctime>
 #include <sstream>
-#include <iomanip>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #ifdef _WIN32
   #define WIN32_LEAN_AND_MEAN
@@ -28,12 +34,39 @@
   #include <sys/ioctl.h>
   #include <net/if.h>
   #include <ifaddrs.h>
+  #include <netpacket/packet.h>
 #endif
 
 namespace TravelExpense {
 
 namespace SessionManager {
 
+/**
+ * @brief Şifreleme girdisi ile IV + şifreli metin çıktısının çakışıp çakışmadığını kontrol et
+ *
+ * Desteklenen tek yerinde (in-place) düzen, düz metnin çıktının 16. byte'ından
+ * başlamasıdır (plaintext == ciphertext + 16); CBC blokları aynı konuma yazılır
+ * ve IV şifrelemeden sonra baştaki 16 byte'a kopyalanır. Diğer tüm çakışmalar
+ * okunmamış düz metnin üzerine yazılmasına yol açar ve reddedilir.
+ *
+ * @param plaintext Düz metin
+ * @param plaintextLen Düz metin uzunluğu
+ * @param out IV + şifreli metin çıktısı
+ * @return true Desteklenmeyen çakışma var
+ */
+static bool cbcPayloadBuffersOverlap(const void *plaintext, size_t plaintextLen,
+                                     const uint8_t *out) {
+  uintptr_t plainBegin = reinterpret_cast<uintptr_t>(plaintext);
+  uintptr_t outBegin = reinterpret_cast<uintptr_t>(out);
+
+  if (plainBegin == outBegin + 16) {
+    return false;
+  }
+
+  size_t outLen = 16 + (plaintextLen / 16 + 1) * 16;
+  return plainBegin < outBegin + outLen && outBegin < plainBegin + plaintextLen;
+}
+
 // ============================================
 // OTURUM ANAHTARI YÖNETİMİ
 // ============================================
@@ -65,7 +98,10 @@ ErrorCode encryptSessionKey(const uint8_t *plainSessionKey,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
     0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
   };
-  // IV oluştur
+  if (cbcPayloadBuffersOverlap(plainSessionKey, 32, encryptedSessionKey)) {
+    return ErrorCode::InvalidInput;
+  }
+
   uint8_t iv[16];
 
   if (!Encryption::generateIV(iv)) {
@@ -74,22 +110,16 @@ ErrorCode encryptSessionKey(const uint8_t *plainSessionKey,
 
   // Oturum anahtarını AES-256-CBC ile şifrele
   // 32 byte session key + PKCS7 padding (16 byte) = 48 byte ciphertext
-  size_t ciphertextLen = 64; // 32 byte session key + 16 byte padding + buffer
-  uint8_t *ciphertext = new uint8_t[ciphertextLen];
-  size_t encryptedSize = ciphertextLen;
+  size_t encryptedSize = 0;
 
   if (!Encryption::encryptAES256(plainSessionKey, 32, MASTER_KEY, iv,
-                                 ciphertext, encryptedSize)) {
-    delete[] ciphertext;
+                                 encryptedSessionKey + 16, encryptedSize)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  // IV'yi öne ekle (IV + şifrelenmiş anahtar)
-  // encryptedSize artık 48 byte olmalı (32 + 16 padding)
+  // IV şifrelemeden sonra çıktının başına yazılır
   std::memcpy(encryptedSessionKey, iv, 16);
-  std::memcpy(encryptedSessionKey + 16, ciphertext, encryptedSize);
   encryptedLen = 16 + encryptedSize; // IV (16) + ciphertext (48) = 64
-  delete[] ciphertext;
   return ErrorCode::Success;
 }
 
@@ -111,26 +141,259 @@ ErrorCode decryptSessionKey(const uint8_t *encryptedSessionKey,
   // IV'yi çıkar
   uint8_t iv[16];
   std::memcpy(iv, encryptedSessionKey, 16);
-  // Şifrelenmiş anahtarı çöz (48 byte ciphertext)
-  size_t plaintextLen = 32;
+  // Şifrelenmiş anahtarı çöz (48 byte ciphertext). Padding bloğu da
+  // çözüldüğünden çıktı 32 byte'lık anahtar buffer'ına doğrudan yazılmaz.
+  uint8_t decrypted[48];
+  size_t plaintextLen = 0;
 
   if (!Encryption::decryptAES256(encryptedSessionKey + 16, 48, MASTER_KEY, iv,
-                                 plainSessionKey, plaintextLen)) {
+                                 decrypted, plaintextLen) || plaintextLen != 32) {
+    Security::secureMemset(decrypted, 0, sizeof(decrypted));
     return ErrorCode::DecryptionFailed;
   }
 
+  std::memcpy(plainSessionKey, decrypted, 32);
+  Security::secureMemset(decrypted, 0, sizeof(decrypted));
   return ErrorCode::Success;
 }
 
 // ============================================
-// CİHAZ BAĞLANTISI VE SÜRÜM KONTROLÜ
+// OTURUM ANAHTARI TUTAMAÇLARI
 // ============================================
 
-ErrorCode getDeviceFingerprint(char *fingerprint) {
-  if (!fingerprint) {
+/** @brief Varsayılan oturum anahtarı önbelleği kapasitesi */
+static const size_t SESSION_KEY_CACHE_DEFAULT_CAPACITY = 64;
+
+/**
+ * @struct SessionKeyHandle
+ * @brief Oturum anahtarından türetilmiş, mesaj başına yeniden kullanılan durum
+ *
+ * AES anahtar takvimi ve HMAC ara durumları bir kez hazırlanır; ham anahtar
+ * saklanmaz. Referans sayılıdır: önbellek ve her çağıran birer referans
+ * tutar, son referans bırakılınca içerik güvenli şekilde silinir.
+ */
+struct SessionKeyHandle {
+  Encryption::AES256Context aes;        /**< @brief Genişletilmiş AES-256 anahtar takvimi */
+  Encryption::HMACSHA256Midstate hmac;  /**< @brief HMAC-SHA256 ara durumları */
+  std::atomic<int> references;          /**< @brief Referans sayısı */
+
+  SessionKeyHandle() : references(1) {}
+
+  ~SessionKeyHandle() {
+    Encryption::clearAES256Context(&aes);
+    Security::secureMemset(&hmac, 0, sizeof(hmac));
+  }
+
+ private:
+  SessionKeyHandle(const SessionKeyHandle &);
+  SessionKeyHandle &operator=(const SessionKeyHandle &);
+};
+
+/**
+ * @struct SessionKeyCacheEntry
+ * @brief Önbellekteki aktif oturum
+ *
+ * id, şifrelenmiş oturum anahtarının SHA-256 özetidir; anahtar materyali
+ * önbellek indeksinde tutulmaz.
+ */
+struct SessionKeyCacheEntry {
+  std::string id;             /**< @brief SHA-256(şifrelenmiş anahtar), 32 byte */
+  SessionKeyHandle *handle;   /**< @brief Önbelleğin referansı */
+};
+
+/**
+ * @brief Aktif oturumların sınırlı LRU önbelleği
+ */
+struct SessionKeyCache {
+  typedef std::list<SessionKeyCacheEntry>::iterator EntryIterator;
+
+  std::mutex mutex;                                      /**< @brief Önbellek kilidi */
+  size_t capacity;                                       /**< @brief Kayıt üst sınırı (0 = kapalı) */
+  std::list<SessionKeyCacheEntry> entries;               /**< @brief Kayıtlar (en son kullanılan başta) */
+  std::unordered_map<std::string, EntryIterator> index;  /**< @brief id indeksi */
+  uint64_t hits;                                         /**< @brief Önbellekten dönen istek */
+  uint64_t misses;                                       /**< @brief Anahtar çözülen istek */
+  uint64_t evictions;                                    /**< @brief Kapasite nedeniyle atılan kayıt */
+
+  SessionKeyCache()
+    : capacity(SESSION_KEY_CACHE_DEFAULT_CAPACITY), hits(0), misses(0), evictions(0) {}
+
+  ~SessionKeyCache() {
+    clearSessionKeyCache();
+  }
+};
+
+static SessionKeyCache g_sessionKeyCache;
+
+/** @brief Önbellek kaydını çıkar ve referansını bırak (kilit tutulmalı) */
+static void eraseSessionKeyEntryLocked(SessionKeyCache::EntryIterator it) {
+  SessionKeyHandle *handle = it->handle;
+  g_sessionKeyCache.index.erase(it->id);
+  g_sessionKeyCache.entries.erase(it);
+  releaseSessionKeyHandle(handle);
+}
+
+ErrorCode createSessionKeyHandle(const uint8_t *sessionKey, SessionKeyHandle **handle) {
+  if (handle) {
+    *handle = nullptr;
+  }
+
+  if (!sessionKey || !handle) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionKeyHandle *created = new SessionKeyHandle();
+
+  if (!Encryption::initAES256Context(&created->aes, sessionKey)) {
+    delete created;
+    return ErrorCode::EncryptionFailed;
+  }
+
+  Encryption::hmacSHA256Prepare(sessionKey, 32, created->hmac);
+  *handle = created;
+  return ErrorCode::Success;
+}
+
+ErrorCode acquireSessionKeyHandle(const uint8_t *encryptedSessionKey, size_t encryptedLen,
+                                  SessionKeyHandle **handle) {
+  if (handle) {
+    *handle = nullptr;
+  }
+
+  if (!encryptedSessionKey || encryptedLen != 64 || !handle) {
+    return ErrorCode::InvalidInput;
+  }
+
+  Encryption::Digest256 digest;
+  Encryption::sha256Digest(encryptedSessionKey, encryptedLen, digest);
+  std::string id(reinterpret_cast<const char *>(digest.bytes), sizeof(digest.bytes));
+  {
+    std::lock_guard<std::mutex> lock(g_sessionKeyCache.mutex);
+    std::unordered_map<std::string, SessionKeyCache::EntryIterator>::iterator found = g_sessionKeyCache.index.find(id);
+
+    if (found != g_sessionKeyCache.index.end()) {
+      g_sessionKeyCache.entries.splice(g_sessionKeyCache.entries.begin(), g_sessionKeyCache.entries, found->second);
+      found->second->handle->references.fetch_add(1);
+      *handle = found->second->handle;
+      ++g_sessionKeyCache.hits;
+      return ErrorCode::Success;
+    }
+  }
+  // Master key ile çöz ve tutamacı kilit dışında hazırla
+  uint8_t sessionKey[32];
+  ErrorCode result = decryptSessionKey(encryptedSessionKey, encryptedLen, sessionKey);
+  SessionKeyHandle *created = nullptr;
+
+  if (result == ErrorCode::Success) {
+    result = createSessionKeyHandle(sessionKey, &created);
+  }
+
+  Security::secureMemset(sessionKey, 0, sizeof(sessionKey));
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  std::lock_guard<std::mutex> lock(g_sessionKeyCache.mutex);
+  ++g_sessionKeyCache.misses;
+
+  if (g_sessionKeyCache.capacity == 0) {
+    *handle = created;
+    return ErrorCode::Success;
+  }
+
+  std::unordered_map<std::string, SessionKeyCache::EntryIterator>::iterator found = g_sessionKeyCache.index.find(id);
+
+  if (found != g_sessionKeyCache.index.end()) {
+    // Başka bir thread aynı oturumu bu arada ekledi
+    releaseSessionKeyHandle(created);
+    found->second->handle->references.fetch_add(1);
+    *handle = found->second->handle;
+    return ErrorCode::Success;
+  }
+
+  created->references.fetch_add(1); // Önbelleğin referansı
+  SessionKeyCacheEntry entry;
+  entry.id = id;
+  entry.handle = created;
+  g_sessionKeyCache.entries.push_front(entry);
+  g_sessionKeyCache.index[id] = g_sessionKeyCache.entries.begin();
+
+  while (g_sessionKeyCache.entries.size() > g_sessionKeyCache.capacity) {
+    eraseSessionKeyEntryLocked(--g_sessionKeyCache.entries.end());
+    ++g_sessionKeyCache.evictions;
+  }
+
+  *handle = created;
+  return ErrorCode::Success;
+}
+
+void releaseSessionKeyHandle(SessionKeyHandle *handle) {
+  if (handle && handle->references.fetch_sub(1) == 1) {
+    delete handle;
+  }
+}
+
+void configureSessionKeyCache(size_t capacity) {
+  std::lock_guard<std::mutex> lock(g_sessionKeyCache.mutex);
+  g_sessionKeyCache.capacity = capacity;
+
+  while (g_sessionKeyCache.entries.size() > capacity) {
+    eraseSessionKeyEntryLocked(--g_sessionKeyCache.entries.end());
+    ++g_sessionKeyCache.evictions;
+  }
+}
+
+void clearSessionKeyCache() {
+  std::lock_guard<std::mutex> lock(g_sessionKeyCache.mutex);
+
+  while (!g_sessionKeyCache.entries.empty()) {
+    eraseSessionKeyEntryLocked(g_sessionKeyCache.entries.begin());
+  }
+
+  Encryption::clearAES256KeyCache();
+}
+
+void getSessionKeyCacheStats(SessionKeyCacheStats &stats) {
+  std::lock_guard<std::mutex> lock(g_sessionKeyCache.mutex);
+  stats.entries = g_sessionKeyCache.entries.size();
+  stats.capacity = g_sessionKeyCache.capacity;
+  stats.hits = g_sessionKeyCache.hits;
+  stats.misses = g_sessionKeyCache.misses;
+  stats.evictions = g_sessionKeyCache.evictions;
+}
+
+// ============================================
+// CİHAZ BAĞLANTISI VE SÜRÜM KONTROLÜ
+// ============================================
+
+/**
+ * @struct DeviceFingerprintMemo
+ * @brief Oturum cihaz fingerprint'inin süreç genelindeki kopyası
+ *
+ * Fingerprinting önbelleğinin generation değeri değiştiğinde (yenileme
+ * veya ağ arayüzü değişikliği) yeniden hesaplanır.
+ */
+struct DeviceFingerprintMemo {
+  std::mutex mutex;       /**< @brief Kopya kilidi */
+  bool valid;             /**< @brief Hesaplandı mı */
+  uint64_t generation;    /**< @brief Hesaplandığı andaki generation */
+  char fingerprint[65];   /**< @brief Fingerprint (64 karakter hex) */
+
+  DeviceFingerprintMemo() : valid(false), generation(0) {
+    std::memset(fingerprint, 0, sizeof(fingerprint));
+  }
+};
+
+static DeviceFingerprintMemo g_deviceFingerprint;
+
+/**
+ * @brief MAC adresinden cihaz fingerprint'ini hesapla (önbelleksiz)
+ *
+ * @param fingerprint Çıktı (64 karakter hex + null)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode computeDeviceFingerprint(char *fingerprint) {
   std::ostringstream oss;
 #ifdef _WIN32
   // Windows: MAC adresi kullan
@@ -143,10 +406,9 @@ ErrorCode getDeviceFingerprint(char *fingerprint) {
 
     if (pAdapterInfo) {
       // İlk MAC adresini kullan
-      for (int i = 0; i < pAdapterInfo->AddressLength; ++i) {
-        oss << std::hex << std::setw(2) << std::setfill('0')
-            << static_cast<int>(pAdapterInfo->Address[i]);
-      }
+      char macHex[2 * MAX_ADAPTER_ADDRESS_LENGTH + 1];
+      Encryption::encodeHex(pAdapterInfo->Address, pAdapterInfo->AddressLength, macHex);
+      oss << macHex;
     }
   }
 
@@ -159,10 +421,9 @@ ErrorCode getDeviceFingerprint(char *fingerprint) {
       if (ifa->ifa_addr && ifa->ifa_addr->sa_family == AF_PACKET) {
         struct sockaddr_ll *s = reinterpret_cast<struct sockaddr_ll *>(ifa->ifa_addr);
 
-        for (int i = 0; i < 6; ++i) {
-          oss << std::hex << std::setw(2) << std::setfill('0')
-              << static_cast<int>(s->sll_addr[i]);
-        }
+        char macHex[13];
+        Encryption::encodeHex(s->sll_addr, 6, macHex);
+        oss << macHex;
 
         break; // İlk MAC adresini kullan
       }
@@ -185,13 +446,37 @@ ErrorCode getDeviceFingerprint(char *fingerprint) {
   }
 
   // SHA-256 hash ile fingerprint oluştur
-  char hash[65];
+  Encryption::Digest256 digest;
 
-  if (!Encryption::sha256Hash(fp.c_str(), fp.length(), hash)) {
+  if (!Encryption::sha256Digest(fp.c_str(), fp.length(), digest)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  SafeString::safeCopy(fingerprint, 65, hash);
+  Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), fingerprint);
+  return ErrorCode::Success;
+}
+
+ErrorCode getDeviceFingerprint(char *fingerprint) {
+  if (!fingerprint) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint64_t generation = Fingerprinting::getFingerprintGeneration();
+  std::lock_guard<std::mutex> lock(g_deviceFingerprint.mutex);
+
+  if (!g_deviceFingerprint.valid || g_deviceFingerprint.generation != generation) {
+    ErrorCode result = computeDeviceFingerprint(g_deviceFingerprint.fingerprint);
+
+    if (result != ErrorCode::Success) {
+      g_deviceFingerprint.valid = false;
+      return result;
+    }
+
+    g_deviceFingerprint.generation = generation;
+    g_deviceFingerprint.valid = true;
+  }
+
+  std::memcpy(fingerprint, g_deviceFingerprint.fingerprint, sizeof(g_deviceFingerprint.fingerprint));
   return ErrorCode::Success;
 }
 
@@ -250,29 +535,30 @@ ErrorCode encryptPayload(const void *plaintext, size_t plaintextLen,
     return ErrorCode::InvalidInput;
   }
 
-  // IV oluştur
+  // Şifreli metin doğrudan çıktıya, IV'nin arkasına üretilir
+  uint8_t *out = static_cast<uint8_t *>(ciphertext);
+
+  if (cbcPayloadBuffersOverlap(plaintext, plaintextLen, out)) {
+    return ErrorCode::InvalidInput;
+  }
+
   uint8_t iv[16];
 
   if (!Encryption::generateIV(iv)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  // AES-256-CBC ile şifrele
-  size_t encryptedSize = ((plaintextLen + 15) / 16) * 16 + 16; // Padding + IV
-  uint8_t *tempCiphertext = new uint8_t[encryptedSize];
-  size_t actualSize = encryptedSize;
+  // AES-256-CBC ile şifrele (geçici buffer ve kopya yok)
+  size_t actualSize = 0;
 
   if (!Encryption::encryptAES256(plaintext, plaintextLen, sessionKey, iv,
-                                 tempCiphertext, actualSize)) {
-    delete[] tempCiphertext;
+                                 out + 16, actualSize)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  // IV'yi öne ekle
-  std::memcpy(ciphertext, iv, 16);
-  std::memcpy(static_cast<uint8_t *>(ciphertext) + 16, tempCiphertext, actualSize);
+  // IV şifrelemeden sonra yazılır; in-place düzende düz metin korunur
+  std::memcpy(out, iv, 16);
   ciphertextLen = 16 + actualSize;
-  delete[] tempCiphertext;
   return ErrorCode::Success;
 }
 
@@ -298,10 +584,310 @@ ErrorCode decryptPayload(const void *ciphertext, size_t ciphertextLen,
   return ErrorCode::Success;
 }
 
+ErrorCode encryptPayload(const void *plaintext, size_t plaintextLen,
+                         const SessionKeyHandle &sessionKey,
+                         void *ciphertext, size_t &ciphertextLen) {
+  if (!plaintext || plaintextLen == 0 || !ciphertext) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint8_t *out = static_cast<uint8_t *>(ciphertext);
+
+  if (cbcPayloadBuffersOverlap(plaintext, plaintextLen, out)) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint8_t iv[16];
+
+  if (!Encryption::generateIV(iv)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  size_t actualSize = 0;
+
+  if (!Encryption::aes256EncryptCBCPadded(&sessionKey.aes, iv, plaintext, plaintextLen,
+                                          out + 16, actualSize)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  std::memcpy(out, iv, 16);
+  ciphertextLen = 16 + actualSize;
+  return ErrorCode::Success;
+}
+
+ErrorCode decryptPayload(const void *ciphertext, size_t ciphertextLen,
+                         const SessionKeyHandle &sessionKey,
+                         void *plaintext, size_t &plaintextLen) {
+  if (!ciphertext || ciphertextLen < 16 || !plaintext) {
+    return ErrorCode::InvalidInput;
+  }
+
+  const uint8_t *in = static_cast<const uint8_t *>(ciphertext);
+
+  if (!Encryption::aes256DecryptCBCPadded(&sessionKey.aes, in, in + 16, ciphertextLen - 16,
+                                          plaintext, plaintextLen)) {
+    return ErrorCode::DecryptionFailed;
+  }
+
+  return ErrorCode::Success;
+}
+
+// ============================================
+// MÜHÜRLÜ VERİ (SEALED PAYLOAD)
+// ============================================
+
+/**
+ * @brief Mühürlü veri başlığını yaz
+ *
+ * Başlık: [sürüm (1)][ayrılmış (3) = 0][nonce (12)][uzunluk (4, big-endian)].
+ * Nonce rastgele üretilir.
+ *
+ * @param header Çıktı (SEALED_PAYLOAD_HEADER_SIZE byte)
+ * @param plaintextLen Şifrelenecek veri uzunluğu
+ * @return bool Nonce üretildi mi
+ */
+static bool writeSealedHeader(uint8_t *header, size_t plaintextLen) {
+  header[0] = SEALED_PAYLOAD_VERSION;
+  header[1] = 0;
+  header[2] = 0;
+  header[3] = 0;
+
+  if (!Encryption::generateRandomBytes(header + 4, Encryption::AES_GCM_IV_SIZE)) {
+    return false;
+  }
+
+  uint8_t *length = header + 4 + Encryption::AES_GCM_IV_SIZE;
+  length[0] = static_cast<uint8_t>(plaintextLen >> 24);
+  length[1] = static_cast<uint8_t>(plaintextLen >> 16);
+  length[2] = static_cast<uint8_t>(plaintextLen >> 8);
+  length[3] = static_cast<uint8_t>(plaintextLen);
+  return true;
+}
+
+/**
+ * @brief Mühürlü veri başlığını doğrula
+ *
+ * @param sealed Mühürlü veri
+ * @param sealedLen Mühürlü veri uzunluğu
+ * @param dataLen Şifreli veri uzunluğu (çıktı)
+ * @return bool Başlık biçimi ve uzunluk alanı geçerli mi
+ */
+static bool parseSealedHeader(const uint8_t *sealed, size_t sealedLen, size_t &dataLen) {
+  if (sealedLen <= SEALED_PAYLOAD_OVERHEAD || sealed[0] != SEALED_PAYLOAD_VERSION ||
+      sealed[1] != 0 || sealed[2] != 0 || sealed[3] != 0) {
+    return false;
+  }
+
+  const uint8_t *length = sealed + 4 + Encryption::AES_GCM_IV_SIZE;
+  size_t declared = (static_cast<size_t>(length[0]) << 24) | (static_cast<size_t>(length[1]) << 16) |
+                    (static_cast<size_t>(length[2]) << 8) | static_cast<size_t>(length[3]);
+
+  if (declared != sealedLen - SEALED_PAYLOAD_OVERHEAD) {
+    return false;
+  }
+
+  dataLen = declared;
+  return true;
+}
+
+/**
+ * @brief Mühürlenecek veri uzunluğunu ve çıktı kapasitesini doğrula
+ *
+ * @param payloadLen Düz metin uzunluğu
+ * @param sealedCapacity Çıktı buffer'ı boyutu
+ * @return bool Uzunluk 1..2^32-1 aralığında ve çıktı yeterli mi
+ */
+static bool validSealLength(size_t payloadLen, size_t sealedCapacity) {
+  return payloadLen > 0 && payloadLen <= 0xFFFFFFFFu && sealedCapacity >= SEALED_PAYLOAD_OVERHEAD &&
+         sealedCapacity - SEALED_PAYLOAD_OVERHEAD >= payloadLen;
+}
+
+/**
+ * @brief sealPayload girdilerini doğrula
+ */
+static bool validSealInput(const void *plaintext, size_t plaintextLen,
+                           const void *sealed, size_t sealedCapacity) {
+  return plaintext && sealed && validSealLength(plaintextLen, sealedCapacity);
+}
+
+/**
+ * @brief Alan dizisini doğrula ve toplam uzunluğu hesapla
+ *
+ * Encryption::sumIOVec ile aynı kurallar: uzunluğu olan alanın base'i
+ * boş olamaz ve toplam taşmamalıdır.
+ *
+ * @param fields Alanlar
+ * @param fieldCount Alan sayısı
+ * @param total Toplam uzunluk (çıktı)
+ * @return bool Alan dizisi geçerli mi
+ */
+static bool sumPayloadFields(const Encryption::IOVec *fields, size_t fieldCount, size_t &total) {
+  total = 0;
+
+  for (size_t i = 0; i < fieldCount; ++i) {
+    if ((fields[i].length > 0 && !fields[i].base) || total + fields[i].length < total) {
+      return false;
+    }
+
+    total += fields[i].length;
+  }
+
+  return true;
+}
+
+size_t sealedPayloadSize(size_t plaintextLen) {
+  return plaintextLen + SEALED_PAYLOAD_OVERHEAD;
+}
+
+ErrorCode sealPayload(const void *plaintext, size_t plaintextLen,
+                      const uint8_t *sessionKey,
+                      void *sealed, size_t sealedCapacity, size_t &sealedLen) {
+  if (!sessionKey || !validSealInput(plaintext, plaintextLen, sealed, sealedCapacity)) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint8_t *out = static_cast<uint8_t *>(sealed);
+
+  if (!writeSealedHeader(out, plaintextLen)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  // Başlığın tamamı ek doğrulanan veri olarak etikete bağlanır
+  if (!Encryption::encryptAES256GCM(plaintext, plaintextLen, sessionKey, out + 4, out,
+                                    SEALED_PAYLOAD_HEADER_SIZE, out + SEALED_PAYLOAD_HEADER_SIZE,
+                                    out + SEALED_PAYLOAD_HEADER_SIZE + plaintextLen)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  sealedLen = plaintextLen + SEALED_PAYLOAD_OVERHEAD;
+  return ErrorCode::Success;
+}
+
+ErrorCode sealPayload(const void *plaintext, size_t plaintextLen,
+                      const SessionKeyHandle &sessionKey,
+                      void *sealed, size_t sealedCapacity, size_t &sealedLen) {
+  if (!validSealInput(plaintext, plaintextLen, sealed, sealedCapacity)) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint8_t *out = static_cast<uint8_t *>(sealed);
+
+  if (!writeSealedHeader(out, plaintextLen)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  if (!Encryption::aes256EncryptGCM(&sessionKey.aes, out + 4, out, SEALED_PAYLOAD_HEADER_SIZE,
+                                    plaintext, plaintextLen, out + SEALED_PAYLOAD_HEADER_SIZE,
+                                    out + SEALED_PAYLOAD_HEADER_SIZE + plaintextLen)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  sealedLen = plaintextLen + SEALED_PAYLOAD_OVERHEAD;
+  return ErrorCode::Success;
+}
+
+ErrorCode sealPayloadGather(const Encryption::IOVec *fields, size_t fieldCount,
+                            const uint8_t *sessionKey,
+                            void *sealed, size_t sealedCapacity, size_t &sealedLen) {
+  size_t payloadLen = 0;
+
+  // Başlık yazılmadan önce alanların tamamı doğrulanır
+  if (!fields || fieldCount == 0 || !sessionKey || !sealed ||
+      !sumPayloadFields(fields, fieldCount, payloadLen) || !validSealLength(payloadLen, sealedCapacity)) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint8_t *out = static_cast<uint8_t *>(sealed);
+
+  if (!writeSealedHeader(out, payloadLen)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  if (!Encryption::encryptAES256GCMGather(fields, fieldCount, sessionKey, out + 4, out,
+                                          SEALED_PAYLOAD_HEADER_SIZE, out + SEALED_PAYLOAD_HEADER_SIZE,
+                                          out + SEALED_PAYLOAD_HEADER_SIZE + payloadLen)) {
+    return ErrorCode::EncryptionFailed;
+  }
+
+  sealedLen = payloadLen + SEALED_PAYLOAD_OVERHEAD;
+  return ErrorCode::Success;
+}
+
+ErrorCode openPayload(const void *sealed, size_t sealedLen,
+                      const uint8_t *sessionKey,
+                      void *plaintext, size_t plaintextCapacity, size_t &plaintextLen) {
+  size_t dataLen = 0;
+
+  if (!sealed || !sessionKey || !plaintext ||
+      !parseSealedHeader(static_cast<const uint8_t *>(sealed), sealedLen, dataLen) ||
+      plaintextCapacity < dataLen) {
+    return ErrorCode::InvalidInput;
+  }
+
+  const uint8_t *in = static_cast<const uint8_t *>(sealed);
+
+  if (!Encryption::decryptAES256GCM(in + SEALED_PAYLOAD_HEADER_SIZE, dataLen, sessionKey, in + 4,
+                                    in, SEALED_PAYLOAD_HEADER_SIZE,
+                                    in + SEALED_PAYLOAD_HEADER_SIZE + dataLen, plaintext)) {
+    return ErrorCode::ChecksumMismatch;
+  }
+
+  plaintextLen = dataLen;
+  return ErrorCode::Success;
+}
+
+ErrorCode openPayload(const void *sealed, size_t sealedLen,
+                      const SessionKeyHandle &sessionKey,
+                      void *plaintext, size_t plaintextCapacity, size_t &plaintextLen) {
+  size_t dataLen = 0;
+
+  if (!sealed || !plaintext ||
+      !parseSealedHeader(static_cast<const uint8_t *>(sealed), sealedLen, dataLen) ||
+      plaintextCapacity < dataLen) {
+    return ErrorCode::InvalidInput;
+  }
+
+  const uint8_t *in = static_cast<const uint8_t *>(sealed);
+
+  if (!Encryption::aes256DecryptGCM(&sessionKey.aes, in + 4, in, SEALED_PAYLOAD_HEADER_SIZE,
+                                    in + SEALED_PAYLOAD_HEADER_SIZE, dataLen,
+                                    in + SEALED_PAYLOAD_HEADER_SIZE + dataLen, plaintext)) {
+    return ErrorCode::ChecksumMismatch;
+  }
+
+  plaintextLen = dataLen;
+  return ErrorCode::Success;
+}
+
 // ============================================
 // BÜTÜNLÜK KONTROLÜ VE KİMLİK DOĞRULAMA
 // ============================================
 
+/**
+ * @brief Hesaplanan HMAC'i beklenen hex değerle sabit zamanda karşılaştır
+ *
+ * @param calculated Hesaplanan HMAC
+ * @param expectedHMAC Beklenen değer (64 karakter hex)
+ * @return ErrorCode Success veya ChecksumMismatch
+ */
+static ErrorCode compareHMAC(const Encryption::Digest256 &calculated, const char *expectedHMAC) {
+  // Beklenen değer yalnızca API sınırında hex'ten çözülür
+  Encryption::Digest256 expected;
+
+  if (!Encryption::decodeHex(expectedHMAC, expected.bytes, sizeof(expected.bytes))) {
+    return ErrorCode::ChecksumMismatch;
+  }
+
+  // Constant-time karşılaştırma
+  if (!Encryption::constantTimeCompare(reinterpret_cast<const char *>(calculated.bytes),
+                                       reinterpret_cast<const char *>(expected.bytes),
+                                       sizeof(calculated.bytes))) {
+    return ErrorCode::ChecksumMismatch;
+  }
+
+  return ErrorCode::Success;
+}
+
 ErrorCode calculateHMAC(const void *data, size_t dataLen,
                         const uint8_t *sessionKey,
                         char *hmac) {
@@ -324,56 +910,142 @@ ErrorCode verifyHMAC(const void *data, size_t dataLen,
     return ErrorCode::InvalidInput;
   }
 
-  // HMAC hesapla
-  char calculatedHMAC[65];
+  // HMAC hesapla (ikili)
+  Encryption::Digest256 calculated;
 
-  if (calculateHMAC(data, dataLen, sessionKey, calculatedHMAC) != ErrorCode::Success) {
+  if (!Encryption::hmacSHA256Digest(sessionKey, 32, data, dataLen, calculated)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  // Constant-time karşılaştırma
-  if (!Encryption::constantTimeCompare(calculatedHMAC, expectedHMAC, 64)) {
-    return ErrorCode::ChecksumMismatch;
+  return compareHMAC(calculated, expectedHMAC);
+}
+
+ErrorCode calculateHMAC(const void *data, size_t dataLen,
+                        const SessionKeyHandle &sessionKey,
+                        char *hmac) {
+  if (!data || dataLen == 0 || !hmac) {
+    return ErrorCode::InvalidInput;
   }
 
+  Encryption::Digest256 digest;
+  Encryption::hmacSHA256WithMidstate(sessionKey.hmac, data, dataLen, digest);
+  Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), hmac);
   return ErrorCode::Success;
 }
 
+ErrorCode verifyHMAC(const void *data, size_t dataLen,
+                     const SessionKeyHandle &sessionKey,
+                     const char *expectedHMAC) {
+  if (!data || dataLen == 0 || !expectedHMAC) {
+    return ErrorCode::InvalidInput;
+  }
+
+  Encryption::Digest256 calculated;
+  Encryption::hmacSHA256WithMidstate(sessionKey.hmac, data, dataLen, calculated);
+  return compareHMAC(calculated, expectedHMAC);
+}
+
 // ============================================
 // SUNUCU DOĞRULAMA KODU (DİJİTAL İMZA)
 // ============================================
 
-ErrorCode signData(const void *data, size_t dataLen,
-                   char *signature) {
-  if (!data || dataLen == 0 || !signature) {
-    return ErrorCode::InvalidInput;
-  }
+/** @brief signMany/verifyMany'nin bir seferde işlediği kayıt sayısı (yığın buffer'ları) */
+static const size_t SIGNATURE_BATCH_SIZE = 64;
 
-  // Master key ile HMAC hesapla (dijital imza olarak)
-  static const uint8_t SIGNATURE_KEY[32] = {
-    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
-    0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
-    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
-    0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f
+/**
+ * @brief İmza anahtarının HMAC ara durumları
+ *
+ * Anahtar sabit olduğundan ipad/opad blokları ilk kullanımda bir kez
+ * işlenir (thread-safe statik başlatma).
+ *
+ * @return const Encryption::HMACSHA256Midstate& Ara durumlar
+ */
+static const Encryption::HMACSHA256Midstate &signingMidstate() {
+  struct Prepared {
+    Encryption::HMACSHA256Midstate midstate;
+
+    Prepared() {
+      // Master key ile HMAC hesapla (dijital imza olarak)
+      static const uint8_t SIGNATURE_KEY[32] = {
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+        0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+        0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f
+      };
+      Encryption::hmacSHA256Prepare(SIGNATURE_KEY, sizeof(SIGNATURE_KEY), midstate);
+    }
   };
+  static const Prepared prepared;
+  return prepared.midstate;
+}
 
-  // HMAC-SHA256 hesapla
-  if (!Encryption::hmacSHA256(SIGNATURE_KEY, 32, data, dataLen, signature)) {
+/**
+ * @brief İkinci hash'ten imza string'ini oluştur
+ *
+ * @param doubleHash SHA-256(hex(HMAC))
+ * @param signature Çıktı (129 byte): hex(doubleHash) || hex(doubleHash)
+ */
+static void formatSignature(const Encryption::Digest256 &doubleHash, char *signature) {
+  Encryption::encodeHex(doubleHash.bytes, sizeof(doubleHash.bytes), signature);
+  std::memcpy(signature + 64, signature, 64);
+  signature[128] = '\0';
+}
+
+/**
+ * @brief En fazla SIGNATURE_BATCH_SIZE kaydın imzasını çoklu buffer SHA-256 ile hesapla
+ *
+ * @param records Kayıtlar (boş olmamalı)
+ * @param count Kayıt sayısı
+ * @param signatures İmza çıktıları
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode signBatch(const Encryption::IOVec *records, size_t count,
+                           char (*signatures)[129]) {
+  Encryption::Digest256 digests[SIGNATURE_BATCH_SIZE];
+
+  if (!Encryption::hmacSHA256ManyWithMidstate(signingMidstate(), records, count, digests)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  // İki kez hash'le (daha güçlü imza)
-  char doubleHash[65];
+  // İmza formatı uyumluluğu için ikinci hash HMAC'in hex gösterimi üzerinden alınır
+  char macHex[SIGNATURE_BATCH_SIZE][65];
+  Encryption::IOVec hexRecords[SIGNATURE_BATCH_SIZE];
+
+  for (size_t i = 0; i < count; ++i) {
+    Encryption::encodeHex(digests[i].bytes, sizeof(digests[i].bytes), macHex[i]);
+    hexRecords[i].base = macHex[i];
+    hexRecords[i].length = 64;
+  }
 
-  if (!Encryption::sha256Hash(signature, 64, doubleHash)) {
+  if (!Encryption::sha256DigestMany(hexRecords, count, digests)) {
     return ErrorCode::EncryptionFailed;
   }
 
-  SafeString::safeCopy(signature, 65, doubleHash);
-  signature[64] = '\0';
-  // İkinci hash'i ekle (128 karakter toplam imza)
-  std::strncat(signature, doubleHash, 64);
-  signature[128] = '\0';
+  for (size_t i = 0; i < count; ++i) {
+    formatSignature(digests[i], signatures[i]);
+  }
+
+  return ErrorCode::Success;
+}
+
+ErrorCode signData(const void *data, size_t dataLen,
+                   char *signature) {
+  if (!data || dataLen == 0 || !signature) {
+    return ErrorCode::InvalidInput;
+  }
+
+  // HMAC-SHA256 hesapla (imza anahtarının ara durumları hazır)
+  Encryption::Digest256 mac;
+  Encryption::hmacSHA256WithMidstate(signingMidstate(), data, dataLen, mac);
+  // İki kez hash'le (daha güçlü imza). İmza formatı uyumluluğu için ikinci
+  // hash, HMAC'in 64 karakterlik hex gösterimi üzerinden alınır; hex yığında
+  // tablo ile üretilir.
+  char macHex[65];
+  Encryption::encodeHex(mac.bytes, sizeof(mac.bytes), macHex);
+  Encryption::Digest256 doubleHash;
+  Encryption::sha256Digest(macHex, 64, doubleHash);
+  // 128 karakter imza: hex(doubleHash) || hex(doubleHash)
+  formatSignature(doubleHash, signature);
   return ErrorCode::Success;
 }
 
@@ -398,6 +1070,85 @@ ErrorCode verifySignature(const void *data, size_t dataLen,
   return ErrorCode::Success;
 }
 
+ErrorCode signMany(const Encryption::IOVec *records, size_t count,
+                   char *const *signatures) {
+  if (!records || !signatures) {
+    return ErrorCode::InvalidInput;
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    if (!records[i].base || records[i].length == 0 || !signatures[i]) {
+      return ErrorCode::InvalidInput;
+    }
+  }
+
+  char batch[SIGNATURE_BATCH_SIZE][129];
+
+  for (size_t start = 0; start < count; start += SIGNATURE_BATCH_SIZE) {
+    size_t n = std::min(SIGNATURE_BATCH_SIZE, count - start);
+    ErrorCode result = signBatch(records + start, n, batch);
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+      std::memcpy(signatures[start + i], batch[i], 129);
+    }
+  }
+
+  return ErrorCode::Success;
+}
+
+ErrorCode verifyMany(const Encryption::IOVec *records, size_t count,
+                     const char *const *signatures,
+                     uint8_t *resultBitmap, size_t &validCount) {
+  validCount = 0;
+
+  if (!records || !signatures || !resultBitmap) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::memset(resultBitmap, 0, (count + 7) / 8);
+  Encryption::IOVec batchRecords[SIGNATURE_BATCH_SIZE];
+  size_t batchIndex[SIGNATURE_BATCH_SIZE];
+  char batch[SIGNATURE_BATCH_SIZE][129];
+  size_t i = 0;
+
+  while (i < count) {
+    // Boş kayıt veya eksik imza doğrulanmadan geçersiz sayılır
+    size_t n = 0;
+
+    for (; i < count && n < SIGNATURE_BATCH_SIZE; ++i) {
+      if (records[i].base && records[i].length > 0 && signatures[i]) {
+        batchRecords[n] = records[i];
+        batchIndex[n] = i;
+        ++n;
+      }
+    }
+
+    if (n == 0) {
+      continue;
+    }
+
+    ErrorCode result = signBatch(batchRecords, n, batch);
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+      // Constant-time karşılaştırma
+      if (Encryption::constantTimeCompare(batch[j], signatures[batchIndex[j]], 128)) {
+        resultBitmap[batchIndex[j] / 8] |= static_cast<uint8_t>(1u << (batchIndex[j] % 8));
+        ++validCount;
+      }
+    }
+  }
+
+  return validCount == count ? ErrorCode::Success : ErrorCode::ChecksumMismatch;
+}
+
 } // namespace SessionManager
 
 } // namespace TravelExpense
@@ -5,6 +5,11 @@
  * Bu dosya, SoftHSM kullanarak PKCS#11 standardı üzerinden kriptografik
  * işlemler yapmak için gerekli fonksiyonların implementasyonlarını içerir.
  *
+ * Bir PKCS#11 session'ı aynı anda tek bir işlem yürütebildiğinden her
+ * kriptografik çağrı, oturum açmış session havuzundan bir session ödünç alır.
+ * Böylece farklı thread'lerden gelen çağrılar token üzerinde paralel çalışır.
+ * Çok parçalı (Init/Update/Final) işlemler session'ı işlem boyunca tutar.
+ *
  * @author Binnur Altınışık
  * @date 2025
  */
@@ -18,10 +23,15 @@
 #endif
 #include "../third_party/pkcs11/pkcs11.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <cstdio>
+#include <thread>
 
 #ifdef _WIN32
 #include <io.h>
@@ -88,8 +98,6 @@ static DL_HANDLE g_pkcs11Library = nullptr;
 static CK_FUNCTION_LIST *g_pFunctionList = nullptr;
 /** @brief Mevcut token slot ID'si - openToken() ile ayarlanır */
 static CK_SLOT_ID g_currentSlot = 0;
-/** @brief Açık PKCS#11 session handle'ı - openToken() ile açılır */
-static CK_SESSION_HANDLE g_sessionHandle = 0;
 /** @brief SoftHSM başlatma durumu - initialize() ve shutdown() ile yönetilir */
 static InitStatus g_status = InitStatus::NOT_INITIALIZED;
 /** @brief Token label - initialize() veya createToken() ile ayarlanır (max 64 karakter) */
@@ -97,6 +105,75 @@ static char g_tokenLabel[64] = { 0 };
 /** @brief Token PIN - initialize() veya createToken() ile ayarlanır (max 32 karakter) */
 static char g_pin[32] = { 0 };
 
+/**
+ * @brief Varsayılan session havuzu boyutu (donanım thread sayısı)
+ *
+ * @return size_t Havuzdaki en fazla session sayısı
+ */
+static size_t defaultSessionPoolSize() {
+  unsigned int threads = std::thread::hardware_concurrency();
+  return threads > 0 ? threads : 4;
+}
+
+/**
+ * @brief Çok parçalı AES-CBC işlemi
+ *
+ * Init ile havuzdan alınan session, Final veya iptal edilene kadar bu işleme
+ * ayrılmıştır. closeToken() session'ı geri alırsa session 0 olur.
+ */
+struct CipherOperation {
+  CK_SESSION_HANDLE session;  /**< İşlemin yürüdüğü session (0 = geri alındı) */
+  bool encrypting;            /**< true = şifreleme, false = şifre çözme */
+};
+
+/**
+ * @brief Oturum açmış PKCS#11 session havuzu
+ *
+ * openToken() ilk session'ı açıp PIN ile login yapar; diğer session'lar
+ * talep geldikçe (en fazla maxSessions) açılır. Token'a login uygulama
+ * genelinde olduğundan yeni session'lar da oturum açmış olur. closeToken()
+ * ödünç verilmiş session'ların ve süren Update/Final çağrılarının bitmesini
+ * bekler; çok parçalı işlemlerin tamamlanmasını beklemez.
+ */
+struct SessionPool {
+  std::mutex mutex;                        /**< Havuz durumunu korur */
+  std::condition_variable changed;         /**< Session döndü / havuz kapandı */
+  std::vector<CK_SESSION_HANDLE> idle;     /**< Boştaki session'lar */
+  std::vector<CipherOperation *> operations; /**< Session tutan çok parçalı işlemler */
+  size_t openSessions;                     /**< Açık session sayısı (boşta + ödünçte + işlemlerde) */
+  size_t checkedOut;                       /**< Tek çağrılık ödünç verilmiş session sayısı */
+  size_t operationCalls;                   /**< Süren Update/Final çağrısı sayısı */
+  size_t maxSessions;                      /**< En fazla açık session */
+  uint64_t generation;                     /**< Her openToken/closeToken'da artar */
+  bool open;                               /**< openToken() başarılı ve closeToken() çağrılmadı */
+  CK_SLOT_ID slot;                         /**< Session'ların açıldığı slot */
+  char pin[32];                            /**< Yeni session'ların login PIN'i */
+  SessionPoolStats stats;                  /**< Sayaçlar */
+
+  SessionPool()
+    : openSessions(0), checkedOut(0), operationCalls(0), maxSessions(defaultSessionPoolSize()), generation(0),
+      open(false), slot(0) {
+    std::memset(pin, 0, sizeof(pin));
+    std::memset(&stats, 0, sizeof(stats));
+  }
+};
+
+/** @brief Global session havuzu */
+static SessionPool g_sessionPool;
+
+/**
+ * @brief Thread'in en son kullandığı session
+ *
+ * Aynı thread boştaysa aynı session'ı tekrar alır; generation eşleşmezse
+ * (token kapatılıp yeniden açıldıysa) tercih geçersizdir.
+ */
+struct SessionAffinity {
+  uint64_t generation;
+  CK_SESSION_HANDLE session;
+};
+
+static thread_local SessionAffinity t_sessionAffinity = { 0, 0 };
+
 /**
  * @brief PKCS#11 return code'unu ErrorCode'a çevir
  *
@@ -141,6 +218,178 @@ static ErrorCode pkcs11ToErrorCode(CK_ULONG rv) {
   }
 }
 
+/**
+ * @brief Havuz için yeni session aç ve login yap
+ *
+ * @param session Açılan session (çıktı)
+ * @return CK_ULONG PKCS#11 return code
+ */
+static CK_ULONG openPoolSession(CK_SESSION_HANDLE &session) {
+  session = 0;
+  CK_ULONG flags = CKF_RW_SESSION | CKF_SERIAL_SESSION;
+  CK_ULONG rv = g_pFunctionList->C_OpenSession(g_sessionPool.slot, flags, nullptr, nullptr, &session);
+
+  if (rv != CKR_OK) {
+    session = 0;
+    return rv;
+  }
+
+  rv = g_pFunctionList->C_Login(session, CKU_USER, reinterpret_cast<CK_BYTE *>(g_sessionPool.pin),
+                                static_cast<CK_ULONG>(std::strlen(g_sessionPool.pin)));
+
+  if (rv != CKR_OK && rv != CKR_USER_ALREADY_LOGGED_IN) {
+    g_pFunctionList->C_CloseSession(session);
+    session = 0;
+    return rv;
+  }
+
+  return CKR_OK;
+}
+
+/**
+ * @brief Havuzdan session ödünç al
+ *
+ * Önce thread'in son kullandığı session, sonra herhangi bir boş session
+ * verilir. Boş session yoksa sınır dolana kadar yenisi açılır; sınır
+ * doluysa bir session dönene kadar beklenir. Açık session'ların hepsi çok
+ * parçalı işlemlerde ise (ör. işlem tutan thread'in kendi çağrısı) dönüş
+ * garanti olmadığından beklenmez, Busy döner.
+ *
+ * @param session Ödünç alınan session (çıktı)
+ * @param wait Havuz doluyken beklensin mi (false ise Busy döner)
+ * @return ErrorCode Başarı durumu (InvalidInput = token açık değil, Busy = havuz dolu)
+ */
+static ErrorCode checkoutSession(CK_SESSION_HANDLE &session, bool wait) {
+  session = 0;
+  std::unique_lock<std::mutex> lock(g_sessionPool.mutex);
+
+  while (session == 0) {
+    if (!g_sessionPool.open || !g_pFunctionList) {
+      return ErrorCode::InvalidInput;
+    }
+
+    std::vector<CK_SESSION_HANDLE> &idle = g_sessionPool.idle;
+
+    if (!idle.empty()) {
+      std::vector<CK_SESSION_HANDLE>::iterator chosen = idle.end() - 1;
+
+      if (t_sessionAffinity.generation == g_sessionPool.generation) {
+        std::vector<CK_SESSION_HANDLE>::iterator preferred =
+          std::find(idle.begin(), idle.end(), t_sessionAffinity.session);
+
+        if (preferred != idle.end()) {
+          chosen = preferred;
+          g_sessionPool.stats.affinityHits++;
+        }
+      }
+
+      session = *chosen;
+      *chosen = idle.back();
+      idle.pop_back();
+      break;
+    }
+
+    if (g_sessionPool.openSessions < g_sessionPool.maxSessions) {
+      // Yer ayır; C_OpenSession/C_Login kilit dışında çalışır
+      g_sessionPool.openSessions++;
+      g_sessionPool.checkedOut++;
+      lock.unlock();
+      CK_ULONG rv = openPoolSession(session);
+      lock.lock();
+      g_sessionPool.checkedOut--;
+
+      if (rv != CKR_OK) {
+        g_sessionPool.openSessions--;
+        g_sessionPool.changed.notify_one();
+
+        // Token session sınırına ulaşıldı: sınırı düşür ve mevcutları bekle
+        if (rv == CKR_SESSION_COUNT && g_sessionPool.openSessions > 0) {
+          g_sessionPool.maxSessions = g_sessionPool.openSessions;
+          continue;
+        }
+
+        return pkcs11ToErrorCode(rv);
+      }
+
+      g_sessionPool.stats.sessionsOpened++;
+      break;
+    }
+
+    if (!wait || g_sessionPool.operations.size() >= g_sessionPool.openSessions) {
+      return ErrorCode::Busy;
+    }
+
+    g_sessionPool.stats.waits++;
+    g_sessionPool.changed.wait(lock);
+  }
+
+  g_sessionPool.checkedOut++;
+  g_sessionPool.stats.checkouts++;
+  t_sessionAffinity.generation = g_sessionPool.generation;
+  t_sessionAffinity.session = session;
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Ödünç alınan session'ı havuza geri ver
+ *
+ * Bekleyenlerden yalnızca biri uyandırılır; closeToken() beklerken yeni
+ * ödünç alma olmadığından uyanan o olur.
+ *
+ * Yarım kalmış bir işlem taşıyabilecek (reusable = false) veya havuz
+ * sınırını aşan session kapatılır.
+ *
+ * @param session Geri verilen session
+ * @param reusable Session'da aktif işlem kalmadıysa true
+ */
+static void returnSession(CK_SESSION_HANDLE session, bool reusable) {
+  {
+    std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+
+    if (reusable && g_sessionPool.openSessions <= g_sessionPool.maxSessions) {
+      g_sessionPool.idle.push_back(session);
+      g_sessionPool.checkedOut--;
+      g_sessionPool.changed.notify_one();
+      return;
+    }
+  }
+
+  // closeToken() checkedOut sıfırlanana kadar beklediğinden kapatma kilit dışında güvenli
+  g_pFunctionList->C_CloseSession(session);
+  std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+  g_sessionPool.openSessions--;
+  g_sessionPool.checkedOut--;
+  g_sessionPool.stats.discarded++;
+  g_sessionPool.changed.notify_one();
+}
+
+/**
+ * @brief Kapsam boyunca havuzdan ödünç alınan session (RAII)
+ *
+ * Kullanım: `SessionLease session; if (session.handle == 0) return session.status;`
+ * İşlem session'da yarım kalmış olabilirse discard() ile session kapatılır.
+ */
+struct SessionLease {
+  CK_SESSION_HANDLE handle;  /**< Ödünç alınan session (0 = alınamadı) */
+  ErrorCode status;          /**< checkoutSession sonucu */
+  bool reusable;             /**< false ise dönüşte kapatılır */
+
+  SessionLease() : handle(0), status(checkoutSession(handle, true)), reusable(true) {}
+
+  ~SessionLease() {
+    if (handle != 0) {
+      returnSession(handle, reusable);
+    }
+  }
+
+  void discard() {
+    reusable = false;
+  }
+
+  SessionLease(const SessionLease &) = delete;
+  SessionLease &operator=(const SessionLease &) = delete;
+};
+
 /**
  * @brief SoftHSM kütüphanesi yolunu bul
  *
@@ -291,8 +540,11 @@ ErrorCode initialize(const char *libraryPath, const char *tokenLabel, const char
     return result;
   }
 
-  // PKCS#11'yi başlat
-  CK_ULONG rv = g_pFunctionList->C_Initialize(nullptr);
+  // PKCS#11'yi başlat (session havuzu birden çok thread'den çağırır)
+  CK_C_INITIALIZE_ARGS initArgs;
+  std::memset(&initArgs, 0, sizeof(initArgs));
+  initArgs.flags = CKF_OS_LOCKING_OK;
+  CK_ULONG rv = g_pFunctionList->C_Initialize(&initArgs);
 
   if (rv != CKR_OK && rv != CKR_CRYPTOKI_ALREADY_INITIALIZED) {
     g_status = InitStatus::ERROR;
@@ -333,11 +585,8 @@ ErrorCode shutdown() {
     return ErrorCode::Success;
   }
 
-  // Session'ı kapat
-  if (g_sessionHandle != 0 && g_pFunctionList) {
-    g_pFunctionList->C_CloseSession(g_sessionHandle);
-    g_sessionHandle = 0;
-  }
+  // Session havuzunu kapat
+  closeToken();
 
   // PKCS#11'yi kapat
   if (g_pFunctionList) {
@@ -402,11 +651,13 @@ ErrorCode createToken(const char *label, const char *pin, const char *soPin) {
  *
  * Belirtilen token'ı açar ve PKCS#11 session başlatır. Token label'a göre
  * slot listesinde token aranır, bulunduktan sonra session açılır ve
- * PIN ile login yapılır.
+ * PIN ile login yapılır. Bu session havuzun ilk session'ıdır; diğerleri
+ * eşzamanlı çağrılar geldikçe aynı PIN ile açılır.
  *
  * @note Bu fonksiyon, SoftHSM'nin INITIALIZED durumunda olmasını gerektirir.
  * Eğer label nullptr ise, kaydedilmiş g_tokenLabel kullanılır.
  * Eğer pin nullptr ise, kaydedilmiş g_pin kullanılır.
+ * Token zaten açıksa önce closeToken() ile kapatılır.
  *
  * @param label Token etiketi (nullptr ise kaydedilmiş label kullanılır)
  * @param pin PIN kodu (nullptr ise kaydedilmiş PIN kullanılır)
@@ -417,6 +668,8 @@ ErrorCode openToken(const char *label, const char *pin) {
     return ErrorCode::InvalidInput;
   }
 
+  closeToken();
+
   /**
    * @brief Slot listesi alma
    *
@@ -478,39 +731,29 @@ ErrorCode openToken(const char *label, const char *pin) {
   }
 
   /**
-   * @brief PKCS#11 session açma
-   *
-   * Seçilen slot'ta read-write session açılır. CKF_RW_SESSION flag'i ile
-   * yazma işlemleri yapılabilir, CKF_SERIAL_SESSION flag'i ile serial
-   * session açılır (paralel session değil).
-   */
-  // Session aç
-  CK_ULONG flags = CKF_RW_SESSION | CKF_SERIAL_SESSION;  /**< Read-write ve serial session flag'leri */
-  rv = g_pFunctionList->C_OpenSession(selectedSlot, flags, nullptr, nullptr, &g_sessionHandle);
-
-  if (rv != CKR_OK) {
-    return pkcs11ToErrorCode(rv);
-  }
-
-  /**
-   * @brief PIN ile login
+   * @brief PKCS#11 session açma ve PIN ile login
    *
-   * Kullanıcı PIN'i ile token'a login yapılır. CKU_USER ile normal kullanıcı
-   * olarak login yapılır. Eğer zaten login yapılmışsa (CKR_USER_ALREADY_LOGGED_IN),
-   * hata olarak kabul edilmez.
+   * Seçilen slot'ta read-write, serial session açılır ve CKU_USER olarak
+   * login yapılır (CKR_USER_ALREADY_LOGGED_IN hata sayılmaz). PIN burada
+   * doğrulanır; yanlışsa havuz açılmaz.
    */
-  // PIN ile login yap
   const char *loginPin = pin ? pin : g_pin;  /**< Kullanılacak PIN (parametre veya kaydedilmiş) */
-  rv = g_pFunctionList->C_Login(g_sessionHandle, CKU_USER,
-                                reinterpret_cast<CK_BYTE *>(const_cast<char *>(loginPin)),
-                                static_cast<CK_ULONG>(std::strlen(loginPin)));
+  g_sessionPool.slot = selectedSlot;
+  SafeString::safeCopy(g_sessionPool.pin, sizeof(g_sessionPool.pin), loginPin);
+  CK_SESSION_HANDLE session = 0;
+  rv = openPoolSession(session);
 
-  if (rv != CKR_OK && rv != CKR_USER_ALREADY_LOGGED_IN) {
-    g_pFunctionList->C_CloseSession(g_sessionHandle);
-    g_sessionHandle = 0;
+  if (rv != CKR_OK) {
+    std::memset(g_sessionPool.pin, 0, sizeof(g_sessionPool.pin));
     return pkcs11ToErrorCode(rv);
   }
 
+  std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+  g_sessionPool.idle.push_back(session);
+  g_sessionPool.openSessions = 1;
+  g_sessionPool.stats.sessionsOpened++;
+  g_sessionPool.generation++;
+  g_sessionPool.open = true;
   g_currentSlot = selectedSlot;
   return ErrorCode::Success;
 }
@@ -518,25 +761,107 @@ ErrorCode openToken(const char *label, const char *pin) {
 /**
  * @brief Token kapat ve session'ı sonlandır
  *
- * Açık token session'ını kapatır. Önce logout yapılır, sonra session kapatılır.
- * Session handle ve current slot sıfırlanır.
+ * Havuz yeni ödünç vermeye kapatılır (bekleyen çağrılar InvalidInput alır),
+ * ödünç verilmiş session'ların ve süren Update/Final çağrılarının bitmesi
+ * beklenir. Açık çok parçalı işlemlerin session'ları geri alınır (sonraki
+ * Update/Final InvalidInput döner), ardından logout yapılır ve tüm
+ * session'lar kapatılır. Current slot sıfırlanır.
  *
  * @note Bu fonksiyon, session açık değilse hiçbir işlem yapmaz ve Success döner.
  *
  * @return ErrorCode Başarı durumu
  */
 ErrorCode closeToken() {
-  if (g_sessionHandle == 0 || !g_pFunctionList) {
-    return ErrorCode::Success;
+  std::vector<CK_SESSION_HANDLE> sessions;
+  {
+    std::unique_lock<std::mutex> lock(g_sessionPool.mutex);
+
+    if (!g_sessionPool.open) {
+      return ErrorCode::Success;
+    }
+
+    g_sessionPool.open = false;
+    g_sessionPool.changed.notify_all();
+
+    while (g_sessionPool.checkedOut > 0 || g_sessionPool.operationCalls > 0) {
+      g_sessionPool.changed.wait(lock);
+    }
+
+    sessions.swap(g_sessionPool.idle);
+
+    for (size_t i = 0; i < g_sessionPool.operations.size(); ++i) {
+      sessions.push_back(g_sessionPool.operations[i]->session);
+      g_sessionPool.operations[i]->session = 0;
+    }
+
+    g_sessionPool.operations.clear();
+    g_sessionPool.openSessions = 0;
+    g_sessionPool.generation++;
+    std::memset(g_sessionPool.pin, 0, sizeof(g_sessionPool.pin));
+  }
+
+  if (g_pFunctionList && !sessions.empty()) {
+    g_pFunctionList->C_Logout(sessions[0]);
+
+    for (size_t i = 0; i < sessions.size(); ++i) {
+      g_pFunctionList->C_CloseSession(sessions[i]);
+    }
   }
 
-  g_pFunctionList->C_Logout(g_sessionHandle);
-  g_pFunctionList->C_CloseSession(g_sessionHandle);
-  g_sessionHandle = 0;
   g_currentSlot = 0;
   return ErrorCode::Success;
 }
 
+/**
+ * @brief Session havuzunun en fazla session sayısını ayarla
+ *
+ * Sınır düşürülürse fazla boş session'lar hemen, ödünçtekiler dönüşte kapatılır.
+ *
+ * @param maxSessions En fazla açık session (0 ise InvalidInput döner)
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode setSessionPoolSize(size_t maxSessions) {
+  if (maxSessions == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::vector<CK_SESSION_HANDLE> surplus;
+  {
+    std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+    g_sessionPool.maxSessions = maxSessions;
+
+    while (g_sessionPool.openSessions > maxSessions && !g_sessionPool.idle.empty()) {
+      surplus.push_back(g_sessionPool.idle.back());
+      g_sessionPool.idle.pop_back();
+      g_sessionPool.openSessions--;
+      g_sessionPool.stats.discarded++;
+    }
+
+    g_sessionPool.changed.notify_all();
+  }
+
+  for (size_t i = 0; i < surplus.size(); ++i) {
+    g_pFunctionList->C_CloseSession(surplus[i]);
+  }
+
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Session havuzu istatistiklerini al
+ *
+ * @param stats İstatistikler (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode getSessionPoolStats(SessionPoolStats &stats) {
+  std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+  stats = g_sessionPool.stats;
+  stats.maxSessions = g_sessionPool.maxSessions;
+  stats.openSessions = g_sessionPool.openSessions;
+  stats.idleSessions = g_sessionPool.idle.size();
+  return ErrorCode::Success;
+}
+
 /**
  * @brief Kriptografik anahtar oluştur
  *
@@ -557,10 +882,16 @@ ErrorCode closeToken() {
  */
 ErrorCode generateKey(KeyType keyType, KeyUsage keyUsage,
                       const char *keyLabel, uint8_t *keyId, size_t &keyIdLen) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyLabel || !keyId) {
+  if (!g_pFunctionList || !keyLabel || !keyId) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   /**
    * @brief PKCS#11 mekanizma ve attribute template oluşturma
    *
@@ -711,13 +1042,13 @@ ErrorCode generateKey(KeyType keyType, KeyUsage keyUsage,
     pubTemplate[pubCount].ulValueLen = static_cast<CK_ULONG>(std::strlen(keyLabel));
     pubCount++;
     CK_OBJECT_HANDLE pubKeyHandle = 0;
-    rv = g_pFunctionList->C_GenerateKeyPair(g_sessionHandle, &mechanism,
+    rv = g_pFunctionList->C_GenerateKeyPair(session.handle, &mechanism,
                                             pubTemplate, pubCount,
                                             template_, templateCount,
                                             &pubKeyHandle, &keyHandle);
   } else {
     // Secret key generation
-    rv = g_pFunctionList->C_GenerateKey(g_sessionHandle, &mechanism,
+    rv = g_pFunctionList->C_GenerateKey(session.handle, &mechanism,
                                         template_, templateCount, &keyHandle);
   }
 
@@ -769,10 +1100,16 @@ ErrorCode generateKey(KeyType keyType, KeyUsage keyUsage,
  * @return ErrorCode Başarı durumu (Success, FileNotFound, InvalidInput)
  */
 ErrorCode findKey(const char *keyLabel, uint8_t *keyId, size_t &keyIdLen) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyLabel || !keyId) {
+  if (!g_pFunctionList || !keyLabel || !keyId) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   // Template ile arama
   CK_ATTRIBUTE template_[3];
   template_[0].type = CKA_CLASS;
@@ -786,7 +1123,7 @@ ErrorCode findKey(const char *keyLabel, uint8_t *keyId, size_t &keyIdLen) {
   template_[2].type = CKA_LABEL;
   template_[2].pValue = const_cast<char *>(keyLabel);
   template_[2].ulValueLen = static_cast<CK_ULONG>(std::strlen(keyLabel));
-  CK_ULONG rv = g_pFunctionList->C_FindObjectsInit(g_sessionHandle, template_, 3);
+  CK_ULONG rv = g_pFunctionList->C_FindObjectsInit(session.handle, template_, 3);
 
   if (rv != CKR_OK) {
     return pkcs11ToErrorCode(rv);
@@ -794,8 +1131,8 @@ ErrorCode findKey(const char *keyLabel, uint8_t *keyId, size_t &keyIdLen) {
 
   CK_OBJECT_HANDLE keyHandle = 0;
   CK_ULONG foundCount = 0;
-  rv = g_pFunctionList->C_FindObjects(g_sessionHandle, &keyHandle, 1, &foundCount);
-  g_pFunctionList->C_FindObjectsFinal(g_sessionHandle);
+  rv = g_pFunctionList->C_FindObjects(session.handle, &keyHandle, 1, &foundCount);
+  g_pFunctionList->C_FindObjectsFinal(session.handle);
 
   if (rv != CKR_OK || foundCount == 0) {
     return ErrorCode::FileNotFound;
@@ -826,10 +1163,16 @@ ErrorCode findKey(const char *keyLabel, uint8_t *keyId, size_t &keyIdLen) {
  * @return ErrorCode Başarı durumu
  */
 ErrorCode deleteKey(const uint8_t *keyId, size_t keyIdLen) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyId) {
+  if (!g_pFunctionList || !keyId) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   CK_OBJECT_HANDLE keyHandle = 0;
 
   if (keyIdLen >= sizeof(CK_OBJECT_HANDLE)) {
@@ -838,7 +1181,7 @@ ErrorCode deleteKey(const uint8_t *keyId, size_t keyIdLen) {
     return ErrorCode::InvalidInput;
   }
 
-  CK_ULONG rv = g_pFunctionList->C_DestroyObject(g_sessionHandle, keyHandle);
+  CK_ULONG rv = g_pFunctionList->C_DestroyObject(session.handle, keyHandle);
   return pkcs11ToErrorCode(rv);
 }
 
@@ -866,11 +1209,17 @@ ErrorCode encrypt(const uint8_t *keyId, size_t keyIdLen,
                   const void *plaintext, size_t plaintextLen,
                   void *ciphertext, size_t &ciphertextLen,
                   uint8_t *iv) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyId || !plaintext ||
+  if (!g_pFunctionList || !keyId || !plaintext ||
       plaintextLen == 0 || !ciphertext) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   CK_OBJECT_HANDLE keyHandle = 0;
 
   if (keyIdLen >= sizeof(CK_OBJECT_HANDLE)) {
@@ -891,7 +1240,7 @@ ErrorCode encrypt(const uint8_t *keyId, size_t keyIdLen,
 
   if (!iv) {
     /** IV verilmemiş: PKCS#11 ile rastgele IV oluştur */
-    CK_ULONG rv = g_pFunctionList->C_GenerateRandom(g_sessionHandle, localIV, 16);
+    CK_ULONG rv = g_pFunctionList->C_GenerateRandom(session.handle, localIV, 16);
 
     if (rv != CKR_OK) {
       return pkcs11ToErrorCode(rv);
@@ -912,7 +1261,7 @@ ErrorCode encrypt(const uint8_t *keyId, size_t keyIdLen,
   mechanism.mechanism = CKM_AES_CBC_PAD;  /**< AES-CBC modu + PKCS7 padding */
   mechanism.pParameter = iv;               /**< IV (16 byte) */
   mechanism.ulParameterLen = 16;           /**< IV uzunluğu (16 byte) */
-  CK_ULONG rv = g_pFunctionList->C_EncryptInit(g_sessionHandle, &mechanism, keyHandle);
+  CK_ULONG rv = g_pFunctionList->C_EncryptInit(session.handle, &mechanism, keyHandle);
 
   if (rv != CKR_OK) {
     return pkcs11ToErrorCode(rv);
@@ -920,13 +1269,15 @@ ErrorCode encrypt(const uint8_t *keyId, size_t keyIdLen,
 
   // Şifreleme
   CK_ULONG encryptedLen = static_cast<CK_ULONG>(ciphertextLen);
-  rv = g_pFunctionList->C_Encrypt(g_sessionHandle,
+  rv = g_pFunctionList->C_Encrypt(session.handle,
                                   static_cast<CK_BYTE_PTR>(const_cast<void *>(plaintext)),
                                   static_cast<CK_ULONG>(plaintextLen),
                                   static_cast<CK_BYTE_PTR>(ciphertext),
                                   &encryptedLen);
 
   if (rv != CKR_OK) {
+    // CKR_BUFFER_TOO_SMALL işlemi sonlandırmaz; session'ı havuza geri koyma
+    session.discard();
     return pkcs11ToErrorCode(rv);
   }
 
@@ -958,11 +1309,17 @@ ErrorCode decrypt(const uint8_t *keyId, size_t keyIdLen,
                   const void *ciphertext, size_t ciphertextLen,
                   void *plaintext, size_t &plaintextLen,
                   const uint8_t *iv) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyId || !ciphertext ||
+  if (!g_pFunctionList || !keyId || !ciphertext ||
       ciphertextLen == 0 || !plaintext) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   CK_OBJECT_HANDLE keyHandle = 0;
 
   if (keyIdLen >= sizeof(CK_OBJECT_HANDLE)) {
@@ -1006,7 +1363,7 @@ ErrorCode decrypt(const uint8_t *keyId, size_t keyIdLen,
   mechanism.mechanism = CKM_AES_CBC_PAD;  /**< AES-CBC modu + PKCS7 padding */
   mechanism.pParameter = const_cast<uint8_t *>(iv); /**< IV (16 byte) */
   mechanism.ulParameterLen = 16;                    /**< IV uzunluğu (16 byte) */
-  CK_ULONG rv = g_pFunctionList->C_DecryptInit(g_sessionHandle, &mechanism, keyHandle);
+  CK_ULONG rv = g_pFunctionList->C_DecryptInit(session.handle, &mechanism, keyHandle);
 
   if (rv != CKR_OK) {
     return pkcs11ToErrorCode(rv);
@@ -1014,13 +1371,14 @@ ErrorCode decrypt(const uint8_t *keyId, size_t keyIdLen,
 
   // Şifre çözme
   CK_ULONG decryptedLen = static_cast<CK_ULONG>(plaintextLen);
-  rv = g_pFunctionList->C_Decrypt(g_sessionHandle,
+  rv = g_pFunctionList->C_Decrypt(session.handle,
                                   static_cast<CK_BYTE_PTR>(const_cast<void *>(ciphertext)),
                                   static_cast<CK_ULONG>(ciphertextLen),
                                   static_cast<CK_BYTE_PTR>(plaintext),
                                   &decryptedLen);
 
   if (rv != CKR_OK) {
+    session.discard();
     return pkcs11ToErrorCode(rv);
   }
 
@@ -1028,6 +1386,574 @@ ErrorCode decrypt(const uint8_t *keyId, size_t keyIdLen,
   return ErrorCode::Success;
 }
 
+/**
+ * @brief Çok parçalı işlemi sonlandır ve session'ı geri ver
+ *
+ * @param operation İşlem (silinir)
+ * @param completed PKCS#11 işlemi Final ile bittiyse true; değilse session kapatılır
+ */
+static void releaseCipherOperation(CipherOperation *operation, bool completed) {
+  CK_SESSION_HANDLE session = 0;
+  {
+    std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+    std::vector<CipherOperation *> &operations = g_sessionPool.operations;
+    std::vector<CipherOperation *>::iterator it = std::find(operations.begin(), operations.end(), operation);
+
+    if (it != operations.end()) {
+      // returnSession'a kadar closeToken() beklesin
+      session = operation->session;
+      *it = operations.back();
+      operations.pop_back();
+      g_sessionPool.checkedOut++;
+    }
+  }
+
+  if (session != 0) {
+    returnSession(session, completed);
+  }
+
+  delete operation;
+}
+
+/**
+ * @brief Update/Final çağrısı için işlemin session'ını al
+ *
+ * @param operation İşlem
+ * @return CK_SESSION_HANDLE Session (0 = closeToken ile geri alınmış)
+ */
+static CK_SESSION_HANDLE beginOperationCall(CipherOperation *operation) {
+  std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+
+  if (operation->session != 0) {
+    g_sessionPool.operationCalls++;
+  }
+
+  return operation->session;
+}
+
+/**
+ * @brief Update/Final çağrısının bittiğini bildir (closeToken() bekliyor olabilir)
+ */
+static void endOperationCall() {
+  std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+  g_sessionPool.operationCalls--;
+  g_sessionPool.changed.notify_all();
+}
+
+/**
+ * @brief AES-CBC-PAD çok parçalı işlemini başlat
+ *
+ * Havuz doluysa beklemez (Busy); böylece işlem tutan bir thread başka bir
+ * işlem başlatırken kendini kilitlemez.
+ *
+ * @param encrypting true = C_EncryptInit, false = C_DecryptInit
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen keyId buffer boyutu
+ * @param iv IV (16 byte)
+ * @param operation Başlatılan işlem (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode cipherInit(bool encrypting, const uint8_t *keyId, size_t keyIdLen,
+                            const uint8_t *iv, CipherOperation **operation) {
+  if (!operation) {
+    return ErrorCode::InvalidInput;
+  }
+
+  *operation = nullptr;
+
+  if (!g_pFunctionList || !keyId || keyIdLen < sizeof(CK_OBJECT_HANDLE) || !iv) {
+    return ErrorCode::InvalidInput;
+  }
+
+  CK_OBJECT_HANDLE keyHandle = 0;
+  std::memcpy(&keyHandle, keyId, sizeof(CK_OBJECT_HANDLE));
+  CK_SESSION_HANDLE session = 0;
+  ErrorCode result = checkoutSession(session, false);
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  CK_MECHANISM mechanism;
+  mechanism.mechanism = CKM_AES_CBC_PAD;
+  mechanism.pParameter = const_cast<uint8_t *>(iv);
+  mechanism.ulParameterLen = 16;
+  CK_ULONG rv = encrypting ? g_pFunctionList->C_EncryptInit(session, &mechanism, keyHandle)
+                : g_pFunctionList->C_DecryptInit(session, &mechanism, keyHandle);
+
+  if (rv != CKR_OK) {
+    returnSession(session, true);
+    return pkcs11ToErrorCode(rv);
+  }
+
+  CipherOperation *created = new CipherOperation();
+  created->session = session;
+  created->encrypting = encrypting;
+  // Tek çağrılık ödünçten işlem kaydına geçir: closeToken() artık bunu beklemez
+  std::lock_guard<std::mutex> lock(g_sessionPool.mutex);
+  g_sessionPool.operations.push_back(created);
+  g_sessionPool.checkedOut--;
+  g_sessionPool.changed.notify_all();
+  *operation = created;
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Çok parçalı işleme veri ver
+ *
+ * CBC-PAD bir sonraki bloğu (şifre çözmede son bloğu) bekletebileceğinden
+ * çıktı, girdiden en fazla 15 byte uzun olabilir; output buffer'ı en az
+ * inputLen + 16 byte olmalıdır.
+ *
+ * @param encrypting İşlemin beklenen yönü
+ * @param operation İşlem
+ * @param input Girdi
+ * @param inputLen Girdi uzunluğu
+ * @param output Çıktı buffer'ı
+ * @param outputLen Buffer boyutu (giriş), yazılan byte (çıktı)
+ * @return ErrorCode Başarı durumu (Success dışındaki her dönüşte işlem silinir)
+ */
+static ErrorCode cipherUpdate(bool encrypting, CipherOperation *operation,
+                              const void *input, size_t inputLen,
+                              void *output, size_t &outputLen) {
+  if (!operation) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (operation->encrypting != encrypting || (!input && inputLen > 0) || !output ||
+      outputLen < inputLen + 16) {
+    releaseCipherOperation(operation, false);
+    return ErrorCode::InvalidInput;
+  }
+
+  if (inputLen == 0) {
+    outputLen = 0;
+    return ErrorCode::Success;
+  }
+
+  CK_SESSION_HANDLE session = beginOperationCall(operation);
+
+  if (session == 0) {
+    releaseCipherOperation(operation, false);
+    return ErrorCode::InvalidInput;
+  }
+
+  CK_ULONG written = static_cast<CK_ULONG>(outputLen);
+  CK_BYTE_PTR in = static_cast<CK_BYTE_PTR>(const_cast<void *>(input));
+  CK_ULONG rv = encrypting
+                ? g_pFunctionList->C_EncryptUpdate(session, in, static_cast<CK_ULONG>(inputLen),
+                    static_cast<CK_BYTE_PTR>(output), &written)
+                : g_pFunctionList->C_DecryptUpdate(session, in, static_cast<CK_ULONG>(inputLen),
+                    static_cast<CK_BYTE_PTR>(output), &written);
+  endOperationCall();
+
+  if (rv != CKR_OK) {
+    releaseCipherOperation(operation, false);
+    return pkcs11ToErrorCode(rv);
+  }
+
+  outputLen = written;
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Çok parçalı işlemi bitir
+ *
+ * Şifrelemede padding bloğu, şifre çözmede padding'i kaldırılmış son blok
+ * yazılır (en fazla 16 byte). İşlem her durumda silinir.
+ *
+ * @param encrypting İşlemin beklenen yönü
+ * @param operation İşlem
+ * @param output Çıktı buffer'ı (en az 16 byte)
+ * @param outputLen Buffer boyutu (giriş), yazılan byte (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode cipherFinal(bool encrypting, CipherOperation *operation, void *output, size_t &outputLen) {
+  if (!operation) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (operation->encrypting != encrypting || !output || outputLen < 16) {
+    releaseCipherOperation(operation, false);
+    return ErrorCode::InvalidInput;
+  }
+
+  CK_SESSION_HANDLE session = beginOperationCall(operation);
+
+  if (session == 0) {
+    releaseCipherOperation(operation, false);
+    return ErrorCode::InvalidInput;
+  }
+
+  CK_ULONG written = static_cast<CK_ULONG>(outputLen);
+  CK_ULONG rv = encrypting
+                ? g_pFunctionList->C_EncryptFinal(session, static_cast<CK_BYTE_PTR>(output), &written)
+                : g_pFunctionList->C_DecryptFinal(session, static_cast<CK_BYTE_PTR>(output), &written);
+  endOperationCall();
+  releaseCipherOperation(operation, rv == CKR_OK);
+
+  if (rv != CKR_OK) {
+    return pkcs11ToErrorCode(rv);
+  }
+
+  outputLen = written;
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Çok parçalı AES-CBC şifrelemeyi başlat
+ *
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode encryptInit(const uint8_t *keyId, size_t keyIdLen, const uint8_t *iv,
+                      CipherOperation **operation) {
+  return cipherInit(true, keyId, keyIdLen, iv, operation);
+}
+
+/**
+ * @brief Şifrelemeye bir parça ver (ciphertext buffer'ı en az plaintextLen + 16 byte)
+ *
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode encryptUpdate(CipherOperation *operation, const void *plaintext, size_t plaintextLen,
+                        void *ciphertext, size_t &ciphertextLen) {
+  return cipherUpdate(true, operation, plaintext, plaintextLen, ciphertext, ciphertextLen);
+}
+
+/**
+ * @brief Şifrelemeyi bitir ve padding bloğunu yaz
+ *
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode encryptFinal(CipherOperation *operation, void *ciphertext, size_t &ciphertextLen) {
+  return cipherFinal(true, operation, ciphertext, ciphertextLen);
+}
+
+/**
+ * @brief Çok parçalı AES-CBC şifre çözmeyi başlat
+ *
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode decryptInit(const uint8_t *keyId, size_t keyIdLen, const uint8_t *iv,
+                      CipherOperation **operation) {
+  return cipherInit(false, keyId, keyIdLen, iv, operation);
+}
+
+/**
+ * @brief Şifre çözmeye bir parça ver (plaintext buffer'ı en az ciphertextLen + 16 byte)
+ *
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode decryptUpdate(CipherOperation *operation, const void *ciphertext, size_t ciphertextLen,
+                        void *plaintext, size_t &plaintextLen) {
+  return cipherUpdate(false, operation, ciphertext, ciphertextLen, plaintext, plaintextLen);
+}
+
+/**
+ * @brief Şifre çözmeyi bitir; padding doğrulanır ve son blok yazılır
+ *
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode decryptFinal(CipherOperation *operation, void *plaintext, size_t &plaintextLen) {
+  return cipherFinal(false, operation, plaintext, plaintextLen);
+}
+
+/**
+ * @brief Çok parçalı işlemi iptal et; session kapatılır
+ */
+void cancelCipherOperation(CipherOperation *operation) {
+  if (operation) {
+    releaseCipherOperation(operation, false);
+  }
+}
+
+/** @brief Dosya şifrelemede HSM'e tek seferde verilen parça boyutu */
+static const size_t HSM_FILE_CHUNK_SIZE = 1u << 20;
+
+/**
+ * @struct FileChunkReader
+ * @brief Dosyayı tek bir arka plan thread'inde iki yuvaya okuyan yardımcı
+ *
+ * Okuyucu bir yuvayı doldururken tüketici diğerini HSM'e verir; tüm dosya
+ * için tek thread kullanılır. Yıkıcı okuyucuyu durdurur ve bekler.
+ */
+struct FileChunkReader {
+  std::FILE *in;                          /**< Girdi dosyası */
+  std::unique_ptr<uint8_t[]> slots[2];    /**< Parça buffer'ları */
+  size_t lengths[2];                      /**< Yuvadaki veri uzunluğu (0 = dosya sonu) */
+  bool filled[2];                         /**< Yuva tüketiciye hazır mı */
+  bool stopping;                          /**< Tüketici işi bıraktı */
+  std::mutex mutex;                       /**< Yuva durumu kilidi */
+  std::condition_variable changed;        /**< Yuva doldu / boşaldı / durdur */
+  std::thread thread;                     /**< Okuyucu thread */
+
+  explicit FileChunkReader(std::FILE *file) : in(file), stopping(false) {
+    for (size_t i = 0; i < 2; ++i) {
+      slots[i].reset(new uint8_t[HSM_FILE_CHUNK_SIZE]);
+      lengths[i] = 0;
+      filled[i] = false;
+    }
+  }
+
+  ~FileChunkReader() {
+    stop();
+  }
+
+  /** @brief Okuyucu thread'i başlat (std::system_error fırlatabilir) */
+  void start() {
+    thread = std::thread(&FileChunkReader::run, this);
+  }
+
+  /** @brief Okuyucuyu durdur ve bitmesini bekle */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    changed.notify_all();
+
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  /** @brief Yuva dolana kadar bekle; 0 dosya sonu veya okuma hatasıdır */
+  size_t wait(size_t slot) {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this, slot]() {
+      return filled[slot];
+    });
+    return lengths[slot];
+  }
+
+  /** @brief Tüketilen yuvayı okuyucuya geri ver */
+  void release(size_t slot) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      filled[slot] = false;
+    }
+    changed.notify_all();
+  }
+
+ private:
+  void run() {
+    for (size_t slot = 0;; slot ^= 1) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this, slot]() {
+          return stopping || !filled[slot];
+        });
+
+        if (stopping) {
+          return;
+        }
+      }
+      size_t len = std::fread(slots[slot].get(), 1, HSM_FILE_CHUNK_SIZE, in);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        lengths[slot] = len;
+        filled[slot] = true;
+      }
+      changed.notify_all();
+
+      if (len == 0) {
+        return;
+      }
+    }
+  }
+
+  FileChunkReader(const FileChunkReader &);
+  FileChunkReader &operator=(const FileChunkReader &);
+};
+
+/**
+ * @brief Dosyayı parça parça çok parçalı işleme aktar
+ *
+ * Bir parça HSM'de işlenirken sonraki parça tek bir okuyucu thread'inde
+ * okunur (iki yuvalı devir). Bellek kullanımı dosya boyutundan bağımsızdır.
+ * Buffer veya thread oluşturulamazsa işlem iptal edilir ve FileIO döner.
+ *
+ * @param in Girdi dosyası (konumu veri başında)
+ * @param out Çıktı dosyası
+ * @param operation Başlatılmış işlem (her durumda sonlandırılır)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode pipeFileThroughCipher(std::FILE *in, std::FILE *out, CipherOperation *operation) {
+  const bool encrypting = operation->encrypting;
+  std::unique_ptr<FileChunkReader> reader;
+  std::unique_ptr<uint8_t[]> output;
+
+  try {
+    reader.reset(new FileChunkReader(in));
+    output.reset(new uint8_t[HSM_FILE_CHUNK_SIZE + 16]);
+    reader->start();
+  } catch (const std::exception &) {
+    // Session havuza geri verilmeli; hata ErrorCode olarak bildirilir
+    cancelCipherOperation(operation);
+    return ErrorCode::FileIO;
+  }
+
+  for (size_t slot = 0;; slot ^= 1) {
+    size_t readLen = reader->wait(slot);
+
+    if (readLen == 0) {
+      break;
+    }
+
+    size_t outputLen = HSM_FILE_CHUNK_SIZE + 16;
+    ErrorCode result = cipherUpdate(encrypting, operation, reader->slots[slot].get(), readLen,
+                                    output.get(), outputLen);
+    reader->release(slot);
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+
+    if (outputLen > 0 && std::fwrite(output.get(), 1, outputLen, out) != outputLen) {
+      cancelCipherOperation(operation);
+      return ErrorCode::FileIO;
+    }
+  }
+
+  reader->stop();
+
+  if (std::ferror(in)) {
+    cancelCipherOperation(operation);
+    return ErrorCode::FileIO;
+  }
+
+  size_t outputLen = HSM_FILE_CHUNK_SIZE + 16;
+  ErrorCode result = cipherFinal(encrypting, operation, output.get(), outputLen);
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  if (outputLen > 0 && std::fwrite(output.get(), 1, outputLen, out) != outputLen) {
+    return ErrorCode::FileIO;
+  }
+
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Dosyayı HSM anahtarıyla AES-CBC olarak şifrele
+ *
+ * IV token'ın rastgele sayı üreticisiyle oluşturulur.
+ * Çıktı formatı: [IV (16 byte)][Ciphertext (padded)]
+ *
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen keyId buffer boyutu
+ * @param inputFile Girdi dosyası yolu
+ * @param outputFile Çıktı dosyası yolu (hata durumunda silinir)
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode encryptFile(const uint8_t *keyId, size_t keyIdLen, const char *inputFile, const char *outputFile) {
+  if (!keyId || !inputFile || !outputFile) {
+    return ErrorCode::InvalidInput;
+  }
+
+  uint8_t iv[16];
+  ErrorCode result = generateRandom(iv, sizeof(iv));
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  std::unique_ptr<std::FILE, int (*)(std::FILE *)> in(std::fopen(inputFile, "rb"), std::fclose);
+
+  if (!in) {
+    return ErrorCode::FileNotFound;
+  }
+
+  CipherOperation *operation = nullptr;
+  result = encryptInit(keyId, keyIdLen, iv, &operation);
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  std::FILE *out = std::fopen(outputFile, "wb");
+
+  if (!out) {
+    cancelCipherOperation(operation);
+    return ErrorCode::FileIO;
+  }
+
+  if (std::fwrite(iv, 1, sizeof(iv), out) != sizeof(iv)) {
+    cancelCipherOperation(operation);
+    result = ErrorCode::FileIO;
+  } else {
+    result = pipeFileThroughCipher(in.get(), out, operation);
+  }
+
+  if (std::fclose(out) != 0 && result == ErrorCode::Success) {
+    result = ErrorCode::FileIO;
+  }
+
+  if (result != ErrorCode::Success) {
+    std::remove(outputFile);
+  }
+
+  return result;
+}
+
+/**
+ * @brief encryptFile ile şifrelenmiş dosyayı çöz
+ *
+ * Girdi formatı: [IV (16 byte)][Ciphertext (padded)]. Padding geçersizse
+ * kısmen yazılmış çıktı dosyası silinir.
+ *
+ * @param keyId Anahtar ID'si
+ * @param keyIdLen keyId buffer boyutu
+ * @param inputFile Şifrelenmiş dosya yolu
+ * @param outputFile Çıktı dosyası yolu (hata durumunda silinir)
+ * @return ErrorCode Başarı durumu
+ */
+ErrorCode decryptFile(const uint8_t *keyId, size_t keyIdLen, const char *inputFile, const char *outputFile) {
+  if (!keyId || !inputFile || !outputFile) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::unique_ptr<std::FILE, int (*)(std::FILE *)> in(std::fopen(inputFile, "rb"), std::fclose);
+
+  if (!in) {
+    return ErrorCode::FileNotFound;
+  }
+
+  uint8_t iv[16];
+
+  if (std::fread(iv, 1, sizeof(iv), in.get()) != sizeof(iv)) {
+    return ErrorCode::InvalidInput;
+  }
+
+  CipherOperation *operation = nullptr;
+  ErrorCode result = decryptInit(keyId, keyIdLen, iv, &operation);
+
+  if (result != ErrorCode::Success) {
+    return result;
+  }
+
+  std::FILE *out = std::fopen(outputFile, "wb");
+
+  if (!out) {
+    cancelCipherOperation(operation);
+    return ErrorCode::FileIO;
+  }
+
+  result = pipeFileThroughCipher(in.get(), out, operation);
+
+  if (std::fclose(out) != 0 && result == ErrorCode::Success) {
+    result = ErrorCode::FileIO;
+  }
+
+  if (result != ErrorCode::Success) {
+    std::remove(outputFile);
+  }
+
+  return result;
+}
+
 /**
  * @brief Veriyi imzala (SHA256-RSA-PKCS)
  *
@@ -1049,11 +1975,17 @@ ErrorCode decrypt(const uint8_t *keyId, size_t keyIdLen,
 ErrorCode sign(const uint8_t *keyId, size_t keyIdLen,
                const void *data, size_t dataLen,
                void *signature, size_t &signatureLen) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyId || !data ||
+  if (!g_pFunctionList || !keyId || !data ||
       dataLen == 0 || !signature) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   CK_OBJECT_HANDLE keyHandle = 0;
 
   if (keyIdLen >= sizeof(CK_OBJECT_HANDLE)) {
@@ -1079,7 +2011,7 @@ ErrorCode sign(const uint8_t *keyId, size_t keyIdLen,
    * C_SignInit ile imzalama mekanizması ve anahtar ayarlanır.
    * Bu işlem, sonraki C_Sign çağrısı için hazırlık yapar.
    */
-  CK_ULONG rv = g_pFunctionList->C_SignInit(g_sessionHandle, &mechanism, keyHandle);
+  CK_ULONG rv = g_pFunctionList->C_SignInit(session.handle, &mechanism, keyHandle);
 
   if (rv != CKR_OK) {
     return pkcs11ToErrorCode(rv);
@@ -1094,13 +2026,14 @@ ErrorCode sign(const uint8_t *keyId, size_t keyIdLen,
    */
   // İmzalama
   CK_ULONG sigLen = static_cast<CK_ULONG>(signatureLen);  /**< İmza buffer boyutu (giriş), gerçek imza boyutu (çıktı) */
-  rv = g_pFunctionList->C_Sign(g_sessionHandle,
+  rv = g_pFunctionList->C_Sign(session.handle,
                                static_cast<CK_BYTE_PTR>(const_cast<void *>(data)),
                                static_cast<CK_ULONG>(dataLen),
                                static_cast<CK_BYTE_PTR>(signature),
                                &sigLen);
 
   if (rv != CKR_OK) {
+    session.discard();
     return pkcs11ToErrorCode(rv);
   }
 
@@ -1128,11 +2061,17 @@ ErrorCode sign(const uint8_t *keyId, size_t keyIdLen,
 bool verify(const uint8_t *keyId, size_t keyIdLen,
             const void *data, size_t dataLen,
             const void *signature, size_t signatureLen) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyId || !data ||
+  if (!g_pFunctionList || !keyId || !data ||
       dataLen == 0 || !signature || signatureLen == 0) {
     return false;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return false;
+  }
+
   CK_OBJECT_HANDLE keyHandle = 0;
 
   if (keyIdLen >= sizeof(CK_OBJECT_HANDLE)) {
@@ -1158,7 +2097,7 @@ bool verify(const uint8_t *keyId, size_t keyIdLen,
    * C_VerifyInit ile imza doğrulama mekanizması ve anahtar ayarlanır.
    * Bu işlem, sonraki C_Verify çağrısı için hazırlık yapar.
    */
-  CK_ULONG rv = g_pFunctionList->C_VerifyInit(g_sessionHandle, &mechanism, keyHandle);
+  CK_ULONG rv = g_pFunctionList->C_VerifyInit(session.handle, &mechanism, keyHandle);
 
   if (rv != CKR_OK) {
     return false;
@@ -1171,7 +2110,7 @@ bool verify(const uint8_t *keyId, size_t keyIdLen,
    * sonra RSA-PKCS ile imza doğrulanır. İmza geçerliyse CKR_OK döner.
    */
   // Doğrulama
-  rv = g_pFunctionList->C_Verify(g_sessionHandle,
+  rv = g_pFunctionList->C_Verify(session.handle,
                                  static_cast<CK_BYTE_PTR>(const_cast<void *>(data)),
                                  static_cast<CK_ULONG>(dataLen),
                                  static_cast<CK_BYTE_PTR>(const_cast<void *>(signature)),
@@ -1193,11 +2132,17 @@ bool verify(const uint8_t *keyId, size_t keyIdLen,
  * @return ErrorCode Başarı durumu
  */
 ErrorCode generateRandom(uint8_t *output, size_t length) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !output || length == 0) {
+  if (!g_pFunctionList || !output || length == 0) {
     return ErrorCode::InvalidInput;
   }
 
-  CK_ULONG rv = g_pFunctionList->C_GenerateRandom(g_sessionHandle, output,
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
+  CK_ULONG rv = g_pFunctionList->C_GenerateRandom(session.handle, output,
                 static_cast<CK_ULONG>(length));
   return pkcs11ToErrorCode(rv);
 }
@@ -1290,17 +2235,23 @@ ErrorCode listTokens(char labels[][64], size_t &count) {
  * @return ErrorCode Başarı durumu
  */
 ErrorCode listKeys(char labels[][64], size_t &count) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !labels) {
+  if (!g_pFunctionList || !labels) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   // Tüm secret key'leri bul
   CK_ATTRIBUTE template_[1];
   CK_ULONG keyClass = CKO_SECRET_KEY;
   template_[0].type = CKA_CLASS;
   template_[0].pValue = &keyClass;
   template_[0].ulValueLen = sizeof(keyClass);
-  CK_ULONG rv = g_pFunctionList->C_FindObjectsInit(g_sessionHandle, template_, 1);
+  CK_ULONG rv = g_pFunctionList->C_FindObjectsInit(session.handle, template_, 1);
 
   if (rv != CKR_OK) {
     count = 0;
@@ -1327,7 +2278,7 @@ ErrorCode listKeys(char labels[][64], size_t &count) {
   for (size_t i = 0; i < maxKeys; ++i) {
     CK_OBJECT_HANDLE keyHandle = 0;  /**< Bulunan anahtar handle'ı */
     CK_ULONG objCount = 0;            /**< Bulunan obje sayısı */
-    rv = g_pFunctionList->C_FindObjects(g_sessionHandle, &keyHandle, 1, &objCount);
+    rv = g_pFunctionList->C_FindObjects(session.handle, &keyHandle, 1, &objCount);
 
     if (rv != CKR_OK || objCount == 0) {
       /** Anahtar bulunamadı: döngüden çık */
@@ -1346,7 +2297,7 @@ ErrorCode listKeys(char labels[][64], size_t &count) {
     char labelBuffer[64] = { 0 };  /**< Label buffer (64 karakter) */
     attr.pValue = labelBuffer;
     attr.ulValueLen = sizeof(labelBuffer) - 1;  /**< Buffer boyutu - 1 (null terminator için) */
-    rv = g_pFunctionList->C_GetAttributeValue(g_sessionHandle, keyHandle, &attr, 1);
+    rv = g_pFunctionList->C_GetAttributeValue(session.handle, keyHandle, &attr, 1);
 
     if (rv == CKR_OK && attr.ulValueLen > 0) {
       /** Label başarıyla alındı: listeye ekle */
@@ -1356,7 +2307,7 @@ ErrorCode listKeys(char labels[][64], size_t &count) {
     }
   }
 
-  g_pFunctionList->C_FindObjectsFinal(g_sessionHandle);
+  g_pFunctionList->C_FindObjectsFinal(session.handle);
   count = foundCount;
   return ErrorCode::Success;
 }
@@ -1382,11 +2333,17 @@ ErrorCode listKeys(char labels[][64], size_t &count) {
 ErrorCode importKey(KeyType keyType,
                     const uint8_t *keyData, size_t keyDataLen,
                     const char *keyLabel, uint8_t *keyId, size_t &keyIdLen) {
-  if (g_sessionHandle == 0 || !g_pFunctionList || !keyData || keyDataLen == 0 ||
+  if (!g_pFunctionList || !keyData || keyDataLen == 0 ||
       !keyLabel || !keyId) {
     return ErrorCode::InvalidInput;
   }
 
+  SessionLease session;
+
+  if (session.handle == 0) {
+    return session.status;
+  }
+
   /**
    * @brief PKCS#11 attribute template oluşturma (import için)
    *
@@ -1469,7 +2426,7 @@ ErrorCode importKey(KeyType keyType,
    * Anahtar verisi (CKA_VALUE) template içinde belirtilir.
    */
   CK_OBJECT_HANDLE keyHandle = 0;  /**< Oluşturulan anahtar handle'ı */
-  CK_ULONG rv = g_pFunctionList->C_CreateObject(g_sessionHandle, template_,
+  CK_ULONG rv = g_pFunctionList->C_CreateObject(session.handle, template_,
                 templateCount, &keyHandle);
 
   if (rv != CKR_OK) {
@@ -4,9 +4,20 @@
  *
  * Bu dosya, SSL/TLS ve Certificate Pinning gereksinimlerinin implementasyonlarını içerir.
  *
- * NOT: Konsol uygulaması olduğu için network iletişimi sınırlıdır.
- * Gerçek bir TLS implementasyonu için OpenSSL veya benzeri bir kütüphane entegre edilebilir.
- * Bu implementasyon, temel TLS fonksiyonlarını sağlar ve certificate pinning mekanizmasını içerir.
+ * TLS taşıması OpenSSL ile yapılır (TRAVELEXPENSE_HAS_OPENSSL). OpenSSL
+ * olmadan derlenen kütüphanede bağlam oluşturulabilir ve pin kayıtları
+ * tutulabilir, ancak bağlantı kurulamaz (ConnectionFailed).
+ *
+ * İstemci oturumları SSL_CTX başına hostname:port anahtarıyla saklanır;
+ * bağlantı havuzu boşta bağlantıları aynı anahtarla tutar ve yeni
+ * bağlantıları şablon bağlamın SSL_CTX'i üzerinden açar.
+ *
+ * Dosya gönderimi, kernel TLS (kTLS) etkinse SSL_sendfile ile dosyadan
+ * doğrudan sokete, değilse sınırlı bir buffer üzerinden yapılır.
+ *
+ * Engellemeyen modda G/Ç çağrıları beklemek yerine Busy döner ve bağlamın
+ * wantRead/wantWrite alanlarını doldurur; olay döngüsü bu durumlarla soketi
+ * Linux'ta epoll (EPOLLONESHOT), diğer platformlarda poll ile bekler.
  *
  * @author Binnur Altınışık
  * @date 2025
@@ -16,10 +27,57 @@
 #include "../header/encryption.h"
 #include "../header/security.h"
 #include "../header/safe_string.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
+#include <string>
+#include <thread>
 #include <vector>
+#include <list>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+  #define WIN32_LEAN_AND_MEAN
+  #define NOMINMAX
+  #include <io.h>
+  #include <winsock2.h>
+  #include <ws2tcpip.h>
+  #pragma comment(lib, "ws2_32.lib")
+#else
+  #include <sys/socket.h>
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <arpa/inet.h>
+  #include <fcntl.h>
+  #include <netdb.h>
+  #include <poll.h>
+  #include <signal.h>
+  #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+  #include <sys/epoll.h>
+  #define TLS_EVENT_LOOP_EPOLL 1
+#endif
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  #include <openssl/ssl.h>
+  #include <openssl/err.h>
+  #include <openssl/evp.h>
+  #include <openssl/pem.h>
+  #include <openssl/x509v3.h>
+
+  // SSL_sendfile ve SSL_OP_ENABLE_KTLS OpenSSL 3.0 ile geldi
+  #if OPENSSL_VERSION_NUMBER >= 0x30000000L && defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    #define TLS_HAS_KTLS_SENDFILE 1
+  #endif
+#endif
 
 namespace TravelExpense {
 
@@ -29,151 +87,1827 @@ namespace TLS {
 // INTERNAL STATE - İç Durum Yönetimi
 // ============================================
 
-// Certificate pin kayıtları (hostname -> pin bilgisi)
-static std::map<std::string, CertificatePin> g_certificatePins;
-static std::mutex g_pinsMutex;
+/**
+ * @struct PinTable
+ * @brief Değişmez certificate pin tablosu (açık adresleme, doğrusal yoklama)
+ *
+ * Yayınlandıktan sonra değiştirilmez; okuyucular kilitsiz okur. Arama
+ * hostname'in (işaretçi, uzunluk) hash'i ile yapılır, std::string oluşturulmaz.
+ */
+struct PinTable {
+  /** @brief Tablo yuvası */
+  struct Slot {
+    uint64_t hash;          /**< @brief hostname FNV-1a hash'i */
+    size_t hostnameLength;  /**< @brief strlen(pin.hostname) */
+    CertificatePin pin;     /**< @brief Pin bilgisi (anahtar: pin.hostname) */
+    bool used;              /**< @brief Yuva dolu mu */
+  };
+
+  std::vector<Slot> slots;  /**< @brief 2'nin kuvveti kapasite, en fazla yarısı dolu */
+};
+
+/**
+ * @struct CertificatePinStore
+ * @brief Certificate pin kayıtları (RCU tarzı)
+ *
+ * Yazanlar (kayıt/silme, seyrek) ana kopyayı kilit altında günceller ve
+ * yeni tabloyu atomik olarak yayınlar; her yayında version artar.
+ * Okuyucular (her bağlantıda) thread-local kopyayı yalnızca version
+ * değiştiğinde yeniler, aksi halde paylaşılan hiçbir veriye yazmaz.
+ */
+struct CertificatePinStore {
+  std::mutex writeMutex;                          /**< @brief Yazanlar arası kilit */
+  std::map<std::string, CertificatePin> pins;     /**< @brief Ana kopya (yalnızca yazanlar) */
+  std::shared_ptr<const PinTable> snapshot;       /**< @brief Yayınlanan tablo (std::atomic_load/store) */
+  std::atomic<uint64_t> version;                  /**< @brief Yayın sayacı */
+
+  CertificatePinStore() : version(0) {}
+};
+
+static CertificatePinStore g_pinStore;
 
 // ============================================
-// SSL/TLS BAĞLANTI YÖNETİMİ
+// SOKET YARDIMCILARI
 // ============================================
 
-TravelExpense::ErrorCode initializeTLSContext(TLSContext *ctx) {
-  if (!ctx) {
-    return ErrorCode::InvalidInput;
+#ifdef _WIN32
+/** @brief Platform soket tipi */
+typedef SOCKET SocketHandle;
+/** @brief Geçersiz soket değeri */
+static const SocketHandle INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+/** @brief shutdown() için iki yön */
+static const int SOCKET_SHUTDOWN_BOTH = SD_BOTH;
+
+static void closeSocket(SocketHandle socketHandle) {
+  closesocket(socketHandle);
+}
+#else
+/** @brief Platform soket tipi */
+typedef int SocketHandle;
+/** @brief Geçersiz soket değeri */
+static const SocketHandle INVALID_SOCKET_HANDLE = -1;
+/** @brief shutdown() için iki yön */
+static const int SOCKET_SHUTDOWN_BOTH = SHUT_RDWR;
+
+static void closeSocket(SocketHandle socketHandle) {
+  close(socketHandle);
+}
+#endif
+
+/**
+ * @brief Dosya veya dizin var mı
+ *
+ * @param path Yol
+ * @param isDirectory Dizin mi (çıktı, nullptr olabilir)
+ */
+static bool pathExists(const char *path, bool *isDirectory) {
+  struct stat info;
+
+  if (stat(path, &info) != 0) {
+    return false;
   }
 
-  // Bağlamı sıfırla
-  std::memset(ctx, 0, sizeof(TLSContext));
-  ctx->sslContext = nullptr;
-  ctx->sslConnection = nullptr;
-  ctx->isInitialized = false;
-  ctx->isConnected = false;
-  ctx->serverPort = 0;
-  // NOT: Gerçek implementasyonda OpenSSL SSL_CTX_new() çağrısı yapılmalı
-  // Şimdilik stub implementasyon:
-  // SSL_CTX* ssl_ctx = SSL_CTX_new(TLS_client_method());
-  // ctx->sslContext = ssl_ctx;
-  // Burada OpenSSL olmadan temel başlatma yapılabilir
-  // Gerçek uygulamada OpenSSL SSL_CTX oluşturulur
-  ctx->isInitialized = true;
+  if (isDirectory) {
+    *isDirectory = (info.st_mode & S_IFMT) == S_IFDIR;
+  }
+
+  return true;
+}
+
+/** @brief Oturum önbelleği ve bağlantı havuzu anahtarı: "hostname:port" */
+static std::string sessionKey(const char *hostname, uint16_t port) {
+  char suffix[8];
+  std::snprintf(suffix, sizeof(suffix), ":%u", static_cast<unsigned>(port));
+  return std::string(hostname) + suffix;
+}
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+/** @brief poll() sarmalayıcısı */
+static int pollSockets(pollfd *fds, unsigned long count, int timeoutMs) {
+#ifdef _WIN32
+  return WSAPoll(fds, count, timeoutMs);
+#else
+  return poll(fds, static_cast<nfds_t>(count), timeoutMs);
+#endif
+}
+
+/** @brief Soketi engellemeyen (non-blocking) veya engelleyen moda al */
+static void setSocketNonBlocking(SocketHandle socketHandle, bool nonBlocking) {
+#ifdef _WIN32
+  u_long mode = nonBlocking ? 1 : 0;
+  ioctlsocket(socketHandle, FIONBIO, &mode);
+#else
+  int flags = fcntl(socketHandle, F_GETFL, 0);
+
+  if (flags >= 0) {
+    fcntl(socketHandle, F_SETFL, nonBlocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK));
+  }
+
+#endif
+}
+
+/**
+ * @brief Soket altyapısını bir kez hazırla (Windows'ta Winsock başlatılır)
+ */
+static void ensureSocketsInitialized() {
+#ifdef _WIN32
+  static std::once_flag once;
+  std::call_once(once, []() {
+    WSADATA data;
+    WSAStartup(MAKEWORD(2, 2), &data);
+  });
+#endif
+}
+
+/**
+ * @brief Sokete yazmanın SIGPIPE üretmemesini sağla (SO_NOSIGPIPE olan platformlar)
+ */
+static void disableSigpipe(SocketHandle socketHandle) {
+#ifdef SO_NOSIGPIPE
+  int on = 1;
+  setsockopt(socketHandle, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#else
+  (void)socketHandle;
+#endif
+}
+
+/**
+ * @struct SigpipeGuard
+ * @brief Kapsam boyunca çağıran thread'de SIGPIPE'ı bastır
+ *
+ * Kapanmış bağlantıya yazma süreci sonlandırmasın diye SIGPIPE thread
+ * maskesinde geçici olarak bloklanır ve kapsamda üretilen sinyal çıkışta
+ * tüketilir; hata SSL çağrısının dönüşünden alınır. Süreç genelindeki
+ * işleyiciye dokunulmaz. SSL yazma yolu (kTLS dahil) değişmediği için
+ * MSG_NOSIGNAL'lı özel BIO yerine bu yol seçildi. SO_NOSIGPIPE olan
+ * platformlarda soket seçeneği yeterlidir ve guard bir şey yapmaz.
+ */
+struct SigpipeGuard {
+#if !defined(_WIN32) && !defined(SO_NOSIGPIPE)
+  sigset_t previousMask;  /**< @brief Geri yüklenecek thread maskesi */
+  bool wasPending;        /**< @brief Kapsamdan önce bekleyen SIGPIPE (tüketilmez) */
+  bool blocked;           /**< @brief Maske değiştirildi mi */
+
+  SigpipeGuard() : wasPending(false), blocked(false) {
+    sigset_t pipeSet;
+    sigset_t pending;
+    sigemptyset(&pipeSet);
+    sigaddset(&pipeSet, SIGPIPE);
+    sigemptyset(&pending);
+    wasPending = sigpending(&pending) == 0 && sigismember(&pending, SIGPIPE) == 1;
+    blocked = pthread_sigmask(SIG_BLOCK, &pipeSet, &previousMask) == 0;
+  }
+
+  ~SigpipeGuard() {
+    if (!blocked) {
+      return;
+    }
+
+    sigset_t pending;
+    sigemptyset(&pending);
+
+    if (!wasPending && sigpending(&pending) == 0 && sigismember(&pending, SIGPIPE) == 1) {
+      sigset_t pipeSet;
+      sigemptyset(&pipeSet);
+      sigaddset(&pipeSet, SIGPIPE);
+      struct timespec noWait = {0, 0};
+
+      while (sigtimedwait(&pipeSet, nullptr, &noWait) < 0 && errno == EINTR) {
+      }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+  }
+#endif
+};
+
+/**
+ * @brief Hostname bir IP adresi mi (IPv4/IPv6)
+ */
+static bool isIPAddress(const char *hostname) {
+  unsigned char address[sizeof(struct in6_addr)];
+  return inet_pton(AF_INET, hostname, address) == 1 || inet_pton(AF_INET6, hostname, address) == 1;
+}
+
+/**
+ * @brief Engellemeyen connect() devam ediyor mu (son hata)
+ */
+static bool isConnectInProgress() {
+#ifdef _WIN32
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return errno == EINPROGRESS;
+#endif
+}
+
+/**
+ * @brief Sunucuya TCP bağlantısı aç
+ *
+ * Çözümlenen adresler sırayla denenir; küçük kayıtların gecikmesini
+ * artırmamak için Nagle algoritması kapatılır. Engellemeyen modda bağlantı
+ * kurulmasını beklemeden dönülür; tamamlanma TLS handshake'inin ilk
+ * yazmasıyla anlaşılır.
+ *
+ * @param hostname Sunucu hostname veya IP
+ * @param port Sunucu port
+ * @param nonBlocking Soket engellemeyen modda açılsın mı
+ * @param socketHandle Bağlı (veya bağlanmakta olan) soket (çıktı)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode connectSocket(const char *hostname, uint16_t port, bool nonBlocking,
+                               SocketHandle &socketHandle) {
+  char service[8];
+  std::snprintf(service, sizeof(service), "%u", static_cast<unsigned>(port));
+  addrinfo hints;
+  std::memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo *addresses = nullptr;
+
+  if (getaddrinfo(hostname, service, &hints, &addresses) != 0) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+  socketHandle = INVALID_SOCKET_HANDLE;
+
+  for (addrinfo *address = addresses; address; address = address->ai_next) {
+    SocketHandle candidate = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+
+    if (candidate == INVALID_SOCKET_HANDLE) {
+      continue;
+    }
+
+    if (nonBlocking) {
+      setSocketNonBlocking(candidate, true);
+    }
+
+    if (connect(candidate, address->ai_addr, static_cast<int>(address->ai_addrlen)) == 0 ||
+        (nonBlocking && isConnectInProgress())) {
+      int noDelay = 1;
+      setsockopt(candidate, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&noDelay),
+                 sizeof(noDelay));
+      disableSigpipe(candidate);
+      socketHandle = candidate;
+      break;
+    }
+
+    closeSocket(candidate);
+  }
+
+  freeaddrinfo(addresses);
+  return socketHandle == INVALID_SOCKET_HANDLE ? ErrorCode::ConnectionFailed : ErrorCode::Success;
+}
+
+// ============================================
+// OPENSSL YARDIMCILARI
+// ============================================
+
+/**
+ * @brief Bağlantının karşı taraf sertifikasını al (referans çağırana aittir)
+ */
+static X509 *peerCertificate(const TLSContext *ctx) {
+  if (!ctx->sslConnection) {
+    return nullptr;
+  }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  return SSL_get1_peer_certificate(static_cast<SSL *>(ctx->sslConnection));
+#else
+  return SSL_get_peer_certificate(static_cast<SSL *>(ctx->sslConnection));
+#endif
+}
+
+/**
+ * @brief Sertifikanın SHA-256 fingerprint'ini hesapla (DER üzerinden)
+ *
+ * @param cert Sertifika
+ * @param fingerprint Çıktı (64 karakter hex)
+ * @return bool Başarılı mı
+ */
+static bool certificateFingerprint(const X509 *cert, char *fingerprint) {
+  unsigned char hash[EVP_MAX_MD_SIZE];
+  unsigned int hashLen = 0;
+
+  if (X509_digest(cert, EVP_sha256(), hash, &hashLen) != 1 || hashLen != 32) {
+    return false;
+  }
+
+  Encryption::encodeHex(hash, 32, fingerprint);
+  return true;
+}
+
+/**
+ * @brief Sertifikanın public key hash'ini hesapla
+ *
+ * DER kodlu SubjectPublicKeyInfo'nun SHA-256 özeti alınır (HPKP pin
+ * formatı); sertifika yenilense de anahtar aynıysa pin geçerli kalır.
+ *
+ * @param cert Sertifika
+ * @param publicKeyHash Çıktı (64 karakter hex)
+ * @return bool Başarılı mı
+ */
+static bool certificatePublicKeyHash(const X509 *cert, char *publicKeyHash) {
+  const X509_PUBKEY *publicKey = X509_get_X509_PUBKEY(cert);
+  int length = publicKey ? i2d_X509_PUBKEY(publicKey, nullptr) : 0;
+
+  if (length <= 0) {
+    return false;
+  }
+
+  std::vector<unsigned char> der(static_cast<size_t>(length));
+  unsigned char *cursor = der.data();
+  i2d_X509_PUBKEY(publicKey, &cursor);
+  Encryption::Digest256 digest;
+  Encryption::sha256Digest(der.data(), der.size(), digest);
+  Encryption::encodeHex(digest.bytes, sizeof(digest.bytes), publicKeyHash);
+  return true;
+}
+
+/**
+ * @brief SSL bağlantısını kapat ve soketi serbest bırak
+ */
+static void closeSSLConnection(SSL *ssl) {
+  SocketHandle socketHandle = static_cast<SocketHandle>(SSL_get_fd(ssl));
+  {
+    SigpipeGuard sigpipeGuard;
+    SSL_shutdown(ssl);
+  }
+  SSL_free(ssl);
+  ERR_clear_error();
+
+  if (socketHandle != INVALID_SOCKET_HANDLE) {
+    closeSocket(socketHandle);
+  }
+}
+
+// ============================================
+// İSTEMCİ OTURUM ÖNBELLEĞİ
+// ============================================
+
+/** @brief SSL_CTX başına saklanacak en fazla hostname:port */
+static const size_t TLS_SESSION_CACHE_CAPACITY = 256;
+/** @brief hostname:port başına saklanacak en fazla oturum (TLS 1.3 ticket) */
+static const size_t TLS_SESSIONS_PER_HOST = 4;
+
+/** @brief Bir hostname:port'un oturumları (en yeni sonda, referanslar bize ait) */
+typedef std::vector<SSL_SESSION *> TLSSessionList;
+
+/**
+ * @struct TLSSessionCacheEntry
+ * @brief Önbellekteki bir hostname:port
+ */
+struct TLSSessionCacheEntry {
+  std::string key;          /**< @brief hostname:port */
+  TLSSessionList sessions;  /**< @brief Oturumlar */
+};
+
+/**
+ * @struct TLSSessionCache
+ * @brief İstemci oturum önbelleği (SSL_CTX ex_data)
+ *
+ * Her hostname:port için sunucunun verdiği son devam ettirilebilir oturumlar
+ * (TLS 1.2 session ID/ticket, TLS 1.3 ticket) tutulur. TLS 1.3 ticket'ları
+ * tek kullanımlıktır (RFC 8446 C.4); sunucu handshake sonrası birden fazla
+ * ticket gönderebildiği için birkaçı saklanır. Önbellek doluyken en uzun
+ * süredir kullanılmayan (saklama veya devam ettirme) hostname:port atılır.
+ * SSL_CTX son referansıyla serbest bırakıldığında önbellek de silinir.
+ */
+struct TLSSessionCache {
+  typedef std::list<TLSSessionCacheEntry>::iterator EntryIterator;
+
+  std::mutex mutex;                                      /**< @brief Önbellek kilidi */
+  std::list<TLSSessionCacheEntry> entries;               /**< @brief Kayıtlar (en son kullanılan başta) */
+  std::unordered_map<std::string, EntryIterator> index;  /**< @brief hostname:port indeksi */
+  bool enabled;                                          /**< @brief Oturum devamı açık mı */
+
+  TLSSessionCache() : enabled(true) {}
+
+  ~TLSSessionCache() {
+    clear();
+  }
+
+  /** @brief hostname:port'un oturumlarını bırak (kilit çağırana ait) */
+  static void release(TLSSessionList &list) {
+    for (size_t i = 0; i < list.size(); ++i) {
+      SSL_SESSION_free(list[i]);
+    }
+
+    list.clear();
+  }
+
+  /** @brief hostname:port kaydını bul ve en son kullanılan yap (kilit çağırana ait) */
+  EntryIterator touch(const std::string &key) {
+    std::unordered_map<std::string, EntryIterator>::iterator found = index.find(key);
+
+    if (found == index.end()) {
+      return entries.end();
+    }
+
+    entries.splice(entries.begin(), entries, found->second);
+    return found->second;
+  }
+
+  /** @brief Kaydı ve oturumlarını bırak (kilit çağırana ait) */
+  void erase(EntryIterator it) {
+    release(it->sessions);
+    index.erase(it->key);
+    entries.erase(it);
+  }
+
+  /** @brief Tüm oturumları bırak (kilit çağırana ait) */
+  void clear() {
+    for (EntryIterator it = entries.begin(); it != entries.end(); ++it) {
+      release(it->sessions);
+    }
+
+    entries.clear();
+    index.clear();
+  }
+};
+
+static void freeSessionCache(void *, void *ptr, CRYPTO_EX_DATA *, int, long, void *) {
+  delete static_cast<TLSSessionCache *>(ptr);
+}
+
+static void freeSessionKey(void *, void *ptr, CRYPTO_EX_DATA *, int, long, void *) {
+  delete static_cast<std::string *>(ptr);
+}
+
+/** @brief SSL_CTX üzerindeki önbellek için ex_data indeksi */
+static int sessionCacheIndex() {
+  static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, freeSessionCache);
+  return index;
+}
+
+/** @brief SSL üzerindeki hostname:port anahtarı için ex_data indeksi */
+static int sessionKeyIndex() {
+  static const int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, freeSessionKey);
+  return index;
+}
+
+static TLSSessionCache *sessionCacheOf(SSL_CTX *sslContext) {
+  return sslContext ? static_cast<TLSSessionCache *>(SSL_CTX_get_ex_data(sslContext, sessionCacheIndex()))
+         : nullptr;
+}
+
+/**
+ * @brief Yeni oturum callback'i (SSL_CTX_sess_set_new_cb)
+ *
+ * TLS 1.2'de handshake sırasında, TLS 1.3'te ticket alındığında çağrılır.
+ *
+ * @return int 1 = oturum referansı önbelleğe alındı, 0 = alınmadı
+ */
+static int storeClientSession(SSL *ssl, SSL_SESSION *session) {
+  TLSSessionCache *cache = sessionCacheOf(SSL_get_SSL_CTX(ssl));
+  const std::string *key = static_cast<const std::string *>(SSL_get_ex_data(ssl, sessionKeyIndex()));
+
+  if (!cache || !key || SSL_SESSION_is_resumable(session) != 1) {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> lock(cache->mutex);
+
+  if (!cache->enabled) {
+    return 0;
+  }
+
+  TLSSessionCache::EntryIterator it = cache->touch(*key);
+
+  if (it == cache->entries.end()) {
+    // Dolu önbellekte en uzun süredir kullanılmayan hostname:port atılır
+    if (cache->entries.size() >= TLS_SESSION_CACHE_CAPACITY) {
+      cache->erase(--cache->entries.end());
+    }
+
+    cache->entries.push_front(TLSSessionCacheEntry());
+    it = cache->entries.begin();
+    it->key = *key;
+    cache->index[*key] = it;
+  }
+
+  TLSSessionList &list = it->sessions;
+
+  if (list.size() >= TLS_SESSIONS_PER_HOST) {
+    SSL_SESSION_free(list.front());
+    list.erase(list.begin());
+  }
+
+  list.push_back(session);
+  return 1;
+}
+
+/**
+ * @brief Önbellekteki en yeni devam ettirilebilir oturumu bağlantıya ata
+ *
+ * TLS 1.3 oturumu kullanıldığı anda önbellekten çıkarılır (OpenSSL de onu
+ * devam ettirilemez işaretler); TLS 1.2 oturumu yeniden kullanılabilir.
+ */
+static void applyCachedSession(SSL *ssl, const std::string &key) {
+  TLSSessionCache *cache = sessionCacheOf(SSL_get_SSL_CTX(ssl));
+
+  if (!cache) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(cache->mutex);
+
+  if (!cache->enabled) {
+    return;
+  }
+
+  TLSSessionCache::EntryIterator it = cache->touch(key);
+
+  if (it == cache->entries.end()) {
+    return;
+  }
+
+  TLSSessionList &list = it->sessions;
+
+  while (!list.empty()) {
+    SSL_SESSION *session = list.back();
+
+    if (SSL_SESSION_is_resumable(session) != 1) {
+      SSL_SESSION_free(session);
+      list.pop_back();
+      continue;
+    }
+
+    SSL_set_session(ssl, session);
+
+    if (SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION) {
+      SSL_SESSION_free(session);
+      list.pop_back();
+    }
+
+    break;
+  }
+}
+
+/**
+ * @brief hostname:port oturumunu önbellekten çıkar
+ *
+ * Handshake veya pin kontrolü başarısız olan sunucunun oturumu bir daha
+ * sunulmaz.
+ */
+static void dropCachedSession(SSL_CTX *sslContext, const std::string &key) {
+  TLSSessionCache *cache = sessionCacheOf(sslContext);
+
+  if (!cache) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(cache->mutex);
+  TLSSessionCache::EntryIterator it = cache->touch(key);
+
+  if (it != cache->entries.end()) {
+    cache->erase(it);
+  }
+}
+
+// ============================================
+// HANDSHAKE VE BEKLEME DURUMU
+// ============================================
+
+/** @brief Engellemeyen modda SSL bağlantısına uygulanan modlar */
+static const long NON_BLOCKING_SSL_MODES = SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER;
+
+/**
+ * @brief SSL hata kodundan bekleme durumunu güncelle
+ *
+ * @return bool İşlem soket hazır olunca tekrar denenmeli mi (WANT_READ/WANT_WRITE)
+ */
+static bool updateWaitState(TLSContext *ctx, int sslError) {
+  ctx->wantRead = sslError == SSL_ERROR_WANT_READ;
+  ctx->wantWrite = sslError == SSL_ERROR_WANT_WRITE;
+  return ctx->wantRead || ctx->wantWrite;
+}
+
+/**
+ * @brief Açılmış (veya açılmakta olan) sokette TLS istemci bağlantısını hazırla
+ *
+ * SNI, hostname/IP doğrulaması ve önbellekteki oturum ayarlanır; başarıda
+ * ctx->sslConnection dolar, handshake driveHandshake() ile yapılır.
+ *
+ * @param ctx TLS bağlamı (serverHostname/serverPort dolu)
+ * @param socketHandle Soket (hata durumunda kapatılır)
+ * @return ErrorCode Başarı durumu
+ */
+static ErrorCode beginHandshake(TLSContext *ctx, SocketHandle socketHandle) {
+  const char *hostname = ctx->serverHostname;
+  SSL *ssl = SSL_new(static_cast<SSL_CTX *>(ctx->sslContext));
+
+  if (!ssl) {
+    closeSocket(socketHandle);
+    ERR_clear_error();
+    return ErrorCode::ConnectionFailed;
+  }
+
+  SSL_set_fd(ssl, static_cast<int>(socketHandle));
+  // Oturum anahtarı SSL ile birlikte serbest bırakılır (freeSessionKey)
+  std::string key = sessionKey(hostname, ctx->serverPort);
+  std::string *sslKey = new std::string(key);
+
+  if (SSL_set_ex_data(ssl, sessionKeyIndex(), sslKey) != 1) {
+    delete sslKey;
+  }
+
+  applyCachedSession(ssl, key);
+
+  // Sertifika, bağlanılan ad (SAN DNS) veya adres (SAN IP) için geçerli olmalı
+  if (isIPAddress(hostname)) {
+    X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(ssl), hostname);
+  } else {
+    SSL_set_tlsext_host_name(ssl, hostname);
+    SSL_set1_host(ssl, hostname);
+  }
+
+  if (ctx->nonBlocking) {
+    SSL_set_mode(ssl, NON_BLOCKING_SSL_MODES);
+  }
+
+  ctx->sslConnection = ssl;
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Handshake'i ilerlet; tamamlanınca certificate pin kontrolü yap
+ *
+ * @param ctx TLS bağlamı (beginHandshake() sonrası)
+ * @return ErrorCode Success, Busy (engellemeyen modda G/Ç bekleniyor),
+ *         ConnectionFailed veya SecurityFailed (bağlantı kapatılır)
+ */
+static ErrorCode driveHandshake(TLSContext *ctx) {
+  SSL *ssl = static_cast<SSL *>(ctx->sslConnection);
+  SSL_CTX *sslContext = SSL_get_SSL_CTX(ssl);
+  int connected;
+  {
+    SigpipeGuard sigpipeGuard;
+    connected = SSL_connect(ssl);
+  }
+
+  if (connected != 1) {
+    if (updateWaitState(ctx, SSL_get_error(ssl, connected))) {
+      return ErrorCode::Busy;
+    }
+
+    long verifyResult = SSL_get_verify_result(ssl);
+    SocketHandle socketHandle = static_cast<SocketHandle>(SSL_get_fd(ssl));
+    SSL_free(ssl);
+    closeSocket(socketHandle);
+    ERR_clear_error();
+    ctx->sslConnection = nullptr;
+    dropCachedSession(sslContext, sessionKey(ctx->serverHostname, ctx->serverPort));
+    return verifyResult != X509_V_OK ? ErrorCode::SecurityFailed : ErrorCode::ConnectionFailed;
+  }
+
+  updateWaitState(ctx, SSL_ERROR_NONE);
+  ctx->isConnected = true;
+  // Certificate pinning kontrolü yap
+  TravelExpense::ErrorCode pinResult = verifyCertificatePin(ctx, ctx->serverHostname);
+
+  if (pinResult != ErrorCode::Success) {
+    // Certificate pinning başarısız - bağlantıyı kapat
+    std::string key = sessionKey(ctx->serverHostname, ctx->serverPort);
+    disconnectTLS(ctx);
+    dropCachedSession(sslContext, key);
+    return ErrorCode::SecurityFailed;
+  }
+
+  return ErrorCode::Success;
+}
+#endif
+
+// ============================================
+// SSL/TLS BAĞLANTI YÖNETİMİ
+// ============================================
+
+TravelExpense::ErrorCode initializeTLSContext(TLSContext *ctx) {
+  if (!ctx) {
+    return ErrorCode::InvalidInput;
+  }
+
+  // Bağlamı sıfırla
+  std::memset(ctx, 0, sizeof(TLSContext));
+  ctx->sslContext = nullptr;
+  ctx->sslConnection = nullptr;
+  ctx->isInitialized = false;
+  ctx->isConnected = false;
+  ctx->serverPort = 0;
+  ctx->nonBlocking = false;
+  ctx->wantRead = false;
+  ctx->wantWrite = false;
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  ensureSocketsInitialized();
+  SSL_CTX *sslContext = SSL_CTX_new(TLS_client_method());
+
+  if (!sslContext) {
+    ERR_clear_error();
+    return ErrorCode::ConnectionFailed;
+  }
+
+  // TLS 1.2 altı kabul edilmez; sunucu sertifikası her zaman doğrulanır
+  SSL_CTX_set_min_proto_version(sslContext, TLS1_2_VERSION);
+  SSL_CTX_set_verify(sslContext, SSL_VERIFY_PEER, nullptr);
+  SSL_CTX_set_default_verify_paths(sslContext);
+#ifdef TLS_HAS_KTLS_SENDFILE
+  // Çekirdek destekliyorsa kayıt şifrelemesi kTLS'e devredilir (sendFileTLS sıfır kopya)
+  SSL_CTX_set_options(sslContext, SSL_OP_ENABLE_KTLS);
+#endif
+  // Oturumlar OpenSSL'in iç deposu yerine hostname:port anahtarlı önbellekte tutulur
+  SSL_CTX_set_session_cache_mode(sslContext, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(sslContext, storeClientSession);
+  SSL_CTX_set_ex_data(sslContext, sessionCacheIndex(), new TLSSessionCache());
+  ctx->sslContext = sslContext;
+#endif
+  ctx->isInitialized = true;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode initializeSharedTLSContext(TLSContext *ctx, const TLSContext *config) {
+  if (!ctx || !config || !config->isInitialized) {
+    return ErrorCode::InvalidInput;
+  }
+
+  void *sslContext = config->sslContext;
+  std::memset(ctx, 0, sizeof(TLSContext));
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+
+  if (sslContext) {
+    SSL_CTX_up_ref(static_cast<SSL_CTX *>(sslContext));
+  }
+
+#endif
+  ctx->sslContext = sslContext;
+  ctx->isInitialized = true;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode cleanupTLSContext(TLSContext *ctx) {
+  if (!ctx) {
+    return ErrorCode::InvalidInput;
+  }
+
+  // Bağlantıyı (veya yarım kalmış handshake'i) kapat
+  if (ctx->isConnected || ctx->sslConnection) {
+    disconnectTLS(ctx);
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+
+  if (ctx->sslContext) {
+    SSL_CTX_free(static_cast<SSL_CTX *>(ctx->sslContext));
+    ctx->sslContext = nullptr;
+  }
+
+#endif
+  // Bağlamı sıfırla
+  std::memset(ctx, 0, sizeof(TLSContext));
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode connectTLS(TLSContext *ctx, const char *hostname, uint16_t port) {
+  if (!ctx || !hostname || !hostname[0] || port == 0 || !ctx->isInitialized) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (ctx->isConnected) {
+    disconnectTLS(ctx);
+  }
+
+  // Hostname ve port'u kaydet
+  SafeString::safeCopy(ctx->serverHostname, sizeof(ctx->serverHostname), hostname);
+  ctx->serverPort = port;
+  ctx->wantRead = false;
+  ctx->wantWrite = false;
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SocketHandle socketHandle = INVALID_SOCKET_HANDLE;
+  ErrorCode result = connectSocket(hostname, port, ctx->nonBlocking, socketHandle);
+
+  if (result == ErrorCode::Success) {
+    result = beginHandshake(ctx, socketHandle);
+  }
+
+  return result == ErrorCode::Success ? driveHandshake(ctx) : result;
+#else
+  // OpenSSL olmadan TLS taşıması yok
+  return ErrorCode::ConnectionFailed;
+#endif
+}
+
+TravelExpense::ErrorCode continueConnectTLS(TLSContext *ctx) {
+  if (!ctx || !ctx->isInitialized) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (ctx->isConnected) {
+    return ErrorCode::Success;
+  }
+
+  if (!ctx->sslConnection) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  return driveHandshake(ctx);
+#else
+  return ErrorCode::ConnectionFailed;
+#endif
+}
+
+TravelExpense::ErrorCode disconnectTLS(TLSContext *ctx) {
+  if (!ctx) {
+    return ErrorCode::InvalidInput;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+
+  if (ctx->sslConnection) {
+    closeSSLConnection(static_cast<SSL *>(ctx->sslConnection));
+    ctx->sslConnection = nullptr;
+  }
+
+#endif
+  ctx->isConnected = false;
+  ctx->wantRead = false;
+  ctx->wantWrite = false;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode sendTLS(TLSContext *ctx, const void *data, size_t dataLen, size_t &bytesSent) {
+  bytesSent = 0;
+
+  if (!ctx || !data || dataLen == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (!ctx->isConnected || !ctx->sslConnection) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  // Engelleyen modda SSL_write_ex verinin tamamını yazar veya hata döner;
+  // engellemeyen modda kısmi yazma açıktır
+  SSL *ssl = static_cast<SSL *>(ctx->sslConnection);
+  size_t written = 0;
+  SigpipeGuard sigpipeGuard;
+
+  if (SSL_write_ex(ssl, data, dataLen, &written) != 1) {
+    int error = SSL_get_error(ssl, 0);
+    ERR_clear_error();
+    return updateWaitState(ctx, error) ? ErrorCode::Busy : ErrorCode::ConnectionFailed;
+  }
+
+  updateWaitState(ctx, SSL_ERROR_NONE);
+  bytesSent = written;
+  return ErrorCode::Success;
+#else
+  return ErrorCode::ConnectionFailed;
+#endif
+}
+
+TravelExpense::ErrorCode receiveTLS(TLSContext *ctx, void *buffer, size_t bufferLen, size_t &bytesReceived) {
+  bytesReceived = 0;
+
+  if (!ctx || !buffer || bufferLen == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (!ctx->isConnected || !ctx->sslConnection) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL *ssl = static_cast<SSL *>(ctx->sslConnection);
+  size_t received = 0;
+  // TLS 1.3'te okuma da kayıt yazabilir (KeyUpdate, alert)
+  SigpipeGuard sigpipeGuard;
+
+  if (SSL_read_ex(ssl, buffer, bufferLen, &received) != 1) {
+    int error = SSL_get_error(ssl, 0);
+    ERR_clear_error();
+
+    // Karşı taraf bağlantıyı düzgün kapattı: 0 byte ile başarı
+    if (error == SSL_ERROR_ZERO_RETURN) {
+      updateWaitState(ctx, SSL_ERROR_NONE);
+      return ErrorCode::Success;
+    }
+
+    return updateWaitState(ctx, error) ? ErrorCode::Busy : ErrorCode::ConnectionFailed;
+  }
+
+  updateWaitState(ctx, SSL_ERROR_NONE);
+  bytesReceived = received;
+  return ErrorCode::Success;
+#else
+  return ErrorCode::ConnectionFailed;
+#endif
+}
+
+// ============================================
+// DOSYA GÖNDERİMİ
+// ============================================
+
+/** @brief kTLS yokken dosya gönderiminde kullanılan buffer boyutu */
+static const size_t SEND_FILE_CHUNK_SIZE = 64 * 1024;
+
+/**
+ * @brief Dosyadan verilen konumdan oku (dosya konumunu değiştirmeden, POSIX)
+ *
+ * @return long long Okunan byte (0 = dosya sonu, -1 = hata)
+ */
+static long long readFileAt(int fd, void *buffer, size_t length, uint64_t offset) {
+#ifdef _WIN32
+
+  if (_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0) {
+    return -1;
+  }
+
+  return _read(fd, buffer, static_cast<unsigned int>(length));
+#else
+  ssize_t result;
+
+  do {
+    result = pread(fd, buffer, length, static_cast<off_t>(offset));
+  } while (result < 0 && errno == EINTR);
+
+  return result;
+#endif
+}
+
+bool isTLSKernelOffloaded(const TLSContext *ctx) {
+  if (!ctx || !ctx->isConnected || !ctx->sslConnection) {
+    return false;
+  }
+
+#ifdef TLS_HAS_KTLS_SENDFILE
+  return BIO_get_ktls_send(SSL_get_wbio(static_cast<SSL *>(ctx->sslConnection)));
+#else
+  return false;
+#endif
+}
+
+TravelExpense::ErrorCode sendFileTLS(TLSContext *ctx, int fd, uint64_t offset, size_t length, size_t &bytesSent) {
+  bytesSent = 0;
+
+  if (!ctx || fd < 0 || length == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (!ctx->isConnected || !ctx->sslConnection) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+#ifdef TLS_HAS_KTLS_SENDFILE
+  SSL *ssl = static_cast<SSL *>(ctx->sslConnection);
+
+  // kTLS: çekirdek dosyayı sayfa önbelleğinden şifreleyip gönderir
+  if (isTLSKernelOffloaded(ctx)) {
+    SigpipeGuard sigpipeGuard;
+
+    while (bytesSent < length) {
+      ossl_ssize_t sent = SSL_sendfile(ssl, fd, static_cast<off_t>(offset + bytesSent), length - bytesSent, 0);
+
+      if (sent <= 0) {
+        int error = SSL_get_error(ssl, static_cast<int>(sent));
+        ERR_clear_error();
+
+        if (updateWaitState(ctx, error)) {
+          return bytesSent > 0 ? ErrorCode::Success : ErrorCode::Busy;
+        }
+
+        return sent == 0 ? ErrorCode::FileIO : ErrorCode::ConnectionFailed;
+      }
+
+      bytesSent += static_cast<size_t>(sent);
+    }
+
+    updateWaitState(ctx, SSL_ERROR_NONE);
+    return ErrorCode::Success;
+  }
+
+#endif
+  // Yedek yol: sınırlı buffer ile oku/şifrele/gönder
+  std::vector<uint8_t> buffer(length < SEND_FILE_CHUNK_SIZE ? length : SEND_FILE_CHUNK_SIZE);
+
+  while (bytesSent < length) {
+    size_t chunk = length - bytesSent < buffer.size() ? length - bytesSent : buffer.size();
+    long long readBytes = readFileAt(fd, buffer.data(), chunk, offset + bytesSent);
+
+    if (readBytes <= 0) {
+      // Okuma hatası veya dosya istenen aralıktan kısa
+      return ErrorCode::FileIO;
+    }
+
+    size_t written = 0;
+    ErrorCode result = sendTLS(ctx, buffer.data(), static_cast<size_t>(readBytes), written);
+
+    if (result == ErrorCode::Busy) {
+      return bytesSent > 0 ? ErrorCode::Success : ErrorCode::Busy;
+    }
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+
+    bytesSent += written;
+
+    // Engellemeyen modda kısmi yazma: kalan kısım sonraki çağrıda
+    if (written < static_cast<size_t>(readBytes)) {
+      return ErrorCode::Success;
+    }
+  }
+
+  return ErrorCode::Success;
+}
+
+// ============================================
+// ENGELLEMEYEN (NON-BLOCKING) G/Ç
+// ============================================
+
+TravelExpense::ErrorCode setTLSNonBlocking(TLSContext *ctx, bool enabled) {
+  if (!ctx || !ctx->isInitialized) {
+    return ErrorCode::InvalidInput;
+  }
+
+  ctx->nonBlocking = enabled;
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL *ssl = static_cast<SSL *>(ctx->sslConnection);
+
+  if (ssl) {
+    setSocketNonBlocking(static_cast<SocketHandle>(SSL_get_fd(ssl)), enabled);
+
+    if (enabled) {
+      SSL_set_mode(ssl, NON_BLOCKING_SSL_MODES);
+    } else {
+      SSL_clear_mode(ssl, NON_BLOCKING_SSL_MODES);
+    }
+  }
+
+#endif
+  return ErrorCode::Success;
+}
+
+int getTLSSocket(const TLSContext *ctx) {
+  if (!ctx || !ctx->sslConnection) {
+    return -1;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  return SSL_get_fd(static_cast<SSL *>(ctx->sslConnection));
+#else
+  return -1;
+#endif
+}
+
+// ============================================
+// OLAY DÖNGÜSÜ
+// ============================================
+
+/** @brief Olay döngüsü işlem türü */
+enum class TLSOperationKind {
+  Connect,
+  Send,
+  Receive
+};
+
+/**
+ * @struct TLSOperation
+ * @brief Bağlam üzerinde bekleyen işlem
+ */
+struct TLSOperation {
+  TLSOperationKind kind;           /**< @brief İşlem türü */
+  TLSContext *ctx;                 /**< @brief Bağlam */
+  const uint8_t *data;             /**< @brief Gönderilecek veri (Send) */
+  uint8_t *buffer;                 /**< @brief Alım buffer'ı (Receive) */
+  size_t length;                   /**< @brief Veri/buffer uzunluğu */
+  size_t transferred;              /**< @brief Aktarılan byte */
+  TLSCompletionCallback callback;  /**< @brief Tamamlanma callback'i */
+  void *userData;                  /**< @brief Callback kullanıcı verisi */
+};
+
+/**
+ * @struct TLSEventLoop
+ * @brief Bağlam başına tek bekleyen işlem tutan olay döngüsü
+ *
+ * Yeni işlemler önce ready listesine alınıp denenir; engellenen işlemin
+ * soketi bağlamın wantRead/wantWrite durumuna göre beklenir.
+ */
+struct TLSEventLoop {
+  std::unordered_map<TLSContext *, TLSOperation> operations;  /**< @brief Bekleyen işlemler */
+  std::vector<TLSContext *> ready;                            /**< @brief Denenecek bağlamlar */
+#ifdef TLS_EVENT_LOOP_EPOLL
+  int epollFd;                                                /**< @brief epoll tanıtıcısı */
+  std::vector<epoll_event> events;                            /**< @brief epoll_wait çıktısı */
+#endif
+};
+
+/** @brief epoll_wait başına alınacak en fazla olay */
+static const size_t TLS_EVENT_BATCH = 256;
+
+/**
+ * @brief İşlemi ilerlet
+ *
+ * @param op İşlem
+ * @param result Sonuç (tamamlandıysa)
+ * @return bool İşlem tamamlandı mı (false = soket bekleniyor)
+ */
+static bool progressOperation(TLSOperation &op, ErrorCode &result) {
+  switch (op.kind) {
+    case TLSOperationKind::Connect:
+      result = continueConnectTLS(op.ctx);
+      return result != ErrorCode::Busy;
+
+    case TLSOperationKind::Send:
+      while (op.transferred < op.length) {
+        size_t sent = 0;
+        result = sendTLS(op.ctx, op.data + op.transferred, op.length - op.transferred, sent);
+
+        if (result == ErrorCode::Busy) {
+          return false;
+        }
+
+        if (result != ErrorCode::Success) {
+          return true;
+        }
+
+        op.transferred += sent;
+      }
+
+      result = ErrorCode::Success;
+      return true;
+
+    case TLSOperationKind::Receive:
+    default: {
+      size_t received = 0;
+      result = receiveTLS(op.ctx, op.buffer, op.length, received);
+      op.transferred = received;
+      return result != ErrorCode::Busy;
+    }
+  }
+}
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+/**
+ * @brief Engellenen işlemin soketini bekleme listesine al
+ *
+ * epoll'de kayıt EPOLLONESHOT ile yeniden kurulur; soket kapatılıp aynı
+ * numara yeniden kullanıldıysa (ENOENT) kayıt eklenir.
+ */
+static void armOperation(TLSEventLoop *loop, TLSContext *ctx) {
+#ifdef TLS_EVENT_LOOP_EPOLL
+  epoll_event event;
+  std::memset(&event, 0, sizeof(event));
+  event.events = EPOLLONESHOT | (ctx->wantWrite ? EPOLLOUT : 0u) | (ctx->wantRead || !ctx->wantWrite ? EPOLLIN : 0u);
+  event.data.ptr = ctx;
+  int socketHandle = getTLSSocket(ctx);
+
+  if (epoll_ctl(loop->epollFd, EPOLL_CTL_MOD, socketHandle, &event) != 0 && errno == ENOENT) {
+    epoll_ctl(loop->epollFd, EPOLL_CTL_ADD, socketHandle, &event);
+  }
+
+#else
+  // poll() her beklemede bekleyen tüm işlemlerden kurulur
+  (void)loop;
+  (void)ctx;
+#endif
+}
+
+/**
+ * @brief Soket olaylarını bekle ve hazır bağlamları ready listesine ekle
+ *
+ * @param loop Olay döngüsü
+ * @param timeoutMs Bekleme süresi (-1 = sınırsız)
+ */
+static void waitForEvents(TLSEventLoop *loop, int timeoutMs) {
+#ifdef TLS_EVENT_LOOP_EPOLL
+  int count = epoll_wait(loop->epollFd, loop->events.data(), static_cast<int>(loop->events.size()), timeoutMs);
+
+  for (int i = 0; i < count; ++i) {
+    loop->ready.push_back(static_cast<TLSContext *>(loop->events[static_cast<size_t>(i)].data.ptr));
+  }
+
+#else
+  std::vector<pollfd> fds;
+  std::vector<TLSContext *> owners;
+
+  for (std::unordered_map<TLSContext *, TLSOperation>::iterator it = loop->operations.begin();
+       it != loop->operations.end(); ++it) {
+    TLSContext *ctx = it->first;
+    pollfd socketPoll;
+    socketPoll.fd = static_cast<SocketHandle>(getTLSSocket(ctx));
+    socketPoll.events = static_cast<short>((ctx->wantWrite ? POLLOUT : 0) | (ctx->wantRead || !ctx->wantWrite ? POLLIN : 0));
+    socketPoll.revents = 0;
+    fds.push_back(socketPoll);
+    owners.push_back(ctx);
+  }
+
+  if (pollSockets(fds.data(), static_cast<unsigned long>(fds.size()), timeoutMs) > 0) {
+    for (size_t i = 0; i < fds.size(); ++i) {
+      if (fds[i].revents != 0) {
+        loop->ready.push_back(owners[i]);
+      }
+    }
+  }
+
+#endif
+}
+#endif
+
+/**
+ * @brief İşlemi döngüye ekle (bağlam başına tek işlem)
+ */
+static ErrorCode queueOperation(TLSEventLoop *loop, const TLSOperation &op) {
+  if (loop->operations.find(op.ctx) != loop->operations.end()) {
+    return ErrorCode::Busy;
+  }
+
+  loop->operations[op.ctx] = op;
+  loop->ready.push_back(op.ctx);
+  return ErrorCode::Success;
+}
+
+/** @brief İşlem kaydını doldur */
+static TLSOperation makeOperation(TLSOperationKind kind, TLSContext *ctx, TLSCompletionCallback callback,
+                                  void *userData) {
+  TLSOperation op;
+  std::memset(&op, 0, sizeof(op));
+  op.kind = kind;
+  op.ctx = ctx;
+  op.callback = callback;
+  op.userData = userData;
+  return op;
+}
+
+TravelExpense::ErrorCode createTLSEventLoop(TLSEventLoop **loop) {
+  if (!loop) {
+    return ErrorCode::InvalidInput;
+  }
+
+  *loop = nullptr;
+  TLSEventLoop *created = new TLSEventLoop();
+#ifdef TLS_EVENT_LOOP_EPOLL
+  created->epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+  if (created->epollFd < 0) {
+    delete created;
+    return ErrorCode::ConnectionFailed;
+  }
+
+  created->events.resize(TLS_EVENT_BATCH);
+#endif
+  *loop = created;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode destroyTLSEventLoop(TLSEventLoop *loop) {
+  if (!loop) {
+    return ErrorCode::InvalidInput;
+  }
+
+#ifdef TLS_EVENT_LOOP_EPOLL
+  close(loop->epollFd);
+#endif
+  delete loop;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode asyncConnectTLS(TLSEventLoop *loop, TLSContext *ctx, const char *hostname,
+    uint16_t port, TLSCompletionCallback callback, void *userData) {
+  if (!loop || !ctx || !ctx->isInitialized || !callback) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (loop->operations.find(ctx) != loop->operations.end()) {
+    return ErrorCode::Busy;
+  }
+
+  setTLSNonBlocking(ctx, true);
+  ErrorCode result = connectTLS(ctx, hostname, port);
+
+  // Adres çözümleme/soket hatası hemen döner; handshake sonucu callback ile gelir
+  if (result != ErrorCode::Success && result != ErrorCode::Busy) {
+    return result;
+  }
+
+  return queueOperation(loop, makeOperation(TLSOperationKind::Connect, ctx, callback, userData));
+}
+
+TravelExpense::ErrorCode asyncSendTLS(TLSEventLoop *loop, TLSContext *ctx, const void *data, size_t dataLen,
+                                      TLSCompletionCallback callback, void *userData) {
+  if (!loop || !ctx || !data || dataLen == 0 || !callback) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (!ctx->isConnected) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+  if (!ctx->nonBlocking) {
+    setTLSNonBlocking(ctx, true);
+  }
+
+  TLSOperation op = makeOperation(TLSOperationKind::Send, ctx, callback, userData);
+  op.data = static_cast<const uint8_t *>(data);
+  op.length = dataLen;
+  return queueOperation(loop, op);
+}
+
+TravelExpense::ErrorCode asyncReceiveTLS(TLSEventLoop *loop, TLSContext *ctx, void *buffer, size_t bufferLen,
+    TLSCompletionCallback callback, void *userData) {
+  if (!loop || !ctx || !buffer || bufferLen == 0 || !callback) {
+    return ErrorCode::InvalidInput;
+  }
+
+  if (!ctx->isConnected) {
+    return ErrorCode::ConnectionFailed;
+  }
+
+  if (!ctx->nonBlocking) {
+    setTLSNonBlocking(ctx, true);
+  }
+
+  TLSOperation op = makeOperation(TLSOperationKind::Receive, ctx, callback, userData);
+  op.buffer = static_cast<uint8_t *>(buffer);
+  op.length = bufferLen;
+  return queueOperation(loop, op);
+}
+
+TravelExpense::ErrorCode cancelTLSOperation(TLSEventLoop *loop, TLSContext *ctx) {
+  if (!loop || !ctx) {
+    return ErrorCode::InvalidInput;
+  }
+
+  // ready listesinde kalan kayıt, işlem bulunamadığı için yok sayılır
+  loop->operations.erase(ctx);
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode runTLSEventLoop(TLSEventLoop *loop, int timeoutMs) {
+  if (!loop) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(timeoutMs > 0 ? timeoutMs : 0);
+
+  for (;;) {
+    // Hazır işlemleri ilerlet; callback'ler aynı bağlam için yeni işlem ekleyebilir
+    while (!loop->ready.empty()) {
+      TLSContext *ctx = loop->ready.back();
+      loop->ready.pop_back();
+      std::unordered_map<TLSContext *, TLSOperation>::iterator it = loop->operations.find(ctx);
+
+      if (it == loop->operations.end()) {
+        continue;
+      }
+
+      ErrorCode result = ErrorCode::Success;
+
+      if (!progressOperation(it->second, result)) {
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+        armOperation(loop, ctx);
+#endif
+        continue;
+      }
+
+      TLSOperation done = it->second;
+      loop->operations.erase(it);
+      done.callback(ctx, result, done.transferred, done.userData);
+    }
+
+    if (loop->operations.empty()) {
+      return ErrorCode::Success;
+    }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+    int waitMs = -1;
+
+    if (timeoutMs >= 0) {
+      long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              deadline - std::chrono::steady_clock::now()).count();
+
+      if (remaining <= 0) {
+        return ErrorCode::Busy;
+      }
+
+      waitMs = static_cast<int>(remaining);
+    }
+
+    waitForEvents(loop, waitMs);
+#else
+    // OpenSSL olmadan bağlantı kurulamadığından bekleyen işlem olamaz
+    (void)deadline;
+    return ErrorCode::ConnectionFailed;
+#endif
+  }
+}
+
+// ============================================
+// OTURUM DEVAMI (SESSION RESUMPTION)
+// ============================================
+
+TravelExpense::ErrorCode setTLSSessionResumption(TLSContext *ctx, bool enabled) {
+  if (!ctx || !ctx->isInitialized) {
+    return ErrorCode::InvalidInput;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  TLSSessionCache *cache = sessionCacheOf(static_cast<SSL_CTX *>(ctx->sslContext));
+
+  if (cache) {
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    cache->enabled = enabled;
+
+    if (!enabled) {
+      cache->clear();
+    }
+  }
+
+#else
+  (void)enabled;
+#endif
+  return ErrorCode::Success;
+}
+
+bool isTLSSessionResumed(const TLSContext *ctx) {
+  if (!ctx || !ctx->isConnected || !ctx->sslConnection) {
+    return false;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  return SSL_session_reused(static_cast<SSL *>(ctx->sslConnection)) == 1;
+#else
+  return false;
+#endif
+}
+
+// ============================================
+// BAĞLANTI HAVUZU
+// ============================================
+
+/**
+ * @struct PooledConnection
+ * @brief Havuzda boşta bekleyen bağlantı
+ */
+struct PooledConnection {
+  TLSContext *connection;                             /**< @brief Bağlı TLS bağlamı */
+  std::chrono::steady_clock::time_point releasedAt;  /**< @brief Havuza geri verilme zamanı */
+};
+
+/**
+ * @struct TLSConnectionPool
+ * @brief hostname:port -> boşta bağlantılar (en son bırakılan sonda)
+ */
+struct TLSConnectionPool {
+  TLSContext config;         /**< @brief Şablon bağlamın paylaşılan kopyası (SSL_CTX referansı) */
+  size_t maxIdlePerHost;     /**< @brief Anahtar başına en fazla boşta bağlantı */
+  uint32_t idleTimeoutMs;    /**< @brief Boşta bekleme sınırı (0 = sınırsız) */
+  std::mutex mutex;          /**< @brief idle ve stats kilidi */
+  std::map<std::string, std::vector<PooledConnection> > idle;  /**< @brief Boşta bağlantılar */
+  TLSConnectionPoolStats stats;                                /**< @brief İstatistikler */
+
+  TLSConnectionPool() : maxIdlePerHost(0), idleTimeoutMs(0) {
+    std::memset(&config, 0, sizeof(config));
+    std::memset(&stats, 0, sizeof(stats));
+  }
+};
+
+/**
+ * @brief Havuz bağlantısını kapat ve serbest bırak
+ */
+static void closePooledConnection(TLSContext *connection) {
+  cleanupTLSContext(connection);
+  delete connection;
+}
+
+/**
+ * @brief Boşta bağlantı hâlâ kullanılabilir mi
+ *
+ * Sokette okunacak veri yoksa bağlantı canlıdır. Veri varsa yalnızca
+ * handshake sonrası kayıtlar (TLS 1.3 session ticket) kabul edilir;
+ * bunlar engellemeden işlenir. close_notify, TCP kapanışı veya beklenmeyen
+ * uygulama verisi bağlantıyı kullanılamaz kılar.
+ */
+static bool isPooledConnectionAlive(TLSContext *connection) {
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL *ssl = static_cast<SSL *>(connection->sslConnection);
+
+  if (!connection->isConnected || !ssl) {
+    return false;
+  }
+
+  SocketHandle socketHandle = static_cast<SocketHandle>(SSL_get_fd(ssl));
+  pollfd socketPoll;
+  socketPoll.fd = socketHandle;
+  socketPoll.events = POLLIN;
+  socketPoll.revents = 0;
+  int ready = pollSockets(&socketPoll, 1, 0);
+
+  if (ready == 0) {
+    return true;
+  }
+
+  if (ready < 0 || (socketPoll.revents & (POLLERR | POLLHUP | POLLNVAL)) != 0) {
+    return false;
+  }
+
+  setSocketNonBlocking(socketHandle, true);
+  unsigned char byte = 0;
+  size_t peeked = 0;
+  int peekResult;
+  {
+    SigpipeGuard sigpipeGuard;
+    peekResult = SSL_peek_ex(ssl, &byte, 1, &peeked);
+  }
+  int error = peekResult == 1 ? SSL_ERROR_NONE : SSL_get_error(ssl, peekResult);
+  setSocketNonBlocking(socketHandle, connection->nonBlocking);
+  ERR_clear_error();
+  return error == SSL_ERROR_WANT_READ;
+#else
+  (void)connection;
+  return false;
+#endif
+}
+
+TravelExpense::ErrorCode createTLSConnectionPool(const TLSContext *config, size_t maxIdlePerHost,
+    uint32_t idleTimeoutMs, TLSConnectionPool **pool) {
+  if (pool) {
+    *pool = nullptr;
+  }
+
+  if (!config || !config->isInitialized || !pool || maxIdlePerHost == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  TLSConnectionPool *created = new TLSConnectionPool();
+  initializeSharedTLSContext(&created->config, config);
+  created->maxIdlePerHost = maxIdlePerHost;
+  created->idleTimeoutMs = idleTimeoutMs;
+  *pool = created;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode acquireTLSConnection(TLSConnectionPool *pool, const char *hostname,
+    uint16_t port, TLSContext **connection) {
+  if (connection) {
+    *connection = nullptr;
+  }
+
+  if (!pool || !hostname || !hostname[0] || port == 0 || !connection) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::string key = sessionKey(hostname, port);
+
+  // Boşta bağlantılar en yeniden eskiye denenir
+  for (;;) {
+    TLSContext *candidate = nullptr;
+    bool expired = false;
+    {
+      std::lock_guard<std::mutex> lock(pool->mutex);
+      std::map<std::string, std::vector<PooledConnection> >::iterator it = pool->idle.find(key);
+
+      if (it == pool->idle.end() || it->second.empty()) {
+        break;
+      }
+
+      PooledConnection pooled = it->second.back();
+      it->second.pop_back();
+      --pool->stats.idleConnections;
+      candidate = pooled.connection;
+      expired = pool->idleTimeoutMs != 0 &&
+                std::chrono::steady_clock::now() - pooled.releasedAt >
+                std::chrono::milliseconds(pool->idleTimeoutMs);
+    }
+
+    if (!expired && isPooledConnectionAlive(candidate)) {
+      std::lock_guard<std::mutex> lock(pool->mutex);
+      ++pool->stats.reused;
+      ++pool->stats.activeConnections;
+      *connection = candidate;
+      return ErrorCode::Success;
+    }
+
+    closePooledConnection(candidate);
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    ++pool->stats.discarded;
+  }
+
+  // Yeni bağlantı havuzun SSL_CTX'i ile açılır (oturum önbelleği ortak)
+  TLSContext *created = new TLSContext();
+  initializeSharedTLSContext(created, &pool->config);
+  ErrorCode result = connectTLS(created, hostname, port);
+
+  if (result != ErrorCode::Success) {
+    closePooledConnection(created);
+    return result;
+  }
+
+  bool resumed = isTLSSessionResumed(created);
+  std::lock_guard<std::mutex> lock(pool->mutex);
+  ++(resumed ? pool->stats.resumedHandshakes : pool->stats.fullHandshakes);
+  ++pool->stats.activeConnections;
+  *connection = created;
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode releaseTLSConnection(TLSConnectionPool *pool, TLSContext *connection,
+    bool reusable) {
+  if (!pool || !connection) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::string key = sessionKey(connection->serverHostname, connection->serverPort);
+  {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+
+    if (pool->stats.activeConnections > 0) {
+      --pool->stats.activeConnections;
+    }
+
+    if (reusable && connection->isConnected) {
+      std::vector<PooledConnection> &connections = pool->idle[key];
+
+      if (connections.size() < pool->maxIdlePerHost) {
+        PooledConnection pooled;
+        pooled.connection = connection;
+        pooled.releasedAt = std::chrono::steady_clock::now();
+        connections.push_back(pooled);
+        ++pool->stats.idleConnections;
+        return ErrorCode::Success;
+      }
+    }
+
+    ++pool->stats.discarded;
+  }
+  closePooledConnection(connection);
   return ErrorCode::Success;
 }
 
-TravelExpense::ErrorCode cleanupTLSContext(TLSContext *ctx) {
-  if (!ctx) {
+TravelExpense::ErrorCode destroyTLSConnectionPool(TLSConnectionPool *pool) {
+  if (!pool) {
     return ErrorCode::InvalidInput;
   }
 
-  // Bağlantıyı kapat
-  if (ctx->isConnected) {
-    disconnectTLS(ctx);
+  for (std::map<std::string, std::vector<PooledConnection> >::iterator it = pool->idle.begin();
+       it != pool->idle.end(); ++it) {
+    for (size_t i = 0; i < it->second.size(); ++i) {
+      closePooledConnection(it->second[i].connection);
+    }
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL temizliği yapılmalı
-  // if (ctx->sslConnection) {
-  //     SSL_free((SSL*)ctx->sslConnection);
-  //     ctx->sslConnection = nullptr;
-  // }
-  // if (ctx->sslContext) {
-  //     SSL_CTX_free((SSL_CTX*)ctx->sslContext);
-  //     ctx->sslContext = nullptr;
-  // }
-  // Bağlamı sıfırla
-  std::memset(ctx, 0, sizeof(TLSContext));
+  cleanupTLSContext(&pool->config);
+  delete pool;
   return ErrorCode::Success;
 }
 
-TravelExpense::ErrorCode connectTLS(TLSContext *ctx, const char *hostname, uint16_t port) {
-  if (!ctx || !hostname || !ctx->isInitialized) {
+TravelExpense::ErrorCode getTLSConnectionPoolStats(TLSConnectionPool *pool, TLSConnectionPoolStats &stats) {
+  if (!pool) {
     return ErrorCode::InvalidInput;
   }
 
-  // Hostname ve port'u kaydet
-  SafeString::safeCopy(ctx->serverHostname, sizeof(ctx->serverHostname), hostname);
-  ctx->serverPort = port;
-  // NOT: Gerçek implementasyonda OpenSSL ile TLS bağlantısı kurulmalı
-  // Bu örnek sadece temel yapıyı gösterir:
-  //
-  // 1. Socket oluştur ve bağlan
-  // 2. SSL_new() ile SSL bağlantısı oluştur
-  // 3. SSL_set_fd() ile socket'i SSL'e bağla
-  // 4. SSL_connect() ile TLS handshake yap
-  // 5. Certificate pinning kontrolü yap
-  // Stub implementasyon:
-  ctx->isConnected = true;
-  // Certificate pinning kontrolü yap
-  TravelExpense::ErrorCode pinResult = verifyCertificatePin(ctx, hostname);
+  std::lock_guard<std::mutex> lock(pool->mutex);
+  stats = pool->stats;
+  return ErrorCode::Success;
+}
 
-  if (pinResult != ErrorCode::Success) {
-    // Certificate pinning başarısız - bağlantıyı kapat
-    disconnectTLS(ctx);
-    return ErrorCode::SecurityFailed;
+// ============================================
+// CERTIFICATE PINNING
+// ============================================
+
+/**
+ * @brief Hostname hash'i (FNV-1a, 64 bit)
+ */
+static uint64_t hashHostname(const char *hostname, size_t length) {
+  uint64_t hash = 1469598103934665603ull;
+
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<unsigned char>(hostname[i]);
+    hash *= 1099511628211ull;
   }
 
-  return ErrorCode::Success;
+  return hash;
 }
 
-TravelExpense::ErrorCode disconnectTLS(TLSContext *ctx) {
-  if (!ctx) {
-    return ErrorCode::InvalidInput;
+/**
+ * @brief Tabloda hostname'in pin'ini bul
+ *
+ * @return const CertificatePin* Pin (yoksa nullptr)
+ */
+static const CertificatePin *findPin(const PinTable &table, const char *hostname, size_t length) {
+  if (table.slots.empty()) {
+    return nullptr;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL bağlantı kapatılmalı
-  // if (ctx->sslConnection) {
-  //     SSL_shutdown((SSL*)ctx->sslConnection);
-  //     SSL_free((SSL*)ctx->sslConnection);
-  //     ctx->sslConnection = nullptr;
-  // }
-  ctx->isConnected = false;
-  return ErrorCode::Success;
+  uint64_t hash = hashHostname(hostname, length);
+  size_t mask = table.slots.size() - 1;
+
+  for (size_t index = static_cast<size_t>(hash) & mask;; index = (index + 1) & mask) {
+    const PinTable::Slot &slot = table.slots[index];
+
+    if (!slot.used) {
+      return nullptr;
+    }
+
+    if (slot.hash == hash && slot.hostnameLength == length &&
+        std::memcmp(slot.pin.hostname, hostname, length) == 0) {
+      return &slot.pin;
+    }
+  }
 }
 
-TravelExpense::ErrorCode sendTLS(TLSContext *ctx, const void *data, size_t dataLen, size_t &bytesSent) {
-  if (!ctx || !data || dataLen == 0) {
-    return ErrorCode::InvalidInput;
+/**
+ * @brief Ana kopyadan yeni tablo oluştur ve yayınla (writeMutex alınmış olmalı)
+ */
+static void publishPinsLocked() {
+  std::shared_ptr<PinTable> table = std::make_shared<PinTable>();
+  size_t capacity = 8;
+
+  while (capacity < g_pinStore.pins.size() * 2) {
+    capacity *= 2;
   }
 
-  if (!ctx->isConnected) {
-    return ErrorCode::ConnectionFailed;
+  PinTable::Slot empty;
+  std::memset(&empty, 0, sizeof(empty));
+  table->slots.assign(capacity, empty);
+
+  for (std::map<std::string, CertificatePin>::const_iterator it = g_pinStore.pins.begin();
+       it != g_pinStore.pins.end(); ++it) {
+    uint64_t hash = hashHostname(it->first.data(), it->first.size());
+    size_t index = static_cast<size_t>(hash) & (capacity - 1);
+
+    while (table->slots[index].used) {
+      index = (index + 1) & (capacity - 1);
+    }
+
+    PinTable::Slot &slot = table->slots[index];
+    slot.hash = hash;
+    slot.hostnameLength = it->first.size();
+    slot.pin = it->second;
+    slot.used = true;
   }
 
-  bytesSent = dataLen;
-  return ErrorCode::Success;
+  std::atomic_store(&g_pinStore.snapshot, std::shared_ptr<const PinTable>(table));
+  g_pinStore.version.fetch_add(1, std::memory_order_release);
 }
 
-TravelExpense::ErrorCode receiveTLS(TLSContext *ctx, void *buffer, size_t bufferLen, size_t &bytesReceived) {
-  if (!ctx || !buffer || bufferLen == 0) {
-    return ErrorCode::InvalidInput;
-  }
+/**
+ * @struct PinSnapshotCache
+ * @brief Thread'in kullandığı pin tablosu ve sürümü
+ */
+struct PinSnapshotCache {
+  uint64_t version;                       /**< @brief table'ın yayın sürümü */
+  std::shared_ptr<const PinTable> table;  /**< @brief Tablo (referans thread'e ait) */
 
-  if (!ctx->isConnected) {
-    return ErrorCode::ConnectionFailed;
+  PinSnapshotCache() : version(0) {}
+};
+
+/**
+ * @brief Güncel pin tablosunu al
+ *
+ * Sürüm değişmediyse thread-local kopya döner; yalnızca yayından sonraki
+ * ilk okumada paylaşılan işaretçi yüklenir.
+ *
+ * @return const PinTable* Tablo (hiç pin kaydedilmediyse nullptr); aynı
+ *         thread'de bir sonraki çağrıya kadar geçerli
+ */
+static const PinTable *currentPinTable() {
+  static thread_local PinSnapshotCache cache;
+  uint64_t version = g_pinStore.version.load(std::memory_order_acquire);
+
+  if (cache.version != version) {
+    cache.table = std::atomic_load(&g_pinStore.snapshot);
+    cache.version = version;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL SSL_read() çağrısı yapılmalı
-  // int result = SSL_read((SSL*)ctx->sslConnection, buffer, static_cast<int>(bufferLen));
-  // if (result <= 0) {
-  //     return TravelExpense::ErrorCode::ConnectionFailed;
-  // }
-  // bytesReceived = static_cast<size_t>(result);
-  // Stub implementasyon:
-  bytesReceived = 0;
-  return ErrorCode::Success;
+  return cache.table.get();
 }
 
-// ============================================
-// CERTIFICATE PINNING
-// ============================================
-
 TravelExpense::ErrorCode registerCertificatePin(const CertificatePin *pin) {
   if (!pin || !pin->hostname[0]) {
     return ErrorCode::InvalidInput;
   }
 
-  std::lock_guard<std::mutex> lock(g_pinsMutex);
-  // Pin bilgisini kaydet
-  std::string hostname(pin->hostname);
-  g_certificatePins[hostname] = *pin;
+  // Pin bilgisini kaydet (hostname sonlandırıcısı garanti edilir)
+  CertificatePin stored = *pin;
+  stored.hostname[sizeof(stored.hostname) - 1] = '\0';
+  std::lock_guard<std::mutex> lock(g_pinStore.writeMutex);
+  g_pinStore.pins[std::string(stored.hostname)] = stored;
+  publishPinsLocked();
+  return ErrorCode::Success;
+}
+
+TravelExpense::ErrorCode removeCertificatePin(const char *hostname) {
+  if (!hostname || !hostname[0]) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::lock_guard<std::mutex> lock(g_pinStore.writeMutex);
+
+  if (g_pinStore.pins.erase(std::string(hostname)) > 0) {
+    publishPinsLocked();
+  }
+
   return ErrorCode::Success;
 }
 
@@ -182,17 +1916,16 @@ TravelExpense::ErrorCode verifyCertificatePin(TLSContext *ctx, const char *hostn
     return ErrorCode::InvalidInput;
   }
 
-  std::lock_guard<std::mutex> lock(g_pinsMutex);
-  // Hostname için pin kaydı var mı kontrol et
-  std::string hostnameStr(hostname);
-  auto it = g_certificatePins.find(hostnameStr);
+  // Hostname için pin kaydı var mı kontrol et (kilitsiz)
+  const PinTable *table = currentPinTable();
+  const CertificatePin *pin = table ? findPin(*table, hostname, std::strlen(hostname)) : nullptr;
 
-  if (it == g_certificatePins.end()) {
+  if (!pin) {
     // Pin kaydı yok - geçerli kabul et (pin zorunlu değilse)
     return ErrorCode::Success;
   }
 
-  const CertificatePin &expectedPin = it->second;
+  const CertificatePin &expectedPin = *pin;
   // Sunucu sertifikasının fingerprint'ini al
   char actualFingerprint[65] = {0};
 
@@ -243,26 +1976,20 @@ TravelExpense::ErrorCode getCertificateFingerprint(TLSContext *ctx, char *finger
     return ErrorCode::InvalidInput;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL ile sertifika fingerprint'i alınmalı
-  // X509* cert = SSL_get_peer_certificate((SSL*)ctx->sslConnection);
-  // if (!cert) {
-  //     return TravelExpense::ErrorCode::SecurityFailed;
-  // }
-  //
-  // // Sertifika fingerprint'ini hesapla (SHA-256)
-  // unsigned char hash[SHA256_DIGEST_LENGTH];
-  // unsigned int hashLen;
-  // X509_digest(cert, EVP_sha256(), hash, &hashLen);
-  // X509_free(cert);
-  //
-  // // Hex string'e çevir
-  // for (int i = 0; i < SHA256_DIGEST_LENGTH; ++i) {
-  //     sprintf(&fingerprint[i * 2], "%02x", hash[i]);
-  // }
-  // Stub implementasyon:
-  // Gerçek uygulamada sunucu sertifikasından fingerprint hesaplanır
   std::memset(fingerprint, 0, 65);
-  return ErrorCode::Success;
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  X509 *cert = peerCertificate(ctx);
+
+  if (!cert) {
+    return ErrorCode::SecurityFailed;
+  }
+
+  bool ok = certificateFingerprint(cert, fingerprint);
+  X509_free(cert);
+  return ok ? ErrorCode::Success : ErrorCode::SecurityFailed;
+#else
+  return ErrorCode::ConnectionFailed;
+#endif
 }
 
 TravelExpense::ErrorCode getCertificatePublicKeyHash(TLSContext *ctx, char *publicKeyHash) {
@@ -270,34 +1997,20 @@ TravelExpense::ErrorCode getCertificatePublicKeyHash(TLSContext *ctx, char *publ
     return ErrorCode::InvalidInput;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL ile public key hash'i alınmalı
-  // X509* cert = SSL_get_peer_certificate((SSL*)ctx->sslConnection);
-  // if (!cert) {
-  //     return TravelExpense::ErrorCode::SecurityFailed;
-  // }
-  //
-  // EVP_PKEY* pkey = X509_get_pubkey(cert);
-  // if (!pkey) {
-  //     X509_free(cert);
-  //     return TravelExpense::ErrorCode::SecurityFailed;
-  // }
-  //
-  // // Public key hash'ini hesapla (SHA-256)
-  // unsigned char hash[SHA256_DIGEST_LENGTH];
-  // unsigned int hashLen;
-  // // Public key'den hash hesapla
-  // // ...
-  // EVP_PKEY_free(pkey);
-  // X509_free(cert);
-  //
-  // // Hex string'e çevir
-  // for (int i = 0; i < SHA256_DIGEST_LENGTH; ++i) {
-  //     sprintf(&publicKeyHash[i * 2], "%02x", hash[i]);
-  // }
-  // Stub implementasyon:
-  // Gerçek uygulamada sunucu sertifikasının public key'inden hash hesaplanır
   std::memset(publicKeyHash, 0, 65);
-  return ErrorCode::Success;
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  X509 *cert = peerCertificate(ctx);
+
+  if (!cert) {
+    return ErrorCode::SecurityFailed;
+  }
+
+  bool ok = certificatePublicKeyHash(cert, publicKeyHash);
+  X509_free(cert);
+  return ok ? ErrorCode::Success : ErrorCode::SecurityFailed;
+#else
+  return ErrorCode::ConnectionFailed;
+#endif
 }
 
 // ============================================
@@ -314,15 +2027,27 @@ TravelExpense::ErrorCode loadClientCertificate(TLSContext *ctx, const char *cert
     return ErrorCode::InvalidInput;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL ile istemci sertifikası yüklenmeli
-  // SSL_CTX_use_certificate_file((SSL_CTX*)ctx->sslContext, certPath, SSL_FILETYPE_PEM);
-  // if (keyPassword) {
-  //     SSL_CTX_set_default_passwd_cb_userdata((SSL_CTX*)ctx->sslContext, (void*)keyPassword);
-  // }
-  // SSL_CTX_use_PrivateKey_file((SSL_CTX*)ctx->sslContext, keyPath, SSL_FILETYPE_PEM);
-  // SSL_CTX_check_private_key((SSL_CTX*)ctx->sslContext);
-  // Stub implementasyon:
-  // Gerçek uygulamada OpenSSL ile sertifika yüklenir
+  if (!pathExists(certPath, nullptr) || !pathExists(keyPath, nullptr)) {
+    return ErrorCode::FileNotFound;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL_CTX *sslContext = static_cast<SSL_CTX *>(ctx->sslContext);
+  // Varsayılan parola callback'i userdata'yı parola olarak kullanır
+  SSL_CTX_set_default_passwd_cb_userdata(sslContext, const_cast<char *>(keyPassword));
+  bool loaded = SSL_CTX_use_certificate_chain_file(sslContext, certPath) == 1 &&
+                SSL_CTX_use_PrivateKey_file(sslContext, keyPath, SSL_FILETYPE_PEM) == 1 &&
+                SSL_CTX_check_private_key(sslContext) == 1;
+  SSL_CTX_set_default_passwd_cb_userdata(sslContext, nullptr);
+  ERR_clear_error();
+
+  if (!loaded) {
+    return ErrorCode::SecurityFailed;
+  }
+
+#else
+  (void)keyPassword;
+#endif
   return ErrorCode::Success;
 }
 
@@ -335,12 +2060,23 @@ TravelExpense::ErrorCode setCAPath(TLSContext *ctx, const char *caPath) {
     return ErrorCode::InvalidInput;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL ile CA sertifika yolu ayarlanmalı
-  // SSL_CTX_load_verify_locations((SSL_CTX*)ctx->sslContext, caPath, nullptr);
-  // veya
-  // SSL_CTX_load_verify_locations((SSL_CTX*)ctx->sslContext, nullptr, caPath);
-  // Stub implementasyon:
-  // Gerçek uygulamada OpenSSL ile CA yolu ayarlanır
+  bool isDirectory = false;
+
+  if (!pathExists(caPath, &isDirectory)) {
+    return ErrorCode::FileNotFound;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL_CTX *sslContext = static_cast<SSL_CTX *>(ctx->sslContext);
+  int loaded = isDirectory ? SSL_CTX_load_verify_locations(sslContext, nullptr, caPath)
+               : SSL_CTX_load_verify_locations(sslContext, caPath, nullptr);
+  ERR_clear_error();
+
+  if (loaded != 1) {
+    return ErrorCode::SecurityFailed;
+  }
+
+#endif
   return ErrorCode::Success;
 }
 
@@ -353,13 +2089,20 @@ TravelExpense::ErrorCode verifyServerCertificate(TLSContext *ctx) {
     return ErrorCode::ConnectionFailed;
   }
 
-  // NOT: Gerçek implementasyonda OpenSSL ile sunucu sertifikası doğrulanmalı
-  // long verifyResult = SSL_get_verify_result((SSL*)ctx->sslConnection);
-  // if (verifyResult != X509_V_OK) {
-  //     return ErrorCode::ERROR_SECURITY_FAILED;
-  // }
-  // Stub implementasyon:
-  // Gerçek uygulamada OpenSSL ile sertifika doğrulaması yapılır
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  X509 *cert = peerCertificate(ctx);
+
+  if (!cert) {
+    return ErrorCode::SecurityFailed;
+  }
+
+  X509_free(cert);
+
+  if (SSL_get_verify_result(static_cast<SSL *>(ctx->sslConnection)) != X509_V_OK) {
+    return ErrorCode::SecurityFailed;
+  }
+
+#endif
   return ErrorCode::Success;
 }
 
@@ -373,6 +2116,391 @@ TravelExpense::ErrorCode calculateCertificateFingerprint(const char *certPath, c
   }
 
   std::memset(fingerprint, 0, 65);
+
+  if (!pathExists(certPath, nullptr)) {
+    return ErrorCode::FileNotFound;
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  BIO *file = BIO_new_file(certPath, "rb");
+
+  if (!file) {
+    ERR_clear_error();
+    return ErrorCode::FileIO;
+  }
+
+  // Önce PEM, olmazsa DER olarak oku
+  X509 *cert = PEM_read_bio_X509(file, nullptr, nullptr, nullptr);
+
+  if (!cert) {
+    BIO_reset(file);
+    cert = d2i_X509_bio(file, nullptr);
+  }
+
+  BIO_free(file);
+  ERR_clear_error();
+
+  if (!cert) {
+    return ErrorCode::InvalidInput;
+  }
+
+  bool ok = certificateFingerprint(cert, fingerprint);
+  X509_free(cert);
+  return ok ? ErrorCode::Success : ErrorCode::InvalidInput;
+#else
+  return ErrorCode::Unknown;
+#endif
+}
+
+// ============================================
+// YEREL TEST SUNUCUSU (LOOPBACK)
+// ============================================
+
+/**
+ * @struct TLSTestServer
+ * @brief 127.0.0.1 üzerinde çalışan echo TLS sunucusu
+ *
+ * Her bağlantı kendi thread'inde işlenir; alınan veri aynen geri gönderilir.
+ */
+struct TLSTestServer {
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL_CTX *context;                   /**< @brief Sunucu SSL bağlamı (test sertifikası yüklü) */
+#endif
+  SocketHandle listener;              /**< @brief Dinleyen soket */
+  std::atomic<bool> stopping;         /**< @brief Durdurma isteği */
+  std::thread acceptThread;           /**< @brief Bağlantı kabul thread'i */
+  std::mutex mutex;                   /**< @brief clients kilidi */
+  std::vector<SocketHandle> clients;  /**< @brief Açık bağlantılar (durdururken uyandırmak için) */
+  std::vector<std::thread> workers;   /**< @brief Bağlantı thread'leri (yalnızca acceptThread ekler) */
+  std::vector<std::thread::id> finished;  /**< @brief Biten, henüz join edilmemiş bağlantı thread'leri */
+
+  TLSTestServer() : listener(INVALID_SOCKET_HANDLE), stopping(false) {}
+};
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+/** @brief Test sunucusu kabul döngüsünün durdurma kontrol aralığı */
+static const int TEST_SERVER_POLL_MS = 50;
+
+/**
+ * @brief Test anahtarı üret (ECDSA P-256)
+ */
+static EVP_PKEY *generateTestKey() {
+  EVP_PKEY *key = nullptr;
+  EVP_PKEY_CTX *keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+
+  if (keyContext && EVP_PKEY_keygen_init(keyContext) == 1 &&
+      EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1) == 1) {
+    EVP_PKEY_keygen(keyContext, &key);
+  }
+
+  EVP_PKEY_CTX_free(keyContext);
+  return key;
+}
+
+/**
+ * @brief Test sertifikası oluştur ve imzala
+ *
+ * issuer nullptr ise self-signed CA sertifikası, aksi halde localhost ve
+ * 127.0.0.1 için geçerli sunucu sertifikası üretilir. Geçerlilik 1 gündür.
+ *
+ * @param key Sertifikanın anahtarı
+ * @param commonName CN alanı
+ * @param issuer İmzalayan CA sertifikası (nullptr = self-signed CA)
+ * @param issuerKey İmzalayan anahtar (nullptr = key)
+ * @param serial Seri numarası
+ * @return X509* Sertifika (hata durumunda nullptr)
+ */
+static X509 *issueTestCertificate(EVP_PKEY *key, const char *commonName,
+                                  X509 *issuer, EVP_PKEY *issuerKey, long serial) {
+  X509 *cert = X509_new();
+
+  if (!cert) {
+    return nullptr;
+  }
+
+  X509_set_version(cert, 2);
+  ASN1_INTEGER_set(X509_get_serialNumber(cert), serial);
+  X509_gmtime_adj(X509_getm_notBefore(cert), -300);
+  X509_gmtime_adj(X509_getm_notAfter(cert), 24 * 3600);
+  X509_set_pubkey(cert, key);
+  X509_NAME *name = X509_get_subject_name(cert);
+  X509_NAME_add_entry_by_txt(name, "O", MBSTRING_ASC,
+                             reinterpret_cast<const unsigned char *>("TravelExpense Test"), -1, -1, 0);
+  X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                             reinterpret_cast<const unsigned char *>(commonName), -1, -1, 0);
+  X509_set_issuer_name(cert, issuer ? X509_get_subject_name(issuer) : name);
+  X509V3_CTX extensionContext;
+  X509V3_set_ctx_nodb(&extensionContext);
+  X509V3_set_ctx(&extensionContext, issuer ? issuer : cert, cert, nullptr, nullptr, 0);
+  struct Extension {
+    int nid;
+    const char *value;
+  };
+  static const Extension caExtensions[] = {
+    {NID_basic_constraints, "critical,CA:TRUE"},
+    {NID_key_usage, "critical,keyCertSign,cRLSign"},
+    {NID_subject_key_identifier, "hash"}
+  };
+  static const Extension serverExtensions[] = {
+    {NID_basic_constraints, "critical,CA:FALSE"},
+    {NID_key_usage, "critical,digitalSignature"},
+    {NID_ext_key_usage, "serverAuth"},
+    {NID_subject_alt_name, "DNS:localhost,IP:127.0.0.1"},
+    {NID_authority_key_identifier, "keyid"}
+  };
+  const Extension *extensions = issuer ? serverExtensions : caExtensions;
+  size_t extensionCount = issuer ? sizeof(serverExtensions) / sizeof(serverExtensions[0])
+                          : sizeof(caExtensions) / sizeof(caExtensions[0]);
+  bool ok = true;
+
+  for (size_t i = 0; ok && i < extensionCount; ++i) {
+    X509_EXTENSION *extension = X509V3_EXT_conf_nid(nullptr, &extensionContext, extensions[i].nid,
+                                extensions[i].value);
+    ok = extension && X509_add_ext(cert, extension, -1) == 1;
+    X509_EXTENSION_free(extension);
+  }
+
+  if (!ok || X509_sign(cert, issuerKey ? issuerKey : key, EVP_sha256()) <= 0) {
+    X509_free(cert);
+    return nullptr;
+  }
+
+  return cert;
+}
+
+/**
+ * @brief Tek bağlantıyı işle: TLS handshake ve echo döngüsü
+ */
+static void serveTestConnection(TLSTestServer *server, SocketHandle client) {
+  SigpipeGuard sigpipeGuard;
+  SSL *ssl = SSL_new(server->context);
+
+  if (ssl) {
+    SSL_set_fd(ssl, static_cast<int>(client));
+
+    if (SSL_accept(ssl) == 1) {
+      unsigned char buffer[16 * 1024];
+      size_t received = 0;
+
+      while (!server->stopping.load() && SSL_read_ex(ssl, buffer, sizeof(buffer), &received) == 1) {
+        size_t written = 0;
+
+        if (SSL_write_ex(ssl, buffer, received, &written) != 1) {
+          break;
+        }
+      }
+
+      SSL_shutdown(ssl);
+    }
+
+    SSL_free(ssl);
+    ERR_clear_error();
+  }
+
+  // Soket listeden çıkarılıp öyle kapatılır; stop() kapanmış bir tanıtıcıya dokunmaz
+  std::lock_guard<std::mutex> lock(server->mutex);
+
+  for (size_t i = 0; i < server->clients.size(); ++i) {
+    if (server->clients[i] == client) {
+      server->clients.erase(server->clients.begin() + static_cast<std::ptrdiff_t>(i));
+      break;
+    }
+  }
+
+  closeSocket(client);
+  server->finished.push_back(std::this_thread::get_id());
+}
+
+/**
+ * @brief Biten bağlantı thread'lerini join et
+ *
+ * Çok sayıda kısa bağlantı açan ölçümlerde thread kaynakları birikmesin
+ * diye kabul döngüsünde çağrılır.
+ */
+static void reapTestWorkers(TLSTestServer *server) {
+  std::vector<std::thread::id> finished;
+  {
+    std::lock_guard<std::mutex> lock(server->mutex);
+    finished.swap(server->finished);
+  }
+
+  for (size_t i = 0; i < finished.size(); ++i) {
+    for (size_t w = 0; w < server->workers.size(); ++w) {
+      if (server->workers[w].get_id() == finished[i]) {
+        server->workers[w].join();
+        server->workers.erase(server->workers.begin() + static_cast<std::ptrdiff_t>(w));
+        break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Bağlantı kabul döngüsü
+ */
+static void acceptTestConnections(TLSTestServer *server) {
+  while (!server->stopping.load()) {
+    reapTestWorkers(server);
+    pollfd listenerPoll;
+    listenerPoll.fd = server->listener;
+    listenerPoll.events = POLLIN;
+    listenerPoll.revents = 0;
+
+    if (pollSockets(&listenerPoll, 1, TEST_SERVER_POLL_MS) <= 0) {
+      continue;
+    }
+
+    SocketHandle client = accept(server->listener, nullptr, nullptr);
+
+    if (client == INVALID_SOCKET_HANDLE) {
+      continue;
+    }
+
+    int noDelay = 1;
+    setsockopt(client, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char *>(&noDelay),
+               sizeof(noDelay));
+    disableSigpipe(client);
+    {
+      std::lock_guard<std::mutex> lock(server->mutex);
+      server->clients.push_back(client);
+    }
+    server->workers.push_back(std::thread(serveTestConnection, server, client));
+  }
+}
+
+/**
+ * @brief Test sunucusu için SSL bağlamı, sertifikalar ve CA dosyasını hazırla
+ *
+ * @param workDir CA sertifikasının yazılacağı dizin
+ * @param info Sunucu bilgisi (caCertPath, fingerprint, publicKeyHash doldurulur)
+ * @return SSL_CTX* Sunucu bağlamı (hata durumunda nullptr)
+ */
+static SSL_CTX *createTestServerContext(const char *workDir, TLSTestServerInfo *info) {
+  EVP_PKEY *caKey = generateTestKey();
+  EVP_PKEY *serverKey = generateTestKey();
+  X509 *caCert = caKey ? issueTestCertificate(caKey, "TravelExpense Test CA", nullptr, nullptr, 1) : nullptr;
+  X509 *serverCert = (caCert && serverKey) ? issueTestCertificate(serverKey, "localhost", caCert, caKey, 2)
+                     : nullptr;
+  SSL_CTX *context = nullptr;
+  std::snprintf(info->caCertPath, sizeof(info->caCertPath), "%s/tls_test_ca.pem", workDir);
+  BIO *caFile = serverCert ? BIO_new_file(info->caCertPath, "w") : nullptr;
+
+  if (caFile && PEM_write_bio_X509(caFile, caCert) == 1 &&
+      certificateFingerprint(serverCert, info->fingerprint) &&
+      certificatePublicKeyHash(serverCert, info->publicKeyHash)) {
+    context = SSL_CTX_new(TLS_server_method());
+
+    if (context) {
+      SSL_CTX_set_min_proto_version(context, TLS1_2_VERSION);
+
+      if (SSL_CTX_use_certificate(context, serverCert) != 1 ||
+          SSL_CTX_use_PrivateKey(context, serverKey) != 1) {
+        SSL_CTX_free(context);
+        context = nullptr;
+      }
+    }
+  }
+
+  BIO_free(caFile);
+  X509_free(serverCert);
+  X509_free(caCert);
+  EVP_PKEY_free(serverKey);
+  EVP_PKEY_free(caKey);
+  ERR_clear_error();
+  return context;
+}
+#endif
+
+TravelExpense::ErrorCode startTLSTestServer(const char *workDir, TLSTestServer **server,
+    TLSTestServerInfo *info) {
+  if (server) {
+    *server = nullptr;
+  }
+
+  if (!workDir || !server || !info) {
+    return ErrorCode::InvalidInput;
+  }
+
+  std::memset(info, 0, sizeof(TLSTestServerInfo));
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  bool isDirectory = false;
+
+  if (!pathExists(workDir, &isDirectory) || !isDirectory) {
+    return ErrorCode::FileNotFound;
+  }
+
+  ensureSocketsInitialized();
+  SSL_CTX *context = createTestServerContext(workDir, info);
+
+  if (!context) {
+    return ErrorCode::SecurityFailed;
+  }
+
+  // Yalnızca loopback; port çekirdek tarafından seçilir
+  SocketHandle listener = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t addressLen = sizeof(address);
+
+  if (listener == INVALID_SOCKET_HANDLE ||
+      bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+      listen(listener, SOMAXCONN) != 0 ||
+      getsockname(listener, reinterpret_cast<sockaddr *>(&address), &addressLen) != 0) {
+    if (listener != INVALID_SOCKET_HANDLE) {
+      closeSocket(listener);
+    }
+
+    SSL_CTX_free(context);
+    return ErrorCode::ConnectionFailed;
+  }
+
+  info->port = ntohs(address.sin_port);
+  TLSTestServer *created = new TLSTestServer();
+  created->context = context;
+  created->listener = listener;
+  created->acceptThread = std::thread(acceptTestConnections, created);
+  *server = created;
+  return ErrorCode::Success;
+#else
+  return ErrorCode::ConnectionFailed;
+#endif
+}
+
+TravelExpense::ErrorCode stopTLSTestServer(TLSTestServer *server) {
+  if (!server) {
+    return ErrorCode::InvalidInput;
+  }
+
+  server->stopping.store(true);
+
+  if (server->acceptThread.joinable()) {
+    server->acceptThread.join();
+  }
+
+  {
+    // read() içinde bekleyen bağlantı thread'lerini uyandır
+    std::lock_guard<std::mutex> lock(server->mutex);
+
+    for (size_t i = 0; i < server->clients.size(); ++i) {
+      shutdown(server->clients[i], SOCKET_SHUTDOWN_BOTH);
+    }
+  }
+
+  for (size_t i = 0; i < server->workers.size(); ++i) {
+    server->workers[i].join();
+  }
+
+  if (server->listener != INVALID_SOCKET_HANDLE) {
+    closeSocket(server->listener);
+  }
+
+#ifdef TRAVELEXPENSE_HAS_OPENSSL
+  SSL_CTX_free(server->context);
+#endif
+  delete server;
   return ErrorCode::Success;
 }
 
@@ -404,6 +2532,10 @@ TravelExpense::ErrorCode getTLSErrorMessage(ErrorCode errorCode, char *message,
       errorMsg = "TLS file I/O error";
       break;
 
+    case ErrorCode::Busy:
+      errorMsg = "TLS operation would block (retry when socket is ready)";
+      break;
+
     default:
       errorMsg = "Unknown TLS error";
       break;
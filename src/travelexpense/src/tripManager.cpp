@@ -121,6 +121,16 @@ ErrorCode getTrips(int32_t userId, std::vector<Trip> &trips) {
   return (rc == SQLITE_DONE) ? ErrorCode::Success : ErrorCode::FileIO;
 }
 
+ErrorCode createTrip(const UserAuth::UserContext &context, const Trip &trip, int32_t &tripId) {
+  Trip owned = trip;
+  owned.userId = context.user.userId;
+  return createTrip(owned, tripId);
+}
+
+ErrorCode getTrips(const UserAuth::UserContext &context, std::vector<Trip> &trips) {
+  return getTrips(context.user.userId, trips);
+}
+
 ErrorCode updateTrip(int32_t tripId, const Trip &trip) {
   // SQLite veritabanını al
   sqlite3 *db = Database::getDatabase();
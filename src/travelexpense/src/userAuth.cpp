@@ -14,52 +14,511 @@
 #include <cstring>
 #include <sstream>
 #include <ctime>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace TravelExpense {
 
 namespace UserAuth {
 
-// Global mevcut kullanıcı pointer'ı
-static User *currentUser = nullptr;
+// ============================================
+// THREAD BAŞINA KULLANICI BAĞLAMI
+// ============================================
 
-ErrorCode registerUser(const char *username, const char *password) {
-  if (!username || !password || strlen(username) == 0 || strlen(password) == 0) {
-    return ErrorCode::InvalidInput;
+/**
+ * @struct ThreadContextSlot
+ * @brief Thread'in mevcut bağlamı
+ *
+ * owned: loginUser()/enableGuestMode() ile bu thread için açılan bağlam
+ * (thread sonlanınca serbest bırakılır). current: şu an bağlı olan bağlam;
+ * owned veya setCurrentContext() ile ödünç verilmiş bir bağlam olabilir.
+ */
+struct ThreadContextSlot {
+  UserContext *owned;    /**< @brief Thread'in sahip olduğu bağlam */
+  UserContext *current;  /**< @brief Bağlı bağlam */
+
+  ThreadContextSlot() : owned(nullptr), current(nullptr) {}
+
+  ~ThreadContextSlot() {
+    releaseUserContext(owned);
   }
+};
 
-  // Şimdilik basit bir kontrol
-  if (strlen(username) >= 50) {
-    return ErrorCode::InvalidInput;
+/**
+ * @brief Çağıran thread'in bağlam yuvası
+ */
+static ThreadContextSlot &threadContextSlot() {
+  static thread_local ThreadContextSlot slot;
+  return slot;
+}
+
+/**
+ * @brief Thread'in sahip olduğu bağlamı değiştir ve bağla
+ *
+ * @param context Yeni bağlam (sahipliği thread'e geçer, nullptr olabilir)
+ */
+static void replaceOwnedContext(UserContext *context) {
+  ThreadContextSlot &slot = threadContextSlot();
+  releaseUserContext(slot.owned);
+  slot.owned = context;
+  slot.current = context;
+}
+
+/**
+ * @brief Çağıran thread şifre doğrulama worker'ı mı
+ *
+ * Worker callback'inden çağrılan senkron API'ler havuzu beklemek yerine
+ * işi doğrudan çalıştırır (tek worker'lı havuzda kilitlenmeyi önler).
+ */
+static thread_local bool t_onPasswordWorker = false;
+
+/**
+ * @struct StoredCredentials
+ * @brief Veritabanından okunan şifre doğrulama bilgileri
+ *
+ * Sürümlü hash kaydı User::passwordHash alanına sığmadığı için (User'ın
+ * binary düzeni eski dosya göçü için sabit) ayrı tutulur. Yıkıcıda
+ * içerik güvenli şekilde silinir.
+ */
+struct StoredCredentials {
+  char record[Encryption::PASSWORD_HASH_RECORD_SIZE]; /**< @brief Sürümlü kayıt veya eski 64 karakter hex */
+  char salt[33];                                      /**< @brief Salt (32 karakter hex) */
+
+  StoredCredentials() {
+    memset(record, 0, sizeof(record));
+    memset(salt, 0, sizeof(salt));
   }
 
-  // SQLite veritabanını al
-  sqlite3 *db = Database::getDatabase();
+  ~StoredCredentials() {
+    Security::secureMemset(record, 0, sizeof(record));
+    Security::secureMemset(salt, 0, sizeof(salt));
+  }
+};
 
-  if (!db) {
-    return ErrorCode::FileNotFound;
+/**
+ * @brief Hash kaydı biçimini kontrol et
+ *
+ * @param record Veritabanındaki password_hash değeri
+ * @return true Eski 64 karakter hex veya '$' ile başlayan sürümlü kayıt
+ */
+static bool isAcceptedHashRecord(const char *record) {
+  size_t len = strlen(record);
+  return len == 64 || (record[0] == '$' && len < Encryption::PASSWORD_HASH_RECORD_SIZE);
+}
+
+// ============================================
+// KULLANICI KAYDI ÖNBELLEĞİ
+// ============================================
+
+/** @brief Varsayılan önbellek kapasitesi (kayıt sayısı) */
+static const size_t USER_CACHE_DEFAULT_CAPACITY = 256;
+
+/** @brief Varsayılan negatif kayıt ömrü (milisaniye) */
+static const uint32_t USER_CACHE_DEFAULT_NEGATIVE_TTL_MS = 30000;
+
+/**
+ * @struct UserCacheEntry
+ * @brief users tablosundaki bir satırın önbellekteki kopyası
+ *
+ * user.passwordHash ve user.salt boş tutulur; hash kaydı ve salt
+ * credentials içinde null-terminated saklanır ve çağıranın beklediği
+ * biçime kopyalanırken dönüştürülür. Yıkıcıda içerik güvenli şekilde silinir.
+ */
+struct UserCacheEntry {
+  User user;                      /**< @brief Kullanıcı bilgisi (hash/salt hariç) */
+  StoredCredentials credentials;  /**< @brief Hash kaydı ve salt */
+  bool acceptedFormat;            /**< @brief Hash ve salt biçimi giriş için geçerli mi */
+
+  UserCacheEntry() : acceptedFormat(false) {}
+
+  ~UserCacheEntry() {
+    Security::secureMemoryCleanup(&user, sizeof(User));
+  }
+};
+
+/**
+ * @struct MissingUserEntry
+ * @brief Veritabanında bulunamayan kullanıcı adı (negatif önbellek)
+ */
+struct MissingUserEntry {
+  std::string username;                             /**< @brief Kullanıcı adı */
+  std::chrono::steady_clock::time_point expiresAt;  /**< @brief Geçerlilik sonu */
+};
+
+/**
+ * @brief Sınırlı LRU kullanıcı önbelleği ve negatif önbellek
+ *
+ * Tüm alanlar mutex ile korunur. generation her geçersiz kılmada artar;
+ * kilit dışında veritabanından okunan sonuç, bu sırada kayıt değiştiyse
+ * önbelleğe yazılmaz.
+ */
+struct UserRecordCache {
+  typedef std::list<UserCacheEntry>::iterator EntryIterator;
+  typedef std::list<MissingUserEntry>::iterator MissingIterator;
+
+  std::mutex mutex;                                           /**< @brief Önbellek kilidi */
+  size_t capacity;                                            /**< @brief Kayıt sayısı üst sınırı (0 = kapalı) */
+  std::chrono::milliseconds negativeTtl;                      /**< @brief Negatif kayıt ömrü (0 = kapalı) */
+  uint64_t generation;                                        /**< @brief Geçersiz kılma sayacı */
+  std::list<UserCacheEntry> entries;                          /**< @brief Kayıtlar (en son kullanılan başta) */
+  std::unordered_map<int32_t, EntryIterator> byId;            /**< @brief ID indeksi */
+  std::unordered_map<std::string, EntryIterator> byUsername;  /**< @brief Kullanıcı adı indeksi */
+  std::list<MissingUserEntry> missing;                        /**< @brief Negatif kayıtlar (en yeni başta) */
+  std::unordered_map<std::string, MissingIterator> missingByUsername; /**< @brief Negatif kayıt indeksi */
+  uint64_t hits;                                              /**< @brief Önbellekten karşılanan sorgu */
+  uint64_t negativeHits;                                      /**< @brief Negatif önbellekten dönen sorgu */
+  uint64_t misses;                                            /**< @brief Veritabanına giden sorgu */
+  uint64_t evictions;                                         /**< @brief Kapasite nedeniyle atılan kayıt */
+
+  UserRecordCache()
+    : capacity(USER_CACHE_DEFAULT_CAPACITY), negativeTtl(USER_CACHE_DEFAULT_NEGATIVE_TTL_MS),
+      generation(0), hits(0), negativeHits(0), misses(0), evictions(0) {}
+};
+
+static UserRecordCache g_userCache;
+
+/**
+ * @brief Önbellek arama sonucu
+ */
+enum class UserCacheLookup {
+  Hit,      /**< @brief Kayıt önbellekte bulundu */
+  Missing,  /**< @brief Kullanıcı adı negatif önbellekte (kullanıcı yok) */
+  Miss      /**< @brief Veritabanına gidilmeli */
+};
+
+/** @brief Kaydı önbellekten ve indekslerden çıkar (kilit tutulmalı) */
+static void eraseCachedUserLocked(UserRecordCache::EntryIterator it) {
+  g_userCache.byId.erase(it->user.userId);
+  g_userCache.byUsername.erase(std::string(it->user.username));
+  g_userCache.entries.erase(it);
+}
+
+/** @brief Kullanıcı adını negatif önbellekten çıkar (kilit tutulmalı) */
+static void eraseMissingUserLocked(const std::string &username) {
+  std::unordered_map<std::string, UserRecordCache::MissingIterator>::iterator found =
+    g_userCache.missingByUsername.find(username);
+
+  if (found != g_userCache.missingByUsername.end()) {
+    g_userCache.missing.erase(found->second);
+    g_userCache.missingByUsername.erase(found);
+  }
+}
+
+/** @brief Tüm kayıtları temizle ve eşzamanlı okumaları geçersiz kıl (kilit tutulmalı) */
+static void clearUserCacheLocked() {
+  ++g_userCache.generation;
+  g_userCache.byId.clear();
+  g_userCache.byUsername.clear();
+  g_userCache.entries.clear();
+  g_userCache.missingByUsername.clear();
+  g_userCache.missing.clear();
+}
+
+/**
+ * @brief Kullanıcı adına göre önbellekte ara
+ *
+ * @param username Kullanıcı adı
+ * @param entry Hit durumunda kaydın kopyası
+ * @param generation Miss durumunda storeCachedUser()/storeMissingUser()'a verilecek sayaç
+ * @return UserCacheLookup Hit, Missing veya Miss
+ */
+static UserCacheLookup findCachedUserByName(const char *username, UserCacheEntry &entry,
+                                            uint64_t &generation) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  generation = g_userCache.generation;
+  std::string key(username);
+  std::unordered_map<std::string, UserRecordCache::EntryIterator>::iterator found =
+    g_userCache.byUsername.find(key);
+
+  if (found != g_userCache.byUsername.end()) {
+    g_userCache.entries.splice(g_userCache.entries.begin(), g_userCache.entries, found->second);
+    entry = *found->second;
+    ++g_userCache.hits;
+    return UserCacheLookup::Hit;
+  }
+
+  std::unordered_map<std::string, UserRecordCache::MissingIterator>::iterator missing =
+    g_userCache.missingByUsername.find(key);
+
+  if (missing != g_userCache.missingByUsername.end()) {
+    if (std::chrono::steady_clock::now() < missing->second->expiresAt) {
+      ++g_userCache.negativeHits;
+      return UserCacheLookup::Missing;
+    }
+
+    g_userCache.missing.erase(missing->second);
+    g_userCache.missingByUsername.erase(missing);
+  }
+
+  ++g_userCache.misses;
+  return UserCacheLookup::Miss;
+}
+
+/**
+ * @brief Kullanıcı ID'sine göre önbellekte ara
+ *
+ * @param userId Kullanıcı ID
+ * @param entry Bulunursa kaydın kopyası
+ * @param generation Bulunamazsa storeCachedUser()'a verilecek sayaç
+ * @return true Kayıt önbellekte bulundu
+ */
+static bool findCachedUserById(int32_t userId, UserCacheEntry &entry, uint64_t &generation) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  generation = g_userCache.generation;
+  std::unordered_map<int32_t, UserRecordCache::EntryIterator>::iterator found = g_userCache.byId.find(userId);
+
+  if (found == g_userCache.byId.end()) {
+    ++g_userCache.misses;
+    return false;
+  }
+
+  g_userCache.entries.splice(g_userCache.entries.begin(), g_userCache.entries, found->second);
+  entry = *found->second;
+  ++g_userCache.hits;
+  return true;
+}
+
+/**
+ * @brief Veritabanından okunan kaydı önbelleğe ekle
+ *
+ * Okuma başladıktan sonra önbellek geçersiz kılındıysa (generation
+ * değiştiyse) kayıt eklenmez. Kapasite aşılırsa en eski kayıt atılır.
+ *
+ * @param entry Eklenecek kayıt
+ * @param generation Arama sırasında alınan sayaç
+ */
+static void storeCachedUser(const UserCacheEntry &entry, uint64_t generation) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+
+  if (g_userCache.capacity == 0 || generation != g_userCache.generation) {
+    return;
+  }
+
+  std::string key(entry.user.username);
+  std::unordered_map<int32_t, UserRecordCache::EntryIterator>::iterator byId =
+    g_userCache.byId.find(entry.user.userId);
+
+  if (byId != g_userCache.byId.end()) {
+    eraseCachedUserLocked(byId->second);
+  }
+
+  std::unordered_map<std::string, UserRecordCache::EntryIterator>::iterator byName = g_userCache.byUsername.find(key);
+
+  if (byName != g_userCache.byUsername.end()) {
+    eraseCachedUserLocked(byName->second);
+  }
+
+  eraseMissingUserLocked(key);
+  g_userCache.entries.push_front(entry);
+  g_userCache.byId[entry.user.userId] = g_userCache.entries.begin();
+  g_userCache.byUsername[key] = g_userCache.entries.begin();
+
+  while (g_userCache.entries.size() > g_userCache.capacity) {
+    eraseCachedUserLocked(--g_userCache.entries.end());
+    ++g_userCache.evictions;
+  }
+}
+
+/**
+ * @brief Bulunamayan kullanıcı adını negatif önbelleğe ekle
+ *
+ * Ömür sabit olduğundan listenin sonundaki kayıtlar ilk dolar; süresi
+ * dolanlar ve kapasiteyi aşanlar sondan atılır.
+ *
+ * @param username Kullanıcı adı
+ * @param generation Arama sırasında alınan sayaç
+ */
+static void storeMissingUser(const char *username, uint64_t generation) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+
+  if (g_userCache.capacity == 0 || g_userCache.negativeTtl.count() == 0 ||
+      generation != g_userCache.generation) {
+    return;
+  }
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::string key(username);
+  eraseMissingUserLocked(key);
+
+  while (!g_userCache.missing.empty() && g_userCache.missing.back().expiresAt <= now) {
+    g_userCache.missingByUsername.erase(g_userCache.missing.back().username);
+    g_userCache.missing.pop_back();
+  }
+
+  MissingUserEntry missing;
+  missing.username = key;
+  missing.expiresAt = now + g_userCache.negativeTtl;
+  g_userCache.missing.push_front(missing);
+  g_userCache.missingByUsername[key] = g_userCache.missing.begin();
+
+  while (g_userCache.missing.size() > g_userCache.capacity) {
+    g_userCache.missingByUsername.erase(g_userCache.missing.back().username);
+    g_userCache.missing.pop_back();
+    ++g_userCache.evictions;
+  }
+}
+
+/**
+ * @brief Yeni kaydedilen kullanıcı adını önbellekten düşür
+ *
+ * @param username Kullanıcı adı
+ */
+static void forgetCachedUsername(const char *username) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  std::string key(username);
+  ++g_userCache.generation;
+  std::unordered_map<std::string, UserRecordCache::EntryIterator>::iterator found = g_userCache.byUsername.find(key);
+
+  if (found != g_userCache.byUsername.end()) {
+    eraseCachedUserLocked(found->second);
+  }
+
+  eraseMissingUserLocked(key);
+}
+
+/**
+ * @brief Önbellekteki son giriş zamanını güncelle (write-through)
+ *
+ * @param userId Kullanıcı ID
+ * @param lastLogin Yeni son giriş zamanı
+ */
+static void updateCachedLastLogin(int32_t userId, time_t lastLogin) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  std::unordered_map<int32_t, UserRecordCache::EntryIterator>::iterator found = g_userCache.byId.find(userId);
+
+  if (found != g_userCache.byId.end()) {
+    found->second->user.lastLogin = lastLogin;
+  }
+}
+
+/** @brief Sütun metnini en fazla maxLen karakter kopyala (NULL ise boş) */
+static void copyColumnText(char *dst, size_t maxLen, const char *src) {
+  size_t len = 0;
+
+  while (src && len < maxLen && src[len] != '\0') {
+    ++len;
+  }
+
+  if (len > 0) {
+    memcpy(dst, src, len);
+  }
+
+  dst[len] = '\0';
+}
+
+/**
+ * @brief users tablosundan tek bir satırı oku
+ *
+ * username verilmişse kullanıcı adına, aksi halde userId'ye göre arar.
+ * Hash ve salt biçimi acceptedFormat alanına yazılır; biçim geçersiz olsa
+ * da satır okunur (getUserById bu kayıtları da döndürür).
+ *
+ * @param db Veritabanı bağlantısı
+ * @param username Kullanıcı adı (nullptr ise userId kullanılır)
+ * @param userId Kullanıcı ID
+ * @param entry Satırın yazılacağı kayıt
+ * @return ErrorCode Success, FileIO veya InvalidUser (satır yok)
+ */
+static ErrorCode queryUserRow(sqlite3 *db, const char *username, int32_t userId, UserCacheEntry &entry) {
+  // SQL sorgusu hazırla
+  const char *sql = username
+                    ? "SELECT user_id, username, password_hash, salt, is_guest, created_at, last_login FROM users WHERE username = ?;"
+                    : "SELECT user_id, username, password_hash, salt, is_guest, created_at, last_login FROM users WHERE user_id = ?;";
+  sqlite3_stmt *stmt = nullptr;
+  int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr);
+
+  if (rc != SQLITE_OK) {
+    return ErrorCode::FileIO;
+  }
+
+  // Parametreleri bağla
+  rc = username ? sqlite3_bind_text(stmt, 1, username, -1, SQLITE_STATIC) : sqlite3_bind_int(stmt, 1, userId);
+
+  if (rc != SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    return ErrorCode::FileIO;
+  }
+
+  // Sorguyu çalıştır
+  rc = sqlite3_step(stmt);
+
+  if (rc != SQLITE_ROW) {
+    // Kullanıcı bulunamadı
+    sqlite3_finalize(stmt);
+    return ErrorCode::InvalidUser;
   }
 
+  // Sonuçları al
+  const char *dbUsername = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1));
+  const char *storedHash = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 2));
+  const char *storedSalt = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 3));
+  entry.user.userId = sqlite3_column_int(stmt, 0);
+  entry.user.isGuest = (sqlite3_column_int(stmt, 4) != 0);
+  entry.user.createdAt = sqlite3_column_int64(stmt, 5);
+  entry.user.lastLogin = sqlite3_column_int64(stmt, 6);
+  copyColumnText(entry.user.username, sizeof(entry.user.username) - 1, dbUsername);
+  // Hash kaydı ve salt biçimini kontrol et
+  entry.acceptedFormat = dbUsername && storedHash && storedSalt &&
+                         isAcceptedHashRecord(storedHash) && strlen(storedSalt) == 32;
+  copyColumnText(entry.credentials.record, sizeof(entry.credentials.record) - 1, storedHash);
+  copyColumnText(entry.credentials.salt, sizeof(entry.credentials.salt) - 1, storedSalt);
+  sqlite3_finalize(stmt);
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Kayıt girdilerini kontrol et
+ *
+ * @param username Kullanıcı adı
+ * @param password Şifre
+ * @return true Girdiler geçerli
+ */
+static bool isValidRegistration(const char *username, const char *password) {
+  // Şimdilik basit bir kontrol
+  return username && password && strlen(username) > 0 && strlen(username) < 50 && strlen(password) > 0;
+}
+
+/**
+ * @brief Şifreyi hash'le ve kullanıcı kaydını ekle
+ *
+ * PBKDF2 hesabı nedeniyle registerUserAsync() tarafından worker havuzunda
+ * çalıştırılır.
+ *
+ * @param db Veritabanı bağlantısı
+ * @param username Kullanıcı adı (doğrulanmış)
+ * @param password Şifre (doğrulanmış)
+ * @return ErrorCode Success, InvalidUser (kullanıcı var), FileIO, EncryptionFailed vb.
+ */
+static ErrorCode createUserRecord(sqlite3 *db, const char *username, const char *password) {
   // Salt oluştur
   char salt[33] = {0};
-  char passwordHash[65] = {0};
+  char passwordHash[Encryption::PASSWORD_HASH_RECORD_SIZE] = {0};
 
   if (!Encryption::generateSalt(salt)) {
     return ErrorCode::MemoryAllocation;
   }
 
-  // Şifreyi hash'le (SHA-256 + Salt)
-  if (!Encryption::hashPassword(password, salt, passwordHash)) {
+  // Şifreyi sürümlü kayıt olarak hash'le (PBKDF2-HMAC-SHA256, güncel iterasyon sayısı)
+  if (!Encryption::hashPasswordRecord(password, salt, Encryption::getPasswordHashIterations(),
+                                      passwordHash)) {
     // Salt'ı güvenli şekilde sil
     Security::secureCleanup(salt, sizeof(salt));
     Security::secureCleanup(passwordHash, sizeof(passwordHash));
     return ErrorCode::EncryptionFailed;
   }
 
-  // Hash ve salt uzunluklarını kontrol et (kaydetmeden önce)
-  size_t hashLen = strlen(passwordHash);
-  size_t saltLen = strlen(salt);
-
-  if (hashLen != 64 || saltLen != 32) {
+  // Salt uzunluğunu kontrol et (kaydetmeden önce)
+  if (strlen(salt) != 32) {
     Security::secureCleanup(salt, sizeof(salt));
     Security::secureCleanup(passwordHash, sizeof(passwordHash));
     return ErrorCode::EncryptionFailed;
@@ -95,6 +554,7 @@ ErrorCode registerUser(const char *username, const char *password) {
 
     // UNIQUE constraint hatası (kullanıcı zaten var)
     if (rc == SQLITE_CONSTRAINT) {
+      forgetCachedUsername(username);
       return ErrorCode::InvalidUser;
     }
 
@@ -106,14 +566,20 @@ ErrorCode registerUser(const char *username, const char *password) {
   // SQLite'da autocommit mode varsayılan olarak açıktır,
   // ama bazı durumlarda açıkça commit etmek gerekebilir
   sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr);
+  // Negatif önbellekteki "kullanıcı yok" kaydını düşür
+  forgetCachedUsername(username);
   // Güvenli temizlik
   Security::secureCleanup(salt, sizeof(salt));
   Security::secureCleanup(passwordHash, sizeof(passwordHash));
   return ErrorCode::Success;
 }
 
-ErrorCode loginUser(const char *username, const char *password) {
-  if (!username || !password || strlen(username) == 0 || strlen(password) == 0) {
+ErrorCode registerUser(const char *username, const char *password) {
+  if (!t_onPasswordWorker) {
+    return registerUserAsync(username, password).get();
+  }
+
+  if (!isValidRegistration(username, password)) {
     return ErrorCode::InvalidInput;
   }
 
@@ -124,94 +590,127 @@ ErrorCode loginUser(const char *username, const char *password) {
     return ErrorCode::FileNotFound;
   }
 
-  // SQL sorgusu hazırla
-  const char *sql = "SELECT user_id, username, password_hash, salt, is_guest, created_at, last_login FROM users WHERE username = ?;";
-  sqlite3_stmt *stmt = nullptr;
-  int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr);
+  return createUserRecord(db, username, password);
+}
 
-  if (rc != SQLITE_OK) {
-    return ErrorCode::FileIO;
+/**
+ * @brief Kullanıcı kaydını (hash ve salt dahil) yükle
+ *
+ * Kayıt önce önbellekte aranır; bulunamazsa veritabanından okunup
+ * önbelleğe eklenir. Veritabanında olmayan kullanıcı adı negatif
+ * önbelleğe alınır ve ömrü dolana kadar SQLite'a gidilmez.
+ * Salt 32 karakter, hash ise eski 64 karakter hex veya sürümlü kayıt
+ * olmalıdır; aksi halde kayıt geçersiz sayılır.
+ *
+ * @param db Veritabanı bağlantısı
+ * @param username Kullanıcı adı
+ * @param foundUser Kullanıcı bilgisinin yazılacağı yapı
+ * @param credentials Hash kaydı ve salt'ın yazılacağı yapı
+ * @return ErrorCode Success, FileIO veya InvalidUser
+ */
+static ErrorCode loadUserCredentials(sqlite3 *db, const char *username, User &foundUser,
+                                     StoredCredentials &credentials) {
+  UserCacheEntry entry;
+  uint64_t generation = 0;
+  UserCacheLookup lookup = findCachedUserByName(username, entry, generation);
+
+  if (lookup == UserCacheLookup::Missing) {
+    return ErrorCode::InvalidUser;
   }
 
-  // Parametreleri bağla
-  rc = sqlite3_bind_text(stmt, 1, username, -1, SQLITE_STATIC);
+  if (lookup == UserCacheLookup::Miss) {
+    ErrorCode result = queryUserRow(db, username, 0, entry);
 
-  if (rc != SQLITE_OK) {
-    sqlite3_finalize(stmt);
-    return ErrorCode::FileIO;
-  }
+    if (result == ErrorCode::InvalidUser) {
+      storeMissingUser(username, generation);
+    }
 
-  // Sorguyu çalıştır
-  rc = sqlite3_step(stmt);
+    if (result != ErrorCode::Success) {
+      return result;
+    }
 
-  if (rc != SQLITE_ROW) {
-    // Eğer kullanıcı bulunamadıysa, hatayı döndür
-    sqlite3_finalize(stmt);
-    return ErrorCode::InvalidUser;
+    storeCachedUser(entry, generation);
   }
 
-  // Sonuçları al
-  User foundUser;
-  foundUser.userId = sqlite3_column_int(stmt, 0);
-
-  // Veritabanından okunan değerlerin null olup olmadığını kontrol et
-  if (sqlite3_column_type(stmt, 1) == SQLITE_NULL ||
-      sqlite3_column_type(stmt, 2) == SQLITE_NULL ||
-      sqlite3_column_type(stmt, 3) == SQLITE_NULL) {
-    sqlite3_finalize(stmt);
+  if (!entry.acceptedFormat) {
     return ErrorCode::InvalidUser;
   }
 
-  const char *dbUsername = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1));
-  const char *storedHash = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 2));
-  const char *storedSalt = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 3));
+  foundUser = entry.user;
+  memcpy(credentials.record, entry.credentials.record, sizeof(credentials.record));
+  memcpy(credentials.salt, entry.credentials.salt, sizeof(credentials.salt));
+  // User alanları null-terminated değildir (64/32 byte tam dolu)
+  // Sürümlü kayıt passwordHash alanına sığmaz; yalnızca eski hash kopyalanır
+  memcpy(foundUser.salt, credentials.salt, 32);
 
-  // Null pointer kontrolü
-  if (!dbUsername || !storedHash || !storedSalt) {
-    sqlite3_finalize(stmt);
-    return ErrorCode::InvalidUser;
+  if (strlen(credentials.record) == 64) {
+    memcpy(foundUser.passwordHash, credentials.record, 64);
   }
 
-  foundUser.isGuest = (sqlite3_column_int(stmt, 4) != 0);
-  foundUser.createdAt = sqlite3_column_int64(stmt, 5);
-  foundUser.lastLogin = sqlite3_column_int64(stmt, 6);
-  strncpy(foundUser.username, dbUsername, sizeof(foundUser.username) - 1);
-  foundUser.username[sizeof(foundUser.username) - 1] = '\0';
-  // Hash ve salt'ı kopyala (hash 64 karakter, salt 32 karakter)
-  // strncpy kullanarak tam uzunluğu kopyala, sonra null terminator ekle
-  size_t hashLen = strlen(storedHash);
-  size_t saltLen = strlen(storedSalt);
+  return ErrorCode::Success;
+}
 
-  // Hash ve salt uzunluklarını kontrol et
-  if (hashLen != 64 || saltLen != 32) {
-    sqlite3_finalize(stmt);
-    return ErrorCode::InvalidUser;
+/**
+ * @brief Şifreyi güncel parametrelerle yeniden hash'le ve kaydet
+ *
+ * Başarılı girişten sonra, kayıt eski formatta veya farklı iterasyon
+ * sayısıyla saklanmışsa çağrılır. Hata girişi etkilemez; kayıt bir
+ * sonraki girişte tekrar denenir.
+ *
+ * @param db Veritabanı bağlantısı
+ * @param userId Kullanıcı ID
+ * @param password Doğrulanmış şifre
+ */
+static void rehashUserPassword(sqlite3 *db, int32_t userId, const char *password) {
+  char salt[33] = {0};
+  char record[Encryption::PASSWORD_HASH_RECORD_SIZE] = {0};
+
+  if (Encryption::generateSalt(salt) &&
+      Encryption::hashPasswordRecord(password, salt, Encryption::getPasswordHashIterations(), record)) {
+    const char *updateSql = "UPDATE users SET password_hash = ?, salt = ? WHERE user_id = ?;";
+    sqlite3_stmt *updateStmt = nullptr;
+
+    if (sqlite3_prepare_v2(db, updateSql, -1, &updateStmt, nullptr) == SQLITE_OK) {
+      sqlite3_bind_text(updateStmt, 1, record, -1, SQLITE_TRANSIENT);
+      sqlite3_bind_text(updateStmt, 2, salt, -1, SQLITE_TRANSIENT);
+      sqlite3_bind_int(updateStmt, 3, userId);
+      sqlite3_step(updateStmt);
+      sqlite3_finalize(updateStmt);
+    }
   }
 
-  // Hash ve salt'ı tam uzunlukta kopyala
-  // passwordHash[64] buffer'ı var (0-63 arası indeksler = 64 byte)
-  // Hash 64 karakter, salt 32 karakter
-  // Buffer'ı tam kullanıp null terminator eklememek doğru
-  // verifyPassword fonksiyonunda strlen yerine sabit 64 kullanacağız
-  memcpy(foundUser.passwordHash, storedHash, 64);
-  memcpy(foundUser.salt, storedSalt, 32);
-  // Null terminator eklemiyoruz çünkü buffer tam dolu
-  // verifyPassword fonksiyonunda strlen yerine sabit 64 kullanılacak
-  sqlite3_finalize(stmt);
+  // Önbellekteki eski hash kaydı bir sonraki okumada yenilenir
+  invalidateUserCache(userId);
 
-  // Şifre doğrulama (SHA-256 hash kontrolü)
-  // Hash ve salt uzunlukları zaten kontrol edildi ve doğru kopyalandı
-  if (!Encryption::verifyPassword(password, foundUser.salt, foundUser.passwordHash)) {
-    // Güvenli temizlik
-    Security::secureMemoryCleanup(&foundUser, sizeof(User));
-    return ErrorCode::InvalidUser;
+  Security::secureCleanup(salt, sizeof(salt));
+  Security::secureCleanup(record, sizeof(record));
+}
+
+/**
+ * @brief Doğrulanmış giriş için oturumu aç
+ *
+ * Gerekirse şifreyi yeniden hash'ler, last_login'i günceller ve yeni
+ * bağlamı oluşturur. loginUserAsync() bunu worker havuzunda çalıştırır.
+ *
+ * @param db Veritabanı bağlantısı
+ * @param foundUser Doğrulanmış kullanıcı (çıkışta güvenli şekilde silinir)
+ * @param password Doğrulanmış şifre
+ * @param needsRehash Kayıt güncel parametrelerle yeniden hash'lenmeli mi
+ * @param context Yeni bağlam (çıktı)
+ * @return ErrorCode Success
+ */
+static ErrorCode completeLogin(sqlite3 *db, User &foundUser, const char *password, bool needsRehash,
+                               UserContext **context) {
+  // Parametreler değiştiyse (eski format / farklı iterasyon) şeffaf şekilde yeniden hash'le
+  if (needsRehash) {
+    rehashUserPassword(db, foundUser.userId, password);
   }
 
   // Last login'i güncelle
   time_t now = time(nullptr);
   const char *updateSql = "UPDATE users SET last_login = ? WHERE user_id = ?;";
   sqlite3_stmt *updateStmt = nullptr;
-  rc = sqlite3_prepare_v2(db, updateSql, -1, &updateStmt, nullptr);
+  int rc = sqlite3_prepare_v2(db, updateSql, -1, &updateStmt, nullptr);
 
   if (rc == SQLITE_OK) {
     sqlite3_bind_int64(updateStmt, 1, static_cast<sqlite3_int64>(now));
@@ -219,45 +718,28 @@ ErrorCode loginUser(const char *username, const char *password) {
     sqlite3_step(updateStmt);
     sqlite3_finalize(updateStmt);
     foundUser.lastLogin = now;
+    updateCachedLastLogin(foundUser.userId, now);
   }
 
-  // Mevcut kullanıcıyı ayarla
-  if (currentUser != nullptr) {
-    Security::secureMemoryCleanup(currentUser, sizeof(User));
-    delete currentUser;
-  }
-
-  currentUser = new User(foundUser);
+  // Oturum bağlamını oluştur
+  UserContext *created = new UserContext();
+  created->user = foundUser;
+  created->loginTime = now;
+  *context = created;
   // Geçici değişkeni güvenli şekilde temizle
   Security::secureMemoryCleanup(&foundUser, sizeof(User));
   return ErrorCode::Success;
 }
 
-ErrorCode enableGuestMode() {
-  if (currentUser != nullptr) {
-    delete currentUser;
+ErrorCode loginUser(const char *username, const char *password, UserContext **context) {
+  if (context) {
+    *context = nullptr;
   }
 
-  currentUser = new User();
-  currentUser->userId = -1; // Guest kullanıcı ID'si
-  currentUser->isGuest = true;
-  strncpy(currentUser->username, "Guest", sizeof(currentUser->username) - 1);
-  currentUser->createdAt = time(nullptr);
-  return ErrorCode::Success;
-}
-
-void logoutUser() {
-  if (currentUser != nullptr) {
-    delete currentUser;
-    currentUser = nullptr;
+  if (!username || !password || !context || strlen(username) == 0 || strlen(password) == 0) {
+    return ErrorCode::InvalidInput;
   }
-}
 
-User *getCurrentUser() {
-  return currentUser;
-}
-
-ErrorCode getUserById(int32_t userId, User &user) {
   // SQLite veritabanını al
   sqlite3 *db = Database::getDatabase();
 
@@ -265,42 +747,681 @@ ErrorCode getUserById(int32_t userId, User &user) {
     return ErrorCode::FileNotFound;
   }
 
-  // SQL sorgusu hazırla
-  const char *sql = "SELECT user_id, username, password_hash, salt, is_guest, created_at, last_login FROM users WHERE user_id = ?;";
-  sqlite3_stmt *stmt = nullptr;
-  int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr);
+  User foundUser;
+  StoredCredentials credentials;
+  ErrorCode loadResult = loadUserCredentials(db, username, foundUser, credentials);
 
-  if (rc != SQLITE_OK) {
-    return ErrorCode::FileIO;
+  if (loadResult != ErrorCode::Success) {
+    Security::secureMemoryCleanup(&foundUser, sizeof(User));
+    return loadResult;
   }
 
-  // Parametreleri bağla
-  sqlite3_bind_int(stmt, 1, userId);
-  // Sorguyu çalıştır
-  rc = sqlite3_step(stmt);
+  // Şifre doğrulama (sürümlü PBKDF2 kaydı veya eski SHA-256 hash)
+  bool needsRehash = false;
 
-  if (rc != SQLITE_ROW) {
-    sqlite3_finalize(stmt);
+  if (!Encryption::verifyPasswordRecord(password, credentials.record, credentials.salt, &needsRehash)) {
+    // Güvenli temizlik
+    Security::secureMemoryCleanup(&foundUser, sizeof(User));
     return ErrorCode::InvalidUser;
   }
 
-  // Sonuçları al
-  user.userId = sqlite3_column_int(stmt, 0);
-  const char *dbUsername = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1));
-  const char *storedHash = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 2));
-  const char *storedSalt = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 3));
-  user.isGuest = (sqlite3_column_int(stmt, 4) != 0);
-  user.createdAt = sqlite3_column_int64(stmt, 5);
-  user.lastLogin = sqlite3_column_int64(stmt, 6);
-  strncpy(user.username, dbUsername, sizeof(user.username) - 1);
+  return completeLogin(db, foundUser, password, needsRehash, context);
+}
+
+ErrorCode loginUser(const char *username, const char *password) {
+  UserContext *context = nullptr;
+  ErrorCode result = loginUser(username, password, &context);
+
+  if (result == ErrorCode::Success) {
+    replaceOwnedContext(context);
+  }
+
+  return result;
+}
+
+ErrorCode createGuestContext(UserContext **context) {
+  if (!context) {
+    return ErrorCode::InvalidInput;
+  }
+
+  UserContext *created = new UserContext();
+  created->user.userId = -1; // Guest kullanıcı ID'si
+  created->user.isGuest = true;
+  strncpy(created->user.username, "Guest", sizeof(created->user.username) - 1);
+  created->user.createdAt = time(nullptr);
+  created->loginTime = created->user.createdAt;
+  *context = created;
+  return ErrorCode::Success;
+}
+
+void releaseUserContext(UserContext *context) {
+  if (context != nullptr) {
+    Security::secureMemoryCleanup(context, sizeof(UserContext));
+    delete context;
+  }
+}
+
+void setCurrentContext(UserContext *context) {
+  threadContextSlot().current = context;
+}
+
+UserContext *getCurrentContext() {
+  return threadContextSlot().current;
+}
+
+ScopedUserContext::ScopedUserContext(UserContext *context) {
+  ThreadContextSlot &slot = threadContextSlot();
+  previous = slot.current;
+  previousOwned = slot.current != nullptr && slot.current == slot.owned;
+  slot.current = context;
+}
+
+ScopedUserContext::~ScopedUserContext() {
+  ThreadContextSlot &slot = threadContextSlot();
+  // Kendi bağlamı kapsam içinde değiştirilmiş (eskisi silinmiş) olabilir
+  slot.current = previousOwned ? slot.owned : previous;
+}
+
+ErrorCode enableGuestMode() {
+  UserContext *context = nullptr;
+  ErrorCode result = createGuestContext(&context);
+
+  if (result == ErrorCode::Success) {
+    replaceOwnedContext(context);
+  }
+
+  return result;
+}
+
+void logoutUser() {
+  replaceOwnedContext(nullptr);
+  Encryption::clearAES256KeyCache();
+}
+
+User *getCurrentUser() {
+  UserContext *context = threadContextSlot().current;
+  return context ? &context->user : nullptr;
+}
+
+ErrorCode getUserById(int32_t userId, User &user) {
+  UserCacheEntry entry;
+  uint64_t generation = 0;
+
+  if (!findCachedUserById(userId, entry, generation)) {
+    // SQLite veritabanını al
+    sqlite3 *db = Database::getDatabase();
+
+    if (!db) {
+      return ErrorCode::FileNotFound;
+    }
+
+    ErrorCode result = queryUserRow(db, nullptr, userId, entry);
+
+    if (result != ErrorCode::Success) {
+      return result;
+    }
+
+    storeCachedUser(entry, generation);
+  }
+
+  user.userId = entry.user.userId;
+  user.isGuest = entry.user.isGuest;
+  user.createdAt = entry.user.createdAt;
+  user.lastLogin = entry.user.lastLogin;
+  strncpy(user.username, entry.user.username, sizeof(user.username) - 1);
   user.username[sizeof(user.username) - 1] = '\0';
-  strncpy(user.passwordHash, storedHash, sizeof(user.passwordHash) - 1);
-  user.passwordHash[sizeof(user.passwordHash) - 1] = '\0';
-  strncpy(user.salt, storedSalt, sizeof(user.salt) - 1);
+
+  // Sürümlü hash kaydı bu alana sığmaz; yalnızca eski hash kopyalanır
+  if (entry.credentials.record[0] != '$') {
+    strncpy(user.passwordHash, entry.credentials.record, sizeof(user.passwordHash) - 1);
+    user.passwordHash[sizeof(user.passwordHash) - 1] = '\0';
+  }
+
+  strncpy(user.salt, entry.credentials.salt, sizeof(user.salt) - 1);
   user.salt[sizeof(user.salt) - 1] = '\0';
-  sqlite3_finalize(stmt);
   return ErrorCode::Success;
 }
+
+void configureUserCache(size_t capacity, uint32_t negativeTtlMs) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  g_userCache.capacity = capacity;
+  g_userCache.negativeTtl = std::chrono::milliseconds(negativeTtlMs);
+  clearUserCacheLocked();
+}
+
+void invalidateUserCache(int32_t userId) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  ++g_userCache.generation;
+  std::unordered_map<int32_t, UserRecordCache::EntryIterator>::iterator found = g_userCache.byId.find(userId);
+
+  if (found != g_userCache.byId.end()) {
+    eraseCachedUserLocked(found->second);
+  }
+}
+
+void clearUserCache() {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  clearUserCacheLocked();
+}
+
+void getUserCacheStats(UserCacheStats &stats) {
+  std::lock_guard<std::mutex> lock(g_userCache.mutex);
+  stats.entries = g_userCache.entries.size();
+  stats.negativeEntries = g_userCache.missing.size();
+  stats.capacity = g_userCache.capacity;
+  stats.negativeTtlMs = static_cast<uint32_t>(g_userCache.negativeTtl.count());
+  stats.hits = g_userCache.hits;
+  stats.negativeHits = g_userCache.negativeHits;
+  stats.misses = g_userCache.misses;
+  stats.evictions = g_userCache.evictions;
+}
+
+// ============================================
+// ASENKRON ŞİFRE DOĞRULAMA SERVİSİ
+// ============================================
+
+/** @brief Varsayılan kuyruk kapasitesi */
+static const size_t PASSWORD_VERIFIER_DEFAULT_CAPACITY = 1024;
+
+/** @brief Yüzdelik hesabında tutulan son gecikme örneği sayısı */
+static const size_t PASSWORD_VERIFIER_LATENCY_SAMPLES = 1024;
+
+/**
+ * @brief Worker havuzunda çalışan iş türü
+ */
+enum class PasswordJobKind {
+  Verify,    /**< @brief Yalnızca şifre doğrulama */
+  Login,     /**< @brief Doğrulama + oturum açma (loginUserAsync) */
+  Register   /**< @brief Hash + kullanıcı kaydı (registerUserAsync) */
+};
+
+/**
+ * @brief Kuyruktaki tek bir şifre işi
+ *
+ * Girdilerin kopyalarını tutar; yıkıcıda şifre, salt, hash ve kullanıcı
+ * kaydı güvenli şekilde silinir. Sonuç, callback verilmişse callback ile,
+ * aksi halde promise üzerinden iletilir.
+ */
+struct PasswordJob {
+  PasswordJobKind kind;                                 /**< @brief İş türü */
+  std::vector<char> password;                           /**< @brief Şifre kopyası (null-terminated) */
+  char salt[33];                                        /**< @brief Salt kopyası */
+  char storedHash[Encryption::PASSWORD_HASH_RECORD_SIZE]; /**< @brief Saklanan hash kaydı kopyası */
+  char username[50];                                    /**< @brief Kullanıcı adı (Register) */
+  User user;                                            /**< @brief Yüklenmiş kullanıcı kaydı (Login) */
+  sqlite3 *db;                                          /**< @brief Veritabanı bağlantısı (Login/Register) */
+  std::chrono::steady_clock::time_point enqueuedAt;     /**< @brief Kuyruğa alınma zamanı */
+  std::promise<ErrorCode> promise;                      /**< @brief Future için sonuç kanalı */
+  std::promise<LoginResult> loginPromise;               /**< @brief Login future sonuç kanalı */
+  PasswordVerifyCallback callback;                      /**< @brief Tamamlanma callback'i (opsiyonel) */
+  LoginCallback loginCallback;                          /**< @brief Login tamamlanma callback'i (opsiyonel) */
+  void *userData;                                       /**< @brief Callback kullanıcı verisi */
+
+  PasswordJob(PasswordJobKind jobKind, const char *pw, const char *saltValue, const char *hashValue)
+    : kind(jobKind), password(pw, pw + strlen(pw) + 1), db(nullptr), callback(nullptr),
+      loginCallback(nullptr), userData(nullptr) {
+    copyBounded(salt, saltValue, 32);
+    copyBounded(storedHash, hashValue, sizeof(storedHash) - 1);
+    memset(username, 0, sizeof(username));
+  }
+
+  ~PasswordJob() {
+    Security::secureMemset(password.data(), 0, password.size());
+    Security::secureMemset(salt, 0, sizeof(salt));
+    Security::secureMemset(storedHash, 0, sizeof(storedHash));
+    Security::secureMemoryCleanup(&user, sizeof(User));
+  }
+
+ private:
+  /** @brief En fazla maxLen karakter kopyala ve null terminator ekle */
+  static void copyBounded(char *dst, const char *src, size_t maxLen) {
+    size_t len = 0;
+
+    while (len < maxLen && src[len] != '\0') {
+      ++len;
+    }
+
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+  }
+
+  PasswordJob(const PasswordJob &);
+  PasswordJob &operator=(const PasswordJob &);
+};
+
+/**
+ * @brief Sabit boyutlu worker havuzu ve sınırlı kuyruk
+ *
+ * Kuyruk, metrikler ve kabul durumu mutex ile korunur. Havuzun başlatılması
+ * ve durdurulması lifecycleMutex ile sıralanır; böylece join işlemleri
+ * kuyruk kilidi tutulmadan yapılır.
+ */
+struct PasswordVerifier {
+  std::mutex lifecycleMutex;                          /**< @brief Başlat/durdur sıralaması */
+  std::mutex mutex;                                   /**< @brief Kuyruk ve metrik kilidi */
+  std::condition_variable workAvailable;              /**< @brief Yeni iş / durma sinyali */
+  std::deque<PasswordJob *> queue;                    /**< @brief Bekleyen işler */
+  std::vector<std::thread> workers;                   /**< @brief Worker thread'ler */
+  std::atomic<bool> running;                          /**< @brief Havuz çalışıyor mu */
+  bool accepting;                                     /**< @brief Yeni iş kabul ediliyor mu */
+  unsigned workerCount;                               /**< @brief Çalışan worker sayısı (metrik) */
+  size_t capacity;                                    /**< @brief Kuyruk kapasitesi */
+  uint64_t completed;                                 /**< @brief Tamamlanan iş sayısı */
+  uint64_t rejected;                                  /**< @brief Reddedilen iş sayısı */
+  uint32_t latencyUs[PASSWORD_VERIFIER_LATENCY_SAMPLES]; /**< @brief Gecikme halkası (mikrosaniye) */
+  size_t latencyCount;                                /**< @brief Halkadaki geçerli örnek sayısı */
+  size_t latencyNext;                                 /**< @brief Sonraki yazma indeksi */
+
+  PasswordVerifier()
+    : running(false), accepting(false), workerCount(0), capacity(PASSWORD_VERIFIER_DEFAULT_CAPACITY),
+      completed(0), rejected(0), latencyCount(0), latencyNext(0) {}
+
+  ~PasswordVerifier() {
+    shutdownPasswordVerifier();
+  }
+};
+
+static PasswordVerifier g_passwordVerifier;
+
+/**
+ * @brief Tek bir işi çalıştır, metrikleri güncelle ve sonucu ilet
+ *
+ * @param job Çalıştırılacak iş (sahipliği alınır ve silinir)
+ */
+static void runPasswordJob(PasswordJob *job) {
+  ErrorCode result = ErrorCode::InvalidUser;
+  UserContext *context = nullptr;
+
+  if (job->kind == PasswordJobKind::Register) {
+    result = createUserRecord(job->db, job->username, job->password.data());
+  } else {
+    bool needsRehash = false;
+
+    if (Encryption::verifyPasswordRecord(job->password.data(), job->storedHash, job->salt,
+                                         job->kind == PasswordJobKind::Login ? &needsRehash : nullptr)) {
+      result = job->kind == PasswordJobKind::Login
+               ? completeLogin(job->db, job->user, job->password.data(), needsRehash, &context)
+               : ErrorCode::Success;
+    }
+  }
+
+  uint64_t elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - job->enqueuedAt).count());
+  {
+    std::lock_guard<std::mutex> lock(g_passwordVerifier.mutex);
+    g_passwordVerifier.latencyUs[g_passwordVerifier.latencyNext] =
+      static_cast<uint32_t>(std::min<uint64_t>(elapsedUs, UINT32_MAX));
+    g_passwordVerifier.latencyNext = (g_passwordVerifier.latencyNext + 1) % PASSWORD_VERIFIER_LATENCY_SAMPLES;
+
+    if (g_passwordVerifier.latencyCount < PASSWORD_VERIFIER_LATENCY_SAMPLES) {
+      ++g_passwordVerifier.latencyCount;
+    }
+
+    ++g_passwordVerifier.completed;
+  }
+
+  if (job->kind == PasswordJobKind::Login) {
+    if (job->loginCallback) {
+      job->loginCallback(result, context, job->userData);
+    } else {
+      job->loginPromise.set_value(LoginResult(result, context));
+    }
+  } else if (job->callback) {
+    job->callback(result, job->userData);
+  } else {
+    job->promise.set_value(result);
+  }
+
+  delete job;
+}
+
+/**
+ * @brief Worker döngüsü: kuyruk boşalana ve durma istenene kadar iş al
+ */
+static void passwordWorkerLoop() {
+  t_onPasswordWorker = true;
+
+  for (;;) {
+    PasswordJob *job = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(g_passwordVerifier.mutex);
+
+      while (g_passwordVerifier.queue.empty() && g_passwordVerifier.accepting) {
+        g_passwordVerifier.workAvailable.wait(lock);
+      }
+
+      if (g_passwordVerifier.queue.empty()) {
+        return;
+      }
+
+      job = g_passwordVerifier.queue.front();
+      g_passwordVerifier.queue.pop_front();
+    }
+    runPasswordJob(job);
+  }
+}
+
+/**
+ * @brief Havuzu başlat (lifecycleMutex tutulurken çağrılmalı)
+ *
+ * @param workerCount Worker sayısı (0 = CPU çekirdek sayısı)
+ * @param queueCapacity Kuyruk kapasitesi (0 = varsayılan)
+ * @return ErrorCode Success veya MemoryAllocation (hiç thread oluşturulamadı)
+ */
+static ErrorCode startPasswordVerifierLocked(unsigned workerCount, size_t queueCapacity) {
+  if (workerCount == 0) {
+    workerCount = std::thread::hardware_concurrency();
+  }
+
+  if (workerCount == 0) {
+    workerCount = 1;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(g_passwordVerifier.mutex);
+    g_passwordVerifier.capacity = queueCapacity > 0 ? queueCapacity : PASSWORD_VERIFIER_DEFAULT_CAPACITY;
+    g_passwordVerifier.accepting = true;
+  }
+  g_passwordVerifier.workers.reserve(workerCount);
+
+  for (unsigned i = 0; i < workerCount; ++i) {
+    try {
+      g_passwordVerifier.workers.emplace_back(passwordWorkerLoop);
+    } catch (const std::system_error &) {
+      break;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(g_passwordVerifier.mutex);
+
+  if (g_passwordVerifier.workers.empty()) {
+    g_passwordVerifier.accepting = false;
+    return ErrorCode::MemoryAllocation;
+  }
+
+  g_passwordVerifier.workerCount = static_cast<unsigned>(g_passwordVerifier.workers.size());
+  g_passwordVerifier.running.store(true, std::memory_order_release);
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Havuzu durdur (lifecycleMutex tutulurken çağrılmalı)
+ *
+ * Kabul kapatılır, worker'lar kuyruğu boşaltıp çıkar.
+ */
+static void stopPasswordVerifierLocked() {
+  {
+    std::lock_guard<std::mutex> lock(g_passwordVerifier.mutex);
+    g_passwordVerifier.accepting = false;
+    g_passwordVerifier.workerCount = 0;
+  }
+  g_passwordVerifier.workAvailable.notify_all();
+
+  for (size_t i = 0; i < g_passwordVerifier.workers.size(); ++i) {
+    g_passwordVerifier.workers[i].join();
+  }
+
+  g_passwordVerifier.workers.clear();
+  g_passwordVerifier.running.store(false, std::memory_order_release);
+}
+
+ErrorCode configurePasswordVerifier(unsigned workerCount, size_t queueCapacity) {
+  std::lock_guard<std::mutex> lifecycle(g_passwordVerifier.lifecycleMutex);
+
+  if (g_passwordVerifier.running.load(std::memory_order_acquire)) {
+    stopPasswordVerifierLocked();
+  }
+
+  return startPasswordVerifierLocked(workerCount, queueCapacity);
+}
+
+void shutdownPasswordVerifier() {
+  std::lock_guard<std::mutex> lifecycle(g_passwordVerifier.lifecycleMutex);
+
+  if (g_passwordVerifier.running.load(std::memory_order_acquire)) {
+    stopPasswordVerifierLocked();
+  }
+}
+
+/**
+ * @brief İşi kuyruğa al (gerekirse havuzu varsayılanlarla başlat)
+ *
+ * @param job Kuyruğa alınacak iş (başarılıysa sahipliği havuza geçer)
+ * @return ErrorCode Success, Busy (kuyruk dolu / servis durduruluyor) veya MemoryAllocation
+ */
+static ErrorCode enqueuePasswordJob(PasswordJob *job) {
+  if (!g_passwordVerifier.running.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lifecycle(g_passwordVerifier.lifecycleMutex);
+
+    if (!g_passwordVerifier.running.load(std::memory_order_acquire)) {
+      ErrorCode started = startPasswordVerifierLocked(0, 0);
+
+      if (started != ErrorCode::Success) {
+        return started;
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(g_passwordVerifier.mutex);
+
+    if (!g_passwordVerifier.accepting || g_passwordVerifier.queue.size() >= g_passwordVerifier.capacity) {
+      ++g_passwordVerifier.rejected;
+      return ErrorCode::Busy;
+    }
+
+    job->enqueuedAt = std::chrono::steady_clock::now();
+    g_passwordVerifier.queue.push_back(job);
+  }
+  g_passwordVerifier.workAvailable.notify_one();
+  return ErrorCode::Success;
+}
+
+/**
+ * @brief Hazır (sonucu belli) future oluştur
+ *
+ * @param result Sonuç
+ * @return std::future<ErrorCode> Hemen hazır future
+ */
+static std::future<ErrorCode> makeReadyFuture(ErrorCode result) {
+  std::promise<ErrorCode> promise;
+  promise.set_value(result);
+  return promise.get_future();
+}
+
+std::future<ErrorCode> verifyPasswordAsync(const char *password, const char *salt,
+                                           const char *storedHash) {
+  if (!password || !salt || !storedHash || strlen(password) == 0) {
+    return makeReadyFuture(ErrorCode::InvalidInput);
+  }
+
+  PasswordJob *job = new PasswordJob(PasswordJobKind::Verify, password, salt, storedHash);
+  std::future<ErrorCode> future = job->promise.get_future();
+  ErrorCode queued = enqueuePasswordJob(job);
+
+  if (queued != ErrorCode::Success) {
+    delete job;
+    return makeReadyFuture(queued);
+  }
+
+  return future;
+}
+
+ErrorCode verifyPasswordAsync(const char *password, const char *salt, const char *storedHash,
+                              PasswordVerifyCallback callback, void *userData) {
+  if (!password || !salt || !storedHash || !callback || strlen(password) == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  PasswordJob *job = new PasswordJob(PasswordJobKind::Verify, password, salt, storedHash);
+  job->callback = callback;
+  job->userData = userData;
+  ErrorCode queued = enqueuePasswordJob(job);
+
+  if (queued != ErrorCode::Success) {
+    delete job;
+  }
+
+  return queued;
+}
+
+std::future<ErrorCode> authenticateUserAsync(const char *username, const char *password) {
+  if (!username || !password || strlen(username) == 0 || strlen(password) == 0) {
+    return makeReadyFuture(ErrorCode::InvalidInput);
+  }
+
+  sqlite3 *db = Database::getDatabase();
+
+  if (!db) {
+    return makeReadyFuture(ErrorCode::FileNotFound);
+  }
+
+  User foundUser;
+  StoredCredentials credentials;
+  ErrorCode loadResult = loadUserCredentials(db, username, foundUser, credentials);
+  Security::secureMemoryCleanup(&foundUser, sizeof(User));
+
+  if (loadResult != ErrorCode::Success) {
+    return makeReadyFuture(loadResult);
+  }
+
+  return verifyPasswordAsync(password, credentials.salt, credentials.record);
+}
+
+/**
+ * @brief Login işini hazırla: kullanıcı kaydını çağıran thread'de yükle
+ *
+ * Kayıt çoğunlukla kullanıcı önbelleğinden gelir; bilinmeyen kullanıcı
+ * adları negatif önbellek sayesinde kuyruğa girmeden reddedilir.
+ *
+ * @param username Kullanıcı adı
+ * @param password Şifre
+ * @param job Oluşturulan iş (başarılıysa; sahipliği çağırana geçer)
+ * @return ErrorCode Success, InvalidInput, InvalidUser, FileNotFound veya FileIO
+ */
+static ErrorCode prepareLoginJob(const char *username, const char *password, PasswordJob **job) {
+  *job = nullptr;
+
+  if (!username || !password || strlen(username) == 0 || strlen(password) == 0) {
+    return ErrorCode::InvalidInput;
+  }
+
+  sqlite3 *db = Database::getDatabase();
+
+  if (!db) {
+    return ErrorCode::FileNotFound;
+  }
+
+  User foundUser;
+  StoredCredentials credentials;
+  ErrorCode loadResult = loadUserCredentials(db, username, foundUser, credentials);
+
+  if (loadResult == ErrorCode::Success) {
+    *job = new PasswordJob(PasswordJobKind::Login, password, credentials.salt, credentials.record);
+    (*job)->user = foundUser;
+    (*job)->db = db;
+  }
+
+  Security::secureMemoryCleanup(&foundUser, sizeof(User));
+  return loadResult;
+}
+
+std::future<LoginResult> loginUserAsync(const char *username, const char *password) {
+  PasswordJob *job = nullptr;
+  ErrorCode prepared = prepareLoginJob(username, password, &job);
+
+  if (prepared == ErrorCode::Success) {
+    std::future<LoginResult> future = job->loginPromise.get_future();
+    prepared = enqueuePasswordJob(job);
+
+    if (prepared == ErrorCode::Success) {
+      return future;
+    }
+
+    delete job;
+  }
+
+  std::promise<LoginResult> ready;
+  ready.set_value(LoginResult(prepared, nullptr));
+  return ready.get_future();
+}
+
+ErrorCode loginUserAsync(const char *username, const char *password, LoginCallback callback,
+                         void *userData) {
+  if (!callback) {
+    return ErrorCode::InvalidInput;
+  }
+
+  PasswordJob *job = nullptr;
+  ErrorCode prepared = prepareLoginJob(username, password, &job);
+
+  if (prepared != ErrorCode::Success) {
+    return prepared;
+  }
+
+  job->loginCallback = callback;
+  job->userData = userData;
+  ErrorCode queued = enqueuePasswordJob(job);
+
+  if (queued != ErrorCode::Success) {
+    delete job;
+  }
+
+  return queued;
+}
+
+std::future<ErrorCode> registerUserAsync(const char *username, const char *password) {
+  if (!isValidRegistration(username, password)) {
+    return makeReadyFuture(ErrorCode::InvalidInput);
+  }
+
+  // SQLite veritabanını al (bağlantı çağıran thread'de açılır)
+  sqlite3 *db = Database::getDatabase();
+
+  if (!db) {
+    return makeReadyFuture(ErrorCode::FileNotFound);
+  }
+
+  PasswordJob *job = new PasswordJob(PasswordJobKind::Register, password, "", "");
+  memcpy(job->username, username, strlen(username));
+  job->db = db;
+  std::future<ErrorCode> future = job->promise.get_future();
+  ErrorCode queued = enqueuePasswordJob(job);
+
+  if (queued != ErrorCode::Success) {
+    delete job;
+    return makeReadyFuture(queued);
+  }
+
+  return future;
+}
+
+void getPasswordVerifierStats(PasswordVerifierStats &stats) {
+  std::vector<uint32_t> samples;
+  {
+    std::lock_guard<std::mutex> lock(g_passwordVerifier.mutex);
+    stats.queueDepth = g_passwordVerifier.queue.size();
+    stats.queueCapacity = g_passwordVerifier.capacity;
+    stats.workerCount = g_passwordVerifier.workerCount;
+    stats.completed = g_passwordVerifier.completed;
+    stats.rejected = g_passwordVerifier.rejected;
+    samples.assign(g_passwordVerifier.latencyUs, g_passwordVerifier.latencyUs + g_passwordVerifier.latencyCount);
+  }
+  stats.p50LatencyMs = 0.0;
+  stats.p99LatencyMs = 0.0;
+
+  if (samples.empty()) {
+    return;
+  }
+
+  // Yüzdelik: sıralı dizide ceil(p * n) - 1 indeksi
+  size_t p50 = (samples.size() * 50 + 99) / 100 - 1;
+  size_t p99 = (samples.size() * 99 + 99) / 100 - 1;
+  std::nth_element(samples.begin(), samples.begin() + p99, samples.end());
+  stats.p99LatencyMs = samples[p99] / 1000.0;
+  std::nth_element(samples.begin(), samples.begin() + p50, samples.begin() + p99);
+  stats.p50LatencyMs = samples[p50] / 1000.0;
+}
 }
 
 } // namespace TravelExpense
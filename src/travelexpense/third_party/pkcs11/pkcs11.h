@@ -45,6 +45,10 @@ typedef CK_ULONG CK_STATE;
 #define CKF_TOKEN_PRESENT                0x00000100
 #define CKF_HW                           0x00000001
 
+// C_Initialize flags
+#define CKF_LIBRARY_CANT_CREATE_OS_THREADS 0x00000001
+#define CKF_OS_LOCKING_OK                0x00000002
+
 // Return codes
 #define CKR_OK                           0x00000000
 #define CKR_GENERAL_ERROR                0x00000001
@@ -619,6 +623,21 @@ typedef struct CK_MECHANISM {
   CK_ULONG ulParameterLen;
 } CK_MECHANISM;
 
+// C_Initialize arguments (mutex callback'leri yerine CKF_OS_LOCKING_OK kullanılabilir)
+typedef CK_ULONG (*CK_CREATEMUTEX)(void **);
+typedef CK_ULONG (*CK_DESTROYMUTEX)(void *);
+typedef CK_ULONG (*CK_LOCKMUTEX)(void *);
+typedef CK_ULONG (*CK_UNLOCKMUTEX)(void *);
+
+typedef struct CK_C_INITIALIZE_ARGS {
+  CK_CREATEMUTEX CreateMutex;
+  CK_DESTROYMUTEX DestroyMutex;
+  CK_LOCKMUTEX LockMutex;
+  CK_UNLOCKMUTEX UnlockMutex;
+  CK_ULONG flags;
+  void *pReserved;
+} CK_C_INITIALIZE_ARGS;
+
 // Function pointer types
 typedef CK_ULONG (*CK_C_Initialize)(void *);
 typedef CK_ULONG (*CK_C_Finalize)(void *);